@@ -0,0 +1,195 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMake/SiloConfig.cmake.in"
+  "/root/repo/CMake/SiloFindHDF5.cmake"
+  "/root/repo/CMake/SiloHelpers.cmake"
+  "/root/repo/CMake/config.h.cmake.in"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/hdf5/cmake_hdf5_test.c"
+  "/root/repo/src/silo/silo.h.in"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tools/browser/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindHDF5.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "include/silo.h"
+  "DartConfiguration.tcl"
+  "include/config.h"
+  "cmake/SiloConfig.cmake"
+  "cmake/SiloConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/browser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/pdb_detect.dir/DependInfo.cmake"
+  "CMakeFiles/silo.dir/DependInfo.cmake"
+  "CMakeFiles/silock.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/installcheck.dir/DependInfo.cmake"
+  "tools/browser/CMakeFiles/browser.dir/DependInfo.cmake"
+  "tests/CMakeFiles/copy_test_data.dir/DependInfo.cmake"
+  "tests/CMakeFiles/rocket_silo.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testlib_obj.dir/DependInfo.cmake"
+  "tests/CMakeFiles/TestReadMask.dir/DependInfo.cmake"
+  "tests/CMakeFiles/alltypes.dir/DependInfo.cmake"
+  "tests/CMakeFiles/arbpoly.dir/DependInfo.cmake"
+  "tests/CMakeFiles/arbpoly2d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/arbpoly3d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/array.dir/DependInfo.cmake"
+  "tests/CMakeFiles/chunked_slice.dir/DependInfo.cmake"
+  "tests/CMakeFiles/compname.dir/DependInfo.cmake"
+  "tests/CMakeFiles/compression.dir/DependInfo.cmake"
+  "tests/CMakeFiles/convperf.dir/DependInfo.cmake"
+  "tests/CMakeFiles/csg.dir/DependInfo.cmake"
+  "tests/CMakeFiles/dbversion.dir/DependInfo.cmake"
+  "tests/CMakeFiles/degen_hex.dir/DependInfo.cmake"
+  "tests/CMakeFiles/dir.dir/DependInfo.cmake"
+  "tests/CMakeFiles/efcentering.dir/DependInfo.cmake"
+  "tests/CMakeFiles/empty.dir/DependInfo.cmake"
+  "tests/CMakeFiles/extface.dir/DependInfo.cmake"
+  "tests/CMakeFiles/extface_threads.dir/DependInfo.cmake"
+  "tests/CMakeFiles/grab.dir/DependInfo.cmake"
+  "tests/CMakeFiles/group_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/hashperf.dir/DependInfo.cmake"
+  "tests/CMakeFiles/hyper_accruate_lineout_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/largefile.dir/DependInfo.cmake"
+  "tests/CMakeFiles/listtypes.dir/DependInfo.cmake"
+  "tests/CMakeFiles/majorder.dir/DependInfo.cmake"
+  "tests/CMakeFiles/mat3d_3across.dir/DependInfo.cmake"
+  "tests/CMakeFiles/memfile_simple.dir/DependInfo.cmake"
+  "tests/CMakeFiles/merge_block.dir/DependInfo.cmake"
+  "tests/CMakeFiles/misc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/mk_nasf_h5.dir/DependInfo.cmake"
+  "tests/CMakeFiles/mk_nasf_pdb.dir/DependInfo.cmake"
+  "tests/CMakeFiles/mmadjacency.dir/DependInfo.cmake"
+  "tests/CMakeFiles/multi_file.dir/DependInfo.cmake"
+  "tests/CMakeFiles/multi_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/multi_writer.dir/DependInfo.cmake"
+  "tests/CMakeFiles/multispec.dir/DependInfo.cmake"
+  "tests/CMakeFiles/namescheme.dir/DependInfo.cmake"
+  "tests/CMakeFiles/obj.dir/DependInfo.cmake"
+  "tests/CMakeFiles/objcache.dir/DependInfo.cmake"
+  "tests/CMakeFiles/onehex.dir/DependInfo.cmake"
+  "tests/CMakeFiles/oneprism.dir/DependInfo.cmake"
+  "tests/CMakeFiles/onepyramid.dir/DependInfo.cmake"
+  "tests/CMakeFiles/onetet.dir/DependInfo.cmake"
+  "tests/CMakeFiles/partial_io.dir/DependInfo.cmake"
+  "tests/CMakeFiles/pdbio.dir/DependInfo.cmake"
+  "tests/CMakeFiles/pdbtst.dir/DependInfo.cmake"
+  "tests/CMakeFiles/point.dir/DependInfo.cmake"
+  "tests/CMakeFiles/polyzl.dir/DependInfo.cmake"
+  "tests/CMakeFiles/quad.dir/DependInfo.cmake"
+  "tests/CMakeFiles/readstuff.dir/DependInfo.cmake"
+  "tests/CMakeFiles/realloc_obj_and_opts.dir/DependInfo.cmake"
+  "tests/CMakeFiles/sami.dir/DependInfo.cmake"
+  "tests/CMakeFiles/simple.dir/DependInfo.cmake"
+  "tests/CMakeFiles/spec.dir/DependInfo.cmake"
+  "tests/CMakeFiles/specmix.dir/DependInfo.cmake"
+  "tests/CMakeFiles/subhex.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_mat_compression.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testall.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testfs.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testhdf5.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testpdb.dir/DependInfo.cmake"
+  "tests/CMakeFiles/threaded_read.dir/DependInfo.cmake"
+  "tests/CMakeFiles/toc_index.dir/DependInfo.cmake"
+  "tests/CMakeFiles/twohex.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ucd.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ucd1d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ucdsamp3.dir/DependInfo.cmake"
+  "tests/CMakeFiles/wave.dir/DependInfo.cmake"
+  "tests/CMakeFiles/newsami.dir/DependInfo.cmake"
+  "tests/CMakeFiles/rocket.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testdtypes.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testsilock.dir/DependInfo.cmake"
+  "tests/CMakeFiles/checksums.dir/DependInfo.cmake"
+  )
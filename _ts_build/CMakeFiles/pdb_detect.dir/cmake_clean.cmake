@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pdb_detect.dir/src/pdb/detect.c.o"
+  "CMakeFiles/pdb_detect.dir/src/pdb/detect.c.o.d"
+  "bin/pdb_detect"
+  "bin/pdb_detect.pdb"
+  "include/lite_pdb.h"
+  "include/lite_score.h"
+  "include/pdform.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pdb_detect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
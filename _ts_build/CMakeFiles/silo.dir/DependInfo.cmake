@@ -0,0 +1,95 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/debug/silo_debug.c" "CMakeFiles/silo.dir/src/debug/silo_debug.c.o" "gcc" "CMakeFiles/silo.dir/src/debug/silo_debug.c.o.d"
+  "/root/repo/src/filters/f_ale3d.c" "CMakeFiles/silo.dir/src/filters/f_ale3d.c.o" "gcc" "CMakeFiles/silo.dir/src/filters/f_ale3d.c.o.d"
+  "/root/repo/src/filters/f_sample.c" "CMakeFiles/silo.dir/src/filters/f_sample.c.o" "gcc" "CMakeFiles/silo.dir/src/filters/f_sample.c.o.d"
+  "/root/repo/src/hdf5_drv/H5FDsilo.c" "CMakeFiles/silo.dir/src/hdf5_drv/H5FDsilo.c.o" "gcc" "CMakeFiles/silo.dir/src/hdf5_drv/H5FDsilo.c.o.d"
+  "/root/repo/src/hdf5_drv/H5Zzfp.c" "CMakeFiles/silo.dir/src/hdf5_drv/H5Zzfp.c.o" "gcc" "CMakeFiles/silo.dir/src/hdf5_drv/H5Zzfp.c.o.d"
+  "/root/repo/src/hdf5_drv/silo_hdf5.c" "CMakeFiles/silo.dir/src/hdf5_drv/silo_hdf5.c.o" "gcc" "CMakeFiles/silo.dir/src/hdf5_drv/silo_hdf5.c.o.d"
+  "/root/repo/src/netcdf/api.c" "CMakeFiles/silo.dir/src/netcdf/api.c.o" "gcc" "CMakeFiles/silo.dir/src/netcdf/api.c.o.d"
+  "/root/repo/src/netcdf/ent.c" "CMakeFiles/silo.dir/src/netcdf/ent.c.o" "gcc" "CMakeFiles/silo.dir/src/netcdf/ent.c.o.d"
+  "/root/repo/src/netcdf/netcdf.c" "CMakeFiles/silo.dir/src/netcdf/netcdf.c.o" "gcc" "CMakeFiles/silo.dir/src/netcdf/netcdf.c.o.d"
+  "/root/repo/src/netcdf/obj.c" "CMakeFiles/silo.dir/src/netcdf/obj.c.o" "gcc" "CMakeFiles/silo.dir/src/netcdf/obj.c.o.d"
+  "/root/repo/src/netcdf/silo_netcdf.c" "CMakeFiles/silo.dir/src/netcdf/silo_netcdf.c.o" "gcc" "CMakeFiles/silo.dir/src/netcdf/silo_netcdf.c.o.d"
+  "/root/repo/src/netcdf/table.c" "CMakeFiles/silo.dir/src/netcdf/table.c.o" "gcc" "CMakeFiles/silo.dir/src/netcdf/table.c.o.d"
+  "/root/repo/src/pdb/pdb.c" "CMakeFiles/silo.dir/src/pdb/pdb.c.o" "gcc" "CMakeFiles/silo.dir/src/pdb/pdb.c.o.d"
+  "/root/repo/src/pdb/pdbdir.c" "CMakeFiles/silo.dir/src/pdb/pdbdir.c.o" "gcc" "CMakeFiles/silo.dir/src/pdb/pdbdir.c.o.d"
+  "/root/repo/src/pdb/pdbio.c" "CMakeFiles/silo.dir/src/pdb/pdbio.c.o" "gcc" "CMakeFiles/silo.dir/src/pdb/pdbio.c.o.d"
+  "/root/repo/src/pdb/pdbmm.c" "CMakeFiles/silo.dir/src/pdb/pdbmm.c.o" "gcc" "CMakeFiles/silo.dir/src/pdb/pdbmm.c.o.d"
+  "/root/repo/src/pdb/pdbx.c" "CMakeFiles/silo.dir/src/pdb/pdbx.c.o" "gcc" "CMakeFiles/silo.dir/src/pdb/pdbx.c.o.d"
+  "/root/repo/src/pdb/pdconv.c" "CMakeFiles/silo.dir/src/pdb/pdconv.c.o" "gcc" "CMakeFiles/silo.dir/src/pdb/pdconv.c.o.d"
+  "/root/repo/src/pdb/pdlow.c" "CMakeFiles/silo.dir/src/pdb/pdlow.c.o" "gcc" "CMakeFiles/silo.dir/src/pdb/pdlow.c.o.d"
+  "/root/repo/src/pdb/pdmemb.c" "CMakeFiles/silo.dir/src/pdb/pdmemb.c.o" "gcc" "CMakeFiles/silo.dir/src/pdb/pdmemb.c.o.d"
+  "/root/repo/src/pdb/pdpath.c" "CMakeFiles/silo.dir/src/pdb/pdpath.c.o" "gcc" "CMakeFiles/silo.dir/src/pdb/pdpath.c.o.d"
+  "/root/repo/src/pdb/pdrdwr.c" "CMakeFiles/silo.dir/src/pdb/pdrdwr.c.o" "gcc" "CMakeFiles/silo.dir/src/pdb/pdrdwr.c.o.d"
+  "/root/repo/src/pdb_drv/silo_pdb.c" "CMakeFiles/silo.dir/src/pdb_drv/silo_pdb.c.o" "gcc" "CMakeFiles/silo.dir/src/pdb_drv/silo_pdb.c.o.d"
+  "/root/repo/src/score/memmove.c" "CMakeFiles/silo.dir/src/score/memmove.c.o" "gcc" "CMakeFiles/silo.dir/src/score/memmove.c.o.d"
+  "/root/repo/src/score/scctl.c" "CMakeFiles/silo.dir/src/score/scctl.c.o" "gcc" "CMakeFiles/silo.dir/src/score/scctl.c.o.d"
+  "/root/repo/src/score/scctla.c" "CMakeFiles/silo.dir/src/score/scctla.c.o" "gcc" "CMakeFiles/silo.dir/src/score/scctla.c.o.d"
+  "/root/repo/src/score/schash.c" "CMakeFiles/silo.dir/src/score/schash.c.o" "gcc" "CMakeFiles/silo.dir/src/score/schash.c.o.d"
+  "/root/repo/src/score/scstr.c" "CMakeFiles/silo.dir/src/score/scstr.c.o" "gcc" "CMakeFiles/silo.dir/src/score/scstr.c.o.d"
+  "/root/repo/src/silo/alloc.c" "CMakeFiles/silo.dir/src/silo/alloc.c.o" "gcc" "CMakeFiles/silo.dir/src/silo/alloc.c.o.d"
+  "/root/repo/src/silo/extface.c" "CMakeFiles/silo.dir/src/silo/extface.c.o" "gcc" "CMakeFiles/silo.dir/src/silo/extface.c.o.d"
+  "/root/repo/src/silo/silo.c" "CMakeFiles/silo.dir/src/silo/silo.c.o" "gcc" "CMakeFiles/silo.dir/src/silo/silo.c.o.d"
+  "/root/repo/src/silo/silo_ns.c" "CMakeFiles/silo.dir/src/silo/silo_ns.c.o" "gcc" "CMakeFiles/silo.dir/src/silo/silo_ns.c.o.d"
+  "/root/repo/src/silo/utils.c" "CMakeFiles/silo.dir/src/silo/utils.c.o" "gcc" "CMakeFiles/silo.dir/src/silo/utils.c.o.d"
+  "/root/repo/src/taurus/silo_taurus.c" "CMakeFiles/silo.dir/src/taurus/silo_taurus.c.o" "gcc" "CMakeFiles/silo.dir/src/taurus/silo_taurus.c.o.d"
+  "/root/repo/src/taurus/taurus.c" "CMakeFiles/silo.dir/src/taurus/taurus.c.o" "gcc" "CMakeFiles/silo.dir/src/taurus/taurus.c.o.d"
+  "/root/repo/src/unknown/silo_unknown.c" "CMakeFiles/silo.dir/src/unknown/silo_unknown.c.o" "gcc" "CMakeFiles/silo.dir/src/unknown/silo_unknown.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/bitstream.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/bitstream.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/bitstream.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode1d.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1d.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1d.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode1f.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1f.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1f.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode1i.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1i.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1i.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode1l.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1l.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1l.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode2d.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2d.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2d.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode2f.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2f.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2f.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode2i.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2i.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2i.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode2l.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2l.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2l.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode3d.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3d.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3d.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode3f.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3f.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3f.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode3i.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3i.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3i.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode3l.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3l.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3l.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode4d.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4d.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4d.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode4f.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4f.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4f.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode4i.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4i.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4i.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/decode4l.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4l.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4l.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode1d.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1d.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1d.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode1f.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1f.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1f.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode1i.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1i.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1i.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode1l.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1l.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1l.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode2d.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2d.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2d.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode2f.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2f.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2f.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode2i.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2i.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2i.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode2l.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2l.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2l.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode3d.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3d.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3d.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode3f.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3f.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3f.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode3i.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3i.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3i.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode3l.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3l.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3l.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode4d.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4d.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4d.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode4f.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4f.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4f.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode4i.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4i.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4i.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/encode4l.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4l.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4l.c.o.d"
+  "/root/repo/src/zfp-0.5.5/src/zfp.c" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/zfp.c.o" "gcc" "CMakeFiles/silo.dir/src/zfp-0.5.5/src/zfp.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ts_build/lib/libsiloh5.so" "/root/repo/_ts_build/lib/libsiloh5.so.4.12.0"
+  "/root/repo/_ts_build/lib/libsiloh5.so.412" "/root/repo/_ts_build/lib/libsiloh5.so.4.12.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
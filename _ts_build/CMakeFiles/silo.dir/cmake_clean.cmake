@@ -0,0 +1,151 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/silo.dir/src/debug/silo_debug.c.o"
+  "CMakeFiles/silo.dir/src/debug/silo_debug.c.o.d"
+  "CMakeFiles/silo.dir/src/filters/f_ale3d.c.o"
+  "CMakeFiles/silo.dir/src/filters/f_ale3d.c.o.d"
+  "CMakeFiles/silo.dir/src/filters/f_sample.c.o"
+  "CMakeFiles/silo.dir/src/filters/f_sample.c.o.d"
+  "CMakeFiles/silo.dir/src/hdf5_drv/H5FDsilo.c.o"
+  "CMakeFiles/silo.dir/src/hdf5_drv/H5FDsilo.c.o.d"
+  "CMakeFiles/silo.dir/src/hdf5_drv/H5Zzfp.c.o"
+  "CMakeFiles/silo.dir/src/hdf5_drv/H5Zzfp.c.o.d"
+  "CMakeFiles/silo.dir/src/hdf5_drv/silo_hdf5.c.o"
+  "CMakeFiles/silo.dir/src/hdf5_drv/silo_hdf5.c.o.d"
+  "CMakeFiles/silo.dir/src/netcdf/api.c.o"
+  "CMakeFiles/silo.dir/src/netcdf/api.c.o.d"
+  "CMakeFiles/silo.dir/src/netcdf/ent.c.o"
+  "CMakeFiles/silo.dir/src/netcdf/ent.c.o.d"
+  "CMakeFiles/silo.dir/src/netcdf/netcdf.c.o"
+  "CMakeFiles/silo.dir/src/netcdf/netcdf.c.o.d"
+  "CMakeFiles/silo.dir/src/netcdf/obj.c.o"
+  "CMakeFiles/silo.dir/src/netcdf/obj.c.o.d"
+  "CMakeFiles/silo.dir/src/netcdf/silo_netcdf.c.o"
+  "CMakeFiles/silo.dir/src/netcdf/silo_netcdf.c.o.d"
+  "CMakeFiles/silo.dir/src/netcdf/table.c.o"
+  "CMakeFiles/silo.dir/src/netcdf/table.c.o.d"
+  "CMakeFiles/silo.dir/src/pdb/pdb.c.o"
+  "CMakeFiles/silo.dir/src/pdb/pdb.c.o.d"
+  "CMakeFiles/silo.dir/src/pdb/pdbdir.c.o"
+  "CMakeFiles/silo.dir/src/pdb/pdbdir.c.o.d"
+  "CMakeFiles/silo.dir/src/pdb/pdbio.c.o"
+  "CMakeFiles/silo.dir/src/pdb/pdbio.c.o.d"
+  "CMakeFiles/silo.dir/src/pdb/pdbmm.c.o"
+  "CMakeFiles/silo.dir/src/pdb/pdbmm.c.o.d"
+  "CMakeFiles/silo.dir/src/pdb/pdbx.c.o"
+  "CMakeFiles/silo.dir/src/pdb/pdbx.c.o.d"
+  "CMakeFiles/silo.dir/src/pdb/pdconv.c.o"
+  "CMakeFiles/silo.dir/src/pdb/pdconv.c.o.d"
+  "CMakeFiles/silo.dir/src/pdb/pdlow.c.o"
+  "CMakeFiles/silo.dir/src/pdb/pdlow.c.o.d"
+  "CMakeFiles/silo.dir/src/pdb/pdmemb.c.o"
+  "CMakeFiles/silo.dir/src/pdb/pdmemb.c.o.d"
+  "CMakeFiles/silo.dir/src/pdb/pdpath.c.o"
+  "CMakeFiles/silo.dir/src/pdb/pdpath.c.o.d"
+  "CMakeFiles/silo.dir/src/pdb/pdrdwr.c.o"
+  "CMakeFiles/silo.dir/src/pdb/pdrdwr.c.o.d"
+  "CMakeFiles/silo.dir/src/pdb_drv/silo_pdb.c.o"
+  "CMakeFiles/silo.dir/src/pdb_drv/silo_pdb.c.o.d"
+  "CMakeFiles/silo.dir/src/score/memmove.c.o"
+  "CMakeFiles/silo.dir/src/score/memmove.c.o.d"
+  "CMakeFiles/silo.dir/src/score/scctl.c.o"
+  "CMakeFiles/silo.dir/src/score/scctl.c.o.d"
+  "CMakeFiles/silo.dir/src/score/scctla.c.o"
+  "CMakeFiles/silo.dir/src/score/scctla.c.o.d"
+  "CMakeFiles/silo.dir/src/score/schash.c.o"
+  "CMakeFiles/silo.dir/src/score/schash.c.o.d"
+  "CMakeFiles/silo.dir/src/score/scstr.c.o"
+  "CMakeFiles/silo.dir/src/score/scstr.c.o.d"
+  "CMakeFiles/silo.dir/src/silo/alloc.c.o"
+  "CMakeFiles/silo.dir/src/silo/alloc.c.o.d"
+  "CMakeFiles/silo.dir/src/silo/extface.c.o"
+  "CMakeFiles/silo.dir/src/silo/extface.c.o.d"
+  "CMakeFiles/silo.dir/src/silo/silo.c.o"
+  "CMakeFiles/silo.dir/src/silo/silo.c.o.d"
+  "CMakeFiles/silo.dir/src/silo/silo_ns.c.o"
+  "CMakeFiles/silo.dir/src/silo/silo_ns.c.o.d"
+  "CMakeFiles/silo.dir/src/silo/utils.c.o"
+  "CMakeFiles/silo.dir/src/silo/utils.c.o.d"
+  "CMakeFiles/silo.dir/src/taurus/silo_taurus.c.o"
+  "CMakeFiles/silo.dir/src/taurus/silo_taurus.c.o.d"
+  "CMakeFiles/silo.dir/src/taurus/taurus.c.o"
+  "CMakeFiles/silo.dir/src/taurus/taurus.c.o.d"
+  "CMakeFiles/silo.dir/src/unknown/silo_unknown.c.o"
+  "CMakeFiles/silo.dir/src/unknown/silo_unknown.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/bitstream.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/bitstream.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1d.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1d.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1f.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1f.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1i.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1i.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1l.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode1l.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2d.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2d.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2f.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2f.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2i.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2i.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2l.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode2l.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3d.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3d.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3f.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3f.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3i.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3i.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3l.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode3l.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4d.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4d.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4f.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4f.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4i.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4i.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4l.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/decode4l.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1d.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1d.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1f.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1f.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1i.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1i.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1l.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode1l.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2d.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2d.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2f.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2f.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2i.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2i.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2l.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode2l.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3d.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3d.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3f.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3f.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3i.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3i.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3l.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode3l.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4d.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4d.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4f.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4f.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4i.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4i.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4l.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/encode4l.c.o.d"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/zfp.c.o"
+  "CMakeFiles/silo.dir/src/zfp-0.5.5/src/zfp.c.o.d"
+  "lib/libsiloh5.pdb"
+  "lib/libsiloh5.so"
+  "lib/libsiloh5.so.4.12.0"
+  "lib/libsiloh5.so.412"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/silo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/silock.dir/tools/silock/silock.c.o"
+  "CMakeFiles/silock.dir/tools/silock/silock.c.o.d"
+  "bin/silock"
+  "bin/silock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/silock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
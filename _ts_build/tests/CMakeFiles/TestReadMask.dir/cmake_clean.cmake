@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TestReadMask.dir/TestReadMask.c.o"
+  "CMakeFiles/TestReadMask.dir/TestReadMask.c.o.d"
+  "bin/TestReadMask"
+  "bin/TestReadMask.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/TestReadMask.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
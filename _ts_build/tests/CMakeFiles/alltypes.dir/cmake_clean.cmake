@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/alltypes.dir/alltypes.c.o"
+  "CMakeFiles/alltypes.dir/alltypes.c.o.d"
+  "bin/alltypes"
+  "bin/alltypes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/alltypes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arbpoly.dir/arbpoly.c.o"
+  "CMakeFiles/arbpoly.dir/arbpoly.c.o.d"
+  "bin/arbpoly"
+  "bin/arbpoly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/arbpoly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arbpoly2d.dir/arbpoly2d.c.o"
+  "CMakeFiles/arbpoly2d.dir/arbpoly2d.c.o.d"
+  "bin/arbpoly2d"
+  "bin/arbpoly2d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/arbpoly2d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arbpoly3d.dir/arbpoly3d.c.o"
+  "CMakeFiles/arbpoly3d.dir/arbpoly3d.c.o.d"
+  "bin/arbpoly3d"
+  "bin/arbpoly3d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/arbpoly3d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
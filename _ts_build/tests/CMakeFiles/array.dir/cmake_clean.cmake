@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array.dir/array.c.o"
+  "CMakeFiles/array.dir/array.c.o.d"
+  "bin/array"
+  "bin/array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
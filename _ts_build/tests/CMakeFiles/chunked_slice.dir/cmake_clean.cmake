@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/chunked_slice.dir/chunked_slice.c.o"
+  "CMakeFiles/chunked_slice.dir/chunked_slice.c.o.d"
+  "bin/chunked_slice"
+  "bin/chunked_slice.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/chunked_slice.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
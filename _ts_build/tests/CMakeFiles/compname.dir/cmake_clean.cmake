@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compname.dir/compname.c.o"
+  "CMakeFiles/compname.dir/compname.c.o.d"
+  "bin/compname"
+  "bin/compname.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/compname.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compression.dir/compression.c.o"
+  "CMakeFiles/compression.dir/compression.c.o.d"
+  "bin/compression"
+  "bin/compression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/compression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/convperf.dir/convperf.c.o"
+  "CMakeFiles/convperf.dir/convperf.c.o.d"
+  "bin/convperf"
+  "bin/convperf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/convperf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/csg.dir/csg.c.o"
+  "CMakeFiles/csg.dir/csg.c.o.d"
+  "bin/csg"
+  "bin/csg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/csg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
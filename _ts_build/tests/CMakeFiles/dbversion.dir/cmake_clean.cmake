@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dbversion.dir/dbversion.c.o"
+  "CMakeFiles/dbversion.dir/dbversion.c.o.d"
+  "bin/dbversion"
+  "bin/dbversion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dbversion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/degen_hex.dir/degen_hex.c.o"
+  "CMakeFiles/degen_hex.dir/degen_hex.c.o.d"
+  "bin/degen_hex"
+  "bin/degen_hex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/degen_hex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dir.dir/dir.c.o"
+  "CMakeFiles/dir.dir/dir.c.o.d"
+  "bin/dir"
+  "bin/dir.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/efcentering.dir/efcentering.c.o"
+  "CMakeFiles/efcentering.dir/efcentering.c.o.d"
+  "bin/efcentering"
+  "bin/efcentering.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/efcentering.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
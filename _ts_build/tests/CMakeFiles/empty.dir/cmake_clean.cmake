@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/empty.dir/empty.c.o"
+  "CMakeFiles/empty.dir/empty.c.o.d"
+  "bin/empty"
+  "bin/empty.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/empty.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/extface.dir/extface.c.o"
+  "CMakeFiles/extface.dir/extface.c.o.d"
+  "bin/extface"
+  "bin/extface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/extface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
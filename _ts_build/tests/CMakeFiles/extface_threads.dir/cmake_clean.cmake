@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/extface_threads.dir/extface_threads.c.o"
+  "CMakeFiles/extface_threads.dir/extface_threads.c.o.d"
+  "bin/extface_threads"
+  "bin/extface_threads.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/extface_threads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
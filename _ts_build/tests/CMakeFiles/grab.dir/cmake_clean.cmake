@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/grab.dir/grab.c.o"
+  "CMakeFiles/grab.dir/grab.c.o.d"
+  "bin/grab"
+  "bin/grab.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/grab.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
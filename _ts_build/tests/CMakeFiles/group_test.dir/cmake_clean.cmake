@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/group_test.dir/group_test.c.o"
+  "CMakeFiles/group_test.dir/group_test.c.o.d"
+  "bin/group_test"
+  "bin/group_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/group_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hashperf.dir/hashperf.c.o"
+  "CMakeFiles/hashperf.dir/hashperf.c.o.d"
+  "bin/hashperf"
+  "bin/hashperf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hashperf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hyper_accruate_lineout_test.dir/hyper_accruate_lineout_test.c.o"
+  "CMakeFiles/hyper_accruate_lineout_test.dir/hyper_accruate_lineout_test.c.o.d"
+  "bin/hyper_accruate_lineout_test"
+  "bin/hyper_accruate_lineout_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hyper_accruate_lineout_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/largefile.dir/largefile.c.o"
+  "CMakeFiles/largefile.dir/largefile.c.o.d"
+  "bin/largefile"
+  "bin/largefile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/largefile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/listtypes.dir/listtypes.c.o"
+  "CMakeFiles/listtypes.dir/listtypes.c.o.d"
+  "CMakeFiles/listtypes.dir/listtypes_main.c.o"
+  "CMakeFiles/listtypes.dir/listtypes_main.c.o.d"
+  "bin/listtypes"
+  "bin/listtypes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/listtypes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
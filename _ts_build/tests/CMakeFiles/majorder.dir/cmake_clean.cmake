@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/majorder.dir/majorder.c.o"
+  "CMakeFiles/majorder.dir/majorder.c.o.d"
+  "bin/majorder"
+  "bin/majorder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/majorder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mat3d_3across.dir/mat3d_3across.c.o"
+  "CMakeFiles/mat3d_3across.dir/mat3d_3across.c.o.d"
+  "bin/mat3d_3across"
+  "bin/mat3d_3across.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mat3d_3across.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memfile_simple.dir/memfile_simple.c.o"
+  "CMakeFiles/memfile_simple.dir/memfile_simple.c.o.d"
+  "bin/memfile_simple"
+  "bin/memfile_simple.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/memfile_simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
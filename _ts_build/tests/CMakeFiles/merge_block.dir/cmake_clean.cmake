@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merge_block.dir/merge_block.c.o"
+  "CMakeFiles/merge_block.dir/merge_block.c.o.d"
+  "bin/merge_block"
+  "bin/merge_block.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/merge_block.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/misc.dir/misc.c.o"
+  "CMakeFiles/misc.dir/misc.c.o.d"
+  "bin/misc"
+  "bin/misc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
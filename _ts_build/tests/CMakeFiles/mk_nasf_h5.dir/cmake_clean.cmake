@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mk_nasf_h5.dir/mk_nasf_h5.c.o"
+  "CMakeFiles/mk_nasf_h5.dir/mk_nasf_h5.c.o.d"
+  "bin/mk_nasf_h5"
+  "bin/mk_nasf_h5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mk_nasf_h5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
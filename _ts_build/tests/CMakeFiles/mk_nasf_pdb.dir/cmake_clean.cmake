@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mk_nasf_pdb.dir/mk_nasf_pdb.c.o"
+  "CMakeFiles/mk_nasf_pdb.dir/mk_nasf_pdb.c.o.d"
+  "bin/mk_nasf_pdb"
+  "bin/mk_nasf_pdb.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mk_nasf_pdb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
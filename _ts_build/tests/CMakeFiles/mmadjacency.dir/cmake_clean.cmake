@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmadjacency.dir/mmadjacency.c.o"
+  "CMakeFiles/mmadjacency.dir/mmadjacency.c.o.d"
+  "bin/mmadjacency"
+  "bin/mmadjacency.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mmadjacency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
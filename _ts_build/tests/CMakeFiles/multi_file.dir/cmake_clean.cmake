@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multi_file.dir/multi_file.c.o"
+  "CMakeFiles/multi_file.dir/multi_file.c.o.d"
+  "bin/multi_file"
+  "bin/multi_file.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/multi_file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multi_test.dir/multi_test.c.o"
+  "CMakeFiles/multi_test.dir/multi_test.c.o.d"
+  "bin/multi_test"
+  "bin/multi_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/multi_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multi_writer.dir/multi_writer.c.o"
+  "CMakeFiles/multi_writer.dir/multi_writer.c.o.d"
+  "bin/multi_writer"
+  "bin/multi_writer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/multi_writer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
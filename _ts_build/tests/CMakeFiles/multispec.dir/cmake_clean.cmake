@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multispec.dir/multispec.c.o"
+  "CMakeFiles/multispec.dir/multispec.c.o.d"
+  "bin/multispec"
+  "bin/multispec.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/multispec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/namescheme.dir/namescheme.c.o"
+  "CMakeFiles/namescheme.dir/namescheme.c.o.d"
+  "bin/namescheme"
+  "bin/namescheme.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/namescheme.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
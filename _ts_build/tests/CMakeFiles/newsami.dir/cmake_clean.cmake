@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/newsami.dir/newsami.cxx.o"
+  "CMakeFiles/newsami.dir/newsami.cxx.o.d"
+  "bin/newsami"
+  "bin/newsami.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/newsami.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
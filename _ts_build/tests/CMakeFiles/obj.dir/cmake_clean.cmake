@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/obj.dir/obj.c.o"
+  "CMakeFiles/obj.dir/obj.c.o.d"
+  "bin/obj"
+  "bin/obj.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
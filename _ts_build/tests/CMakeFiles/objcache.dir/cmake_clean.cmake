@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/objcache.dir/objcache.c.o"
+  "CMakeFiles/objcache.dir/objcache.c.o.d"
+  "bin/objcache"
+  "bin/objcache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/objcache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
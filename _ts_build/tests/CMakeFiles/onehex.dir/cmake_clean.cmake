@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/onehex.dir/onehex.c.o"
+  "CMakeFiles/onehex.dir/onehex.c.o.d"
+  "bin/onehex"
+  "bin/onehex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/onehex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oneprism.dir/oneprism.c.o"
+  "CMakeFiles/oneprism.dir/oneprism.c.o.d"
+  "bin/oneprism"
+  "bin/oneprism.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/oneprism.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
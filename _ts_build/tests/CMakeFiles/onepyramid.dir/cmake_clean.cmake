@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/onepyramid.dir/onepyramid.c.o"
+  "CMakeFiles/onepyramid.dir/onepyramid.c.o.d"
+  "bin/onepyramid"
+  "bin/onepyramid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/onepyramid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/onetet.dir/onetet.c.o"
+  "CMakeFiles/onetet.dir/onetet.c.o.d"
+  "bin/onetet"
+  "bin/onetet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/onetet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
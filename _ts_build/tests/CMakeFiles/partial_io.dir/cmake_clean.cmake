@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/partial_io.dir/partial_io.c.o"
+  "CMakeFiles/partial_io.dir/partial_io.c.o.d"
+  "bin/partial_io"
+  "bin/partial_io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/partial_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pdbio.dir/pdbio.c.o"
+  "CMakeFiles/pdbio.dir/pdbio.c.o.d"
+  "bin/pdbio"
+  "bin/pdbio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pdbio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
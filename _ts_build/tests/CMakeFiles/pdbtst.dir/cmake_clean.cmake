@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pdbtst.dir/pdbtst.c.o"
+  "CMakeFiles/pdbtst.dir/pdbtst.c.o.d"
+  "bin/pdbtst"
+  "bin/pdbtst.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pdbtst.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
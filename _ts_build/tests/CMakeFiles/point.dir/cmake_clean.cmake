@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/point.dir/point.c.o"
+  "CMakeFiles/point.dir/point.c.o.d"
+  "bin/point"
+  "bin/point.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/point.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polyzl.dir/polyzl.c.o"
+  "CMakeFiles/polyzl.dir/polyzl.c.o.d"
+  "bin/polyzl"
+  "bin/polyzl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/polyzl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/quad.dir/quad.c.o"
+  "CMakeFiles/quad.dir/quad.c.o.d"
+  "bin/quad"
+  "bin/quad.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/quad.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
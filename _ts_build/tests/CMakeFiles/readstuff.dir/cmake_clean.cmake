@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/readstuff.dir/readstuff.c.o"
+  "CMakeFiles/readstuff.dir/readstuff.c.o.d"
+  "bin/readstuff"
+  "bin/readstuff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/readstuff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
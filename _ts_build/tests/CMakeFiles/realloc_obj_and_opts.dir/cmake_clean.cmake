@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/realloc_obj_and_opts.dir/realloc_obj_and_opts.c.o"
+  "CMakeFiles/realloc_obj_and_opts.dir/realloc_obj_and_opts.c.o.d"
+  "bin/realloc_obj_and_opts"
+  "bin/realloc_obj_and_opts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/realloc_obj_and_opts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
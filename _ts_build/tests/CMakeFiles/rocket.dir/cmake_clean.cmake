@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rocket.dir/rocket.cxx.o"
+  "CMakeFiles/rocket.dir/rocket.cxx.o.d"
+  "bin/rocket"
+  "bin/rocket.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rocket.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
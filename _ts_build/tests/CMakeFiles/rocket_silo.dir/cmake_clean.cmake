@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rocket_silo.dir/rocket_silo.cxx.o"
+  "CMakeFiles/rocket_silo.dir/rocket_silo.cxx.o.d"
+  "lib/rocket_silo.pdb"
+  "lib/rocket_silo.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rocket_silo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
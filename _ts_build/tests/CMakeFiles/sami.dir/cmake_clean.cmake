@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sami.dir/sami.c.o"
+  "CMakeFiles/sami.dir/sami.c.o.d"
+  "bin/sami"
+  "bin/sami.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sami.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
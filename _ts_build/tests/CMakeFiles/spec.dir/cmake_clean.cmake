@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spec.dir/spec.c.o"
+  "CMakeFiles/spec.dir/spec.c.o.d"
+  "bin/spec"
+  "bin/spec.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/spec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
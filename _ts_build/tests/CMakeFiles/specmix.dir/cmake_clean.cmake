@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/specmix.dir/specmix.c.o"
+  "CMakeFiles/specmix.dir/specmix.c.o.d"
+  "bin/specmix"
+  "bin/specmix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/specmix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
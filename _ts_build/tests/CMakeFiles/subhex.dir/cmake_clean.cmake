@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subhex.dir/subhex.c.o"
+  "CMakeFiles/subhex.dir/subhex.c.o.d"
+  "bin/subhex"
+  "bin/subhex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/subhex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mat_compression.dir/test_mat_compression.c.o"
+  "CMakeFiles/test_mat_compression.dir/test_mat_compression.c.o.d"
+  "bin/test_mat_compression"
+  "bin/test_mat_compression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_mat_compression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
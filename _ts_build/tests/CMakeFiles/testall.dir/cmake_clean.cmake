@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testall.dir/testall.c.o"
+  "CMakeFiles/testall.dir/testall.c.o.d"
+  "bin/testall"
+  "bin/testall.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testall.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
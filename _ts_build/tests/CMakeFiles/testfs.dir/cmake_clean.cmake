@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testfs.dir/testfs.c.o"
+  "CMakeFiles/testfs.dir/testfs.c.o.d"
+  "bin/testfs"
+  "bin/testfs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testfs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testhdf5.dir/testhdf5.c.o"
+  "CMakeFiles/testhdf5.dir/testhdf5.c.o.d"
+  "bin/testhdf5"
+  "bin/testhdf5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testhdf5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
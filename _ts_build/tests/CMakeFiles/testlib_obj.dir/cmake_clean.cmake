@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testlib_obj.dir/testlib.c.o"
+  "CMakeFiles/testlib_obj.dir/testlib.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testlib_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
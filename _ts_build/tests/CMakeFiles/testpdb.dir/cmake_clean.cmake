@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testpdb.dir/testpdb.c.o"
+  "CMakeFiles/testpdb.dir/testpdb.c.o.d"
+  "bin/testpdb"
+  "bin/testpdb.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testpdb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
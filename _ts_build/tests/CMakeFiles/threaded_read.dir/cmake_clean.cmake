@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/threaded_read.dir/threaded_read.c.o"
+  "CMakeFiles/threaded_read.dir/threaded_read.c.o.d"
+  "bin/threaded_read"
+  "bin/threaded_read.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/threaded_read.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
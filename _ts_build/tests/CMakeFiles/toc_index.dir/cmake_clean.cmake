@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/toc_index.dir/toc_index.c.o"
+  "CMakeFiles/toc_index.dir/toc_index.c.o.d"
+  "bin/toc_index"
+  "bin/toc_index.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toc_index.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
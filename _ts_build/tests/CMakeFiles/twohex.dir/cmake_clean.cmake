@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/twohex.dir/twohex.c.o"
+  "CMakeFiles/twohex.dir/twohex.c.o.d"
+  "bin/twohex"
+  "bin/twohex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/twohex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ucd.dir/ucd.c.o"
+  "CMakeFiles/ucd.dir/ucd.c.o.d"
+  "bin/ucd"
+  "bin/ucd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ucd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ucd1d.dir/ucd1d.c.o"
+  "CMakeFiles/ucd1d.dir/ucd1d.c.o.d"
+  "bin/ucd1d"
+  "bin/ucd1d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ucd1d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ucdsamp3.dir/ucdsamp3.c.o"
+  "CMakeFiles/ucdsamp3.dir/ucdsamp3.c.o.d"
+  "bin/ucdsamp3"
+  "bin/ucdsamp3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ucdsamp3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
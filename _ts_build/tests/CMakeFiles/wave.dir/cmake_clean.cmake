@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wave.dir/wave.c.o"
+  "CMakeFiles/wave.dir/wave.c.o.d"
+  "bin/wave"
+  "bin/wave.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wave.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
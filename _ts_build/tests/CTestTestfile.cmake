@@ -0,0 +1,362 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_ts_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[TestReadMask]=] "/root/repo/_ts_build/tests/bin/TestReadMask")
+set_tests_properties([=[TestReadMask]=] PROPERTIES  DEPENDS "testall-small;point;extface" LABELS "pdb" REQUIRED_FILES "rect2d.pdb;point2d.pdb;globe.pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[TestReadMask-hdf5]=] "/root/repo/_ts_build/tests/bin/TestReadMask" "DB_HDF5")
+set_tests_properties([=[TestReadMask-hdf5]=] PROPERTIES  DEPENDS "testall-small-hdf5;point-hdf5;extface-hdf5" LABELS "hdf5" REQUIRED_FILES "rect2d.h5;point2d.h5;globe.h5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[alltypes]=] "/root/repo/_ts_build/tests/bin/alltypes")
+set_tests_properties([=[alltypes]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[alltypes-hdf5]=] "/root/repo/_ts_build/tests/bin/alltypes" "DB_HDF5")
+set_tests_properties([=[alltypes-hdf5]=] PROPERTIES  DEPENDS "alltypes" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[arbpoly]=] "/root/repo/_ts_build/tests/bin/arbpoly")
+set_tests_properties([=[arbpoly]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[arbpoly-hdf5]=] "/root/repo/_ts_build/tests/bin/arbpoly" "DB_HDF5")
+set_tests_properties([=[arbpoly-hdf5]=] PROPERTIES  DEPENDS "arbpoly" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[arbpoly2d]=] "/root/repo/_ts_build/tests/bin/arbpoly2d")
+set_tests_properties([=[arbpoly2d]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[arbpoly2d-hdf5]=] "/root/repo/_ts_build/tests/bin/arbpoly2d" "DB_HDF5")
+set_tests_properties([=[arbpoly2d-hdf5]=] PROPERTIES  DEPENDS "arbpoly2d" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[arbpoly3d]=] "/root/repo/_ts_build/tests/bin/arbpoly3d")
+set_tests_properties([=[arbpoly3d]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[arbpoly3d-hdf5]=] "/root/repo/_ts_build/tests/bin/arbpoly3d" "DB_HDF5")
+set_tests_properties([=[arbpoly3d-hdf5]=] PROPERTIES  DEPENDS "arbpoly3d" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[array]=] "/root/repo/_ts_build/tests/bin/array")
+set_tests_properties([=[array]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[array-hdf5]=] "/root/repo/_ts_build/tests/bin/array" "DB_HDF5")
+set_tests_properties([=[array-hdf5]=] PROPERTIES  DEPENDS "array" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[chunked_slice-hdf5]=] "/root/repo/_ts_build/tests/bin/chunked_slice" "DB_HDF5")
+set_tests_properties([=[chunked_slice-hdf5]=] PROPERTIES  LABELS "hdf5" RESOURCE_LOCK "chunked_slice.h5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compname-hdf5]=] "/root/repo/_ts_build/tests/bin/compname" "DB_HDF5")
+set_tests_properties([=[compname-hdf5]=] PROPERTIES  LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-hdf5]=] "/root/repo/_ts_build/tests/bin/compression" "DB_HDF5")
+set_tests_properties([=[compression-hdf5]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "compression.h5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[convperf]=] "/root/repo/_ts_build/tests/bin/convperf")
+set_tests_properties([=[convperf]=] PROPERTIES  LABELS "pdb" RESOURCE_LOCK "convperf.pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;435;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[csg]=] "/root/repo/_ts_build/tests/bin/csg")
+set_tests_properties([=[csg]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[csg-hdf5]=] "/root/repo/_ts_build/tests/bin/csg" "DB_HDF5")
+set_tests_properties([=[csg-hdf5]=] PROPERTIES  DEPENDS "csg" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dbversion]=] "/root/repo/_ts_build/tests/bin/dbversion")
+set_tests_properties([=[dbversion]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dbversion-hdf5]=] "/root/repo/_ts_build/tests/bin/dbversion" "DB_HDF5")
+set_tests_properties([=[dbversion-hdf5]=] PROPERTIES  DEPENDS "dbversion" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[degen_hex]=] "/root/repo/_ts_build/tests/bin/degen_hex")
+set_tests_properties([=[degen_hex]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[degen_hex-hdf5]=] "/root/repo/_ts_build/tests/bin/degen_hex" "DB_HDF5")
+set_tests_properties([=[degen_hex-hdf5]=] PROPERTIES  DEPENDS "degen_hex" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dir]=] "/root/repo/_ts_build/tests/bin/dir")
+set_tests_properties([=[dir]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dir-hdf5]=] "/root/repo/_ts_build/tests/bin/dir" "DB_HDF5")
+set_tests_properties([=[dir-hdf5]=] PROPERTIES  DEPENDS "dir" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[efcentering]=] "/root/repo/_ts_build/tests/bin/efcentering")
+set_tests_properties([=[efcentering]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[efcentering-hdf5]=] "/root/repo/_ts_build/tests/bin/efcentering" "DB_HDF5")
+set_tests_properties([=[efcentering-hdf5]=] PROPERTIES  DEPENDS "efcentering" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[empty]=] "/root/repo/_ts_build/tests/bin/empty")
+set_tests_properties([=[empty]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[empty-hdf5]=] "/root/repo/_ts_build/tests/bin/empty" "DB_HDF5")
+set_tests_properties([=[empty-hdf5]=] PROPERTIES  DEPENDS "empty" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[extface]=] "/root/repo/_ts_build/tests/bin/extface")
+set_tests_properties([=[extface]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[extface-hdf5]=] "/root/repo/_ts_build/tests/bin/extface" "DB_HDF5")
+set_tests_properties([=[extface-hdf5]=] PROPERTIES  DEPENDS "extface" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[extface_threads]=] "/root/repo/_ts_build/tests/bin/extface_threads")
+set_tests_properties([=[extface_threads]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[extface_threads-hdf5]=] "/root/repo/_ts_build/tests/bin/extface_threads" "DB_HDF5")
+set_tests_properties([=[extface_threads-hdf5]=] PROPERTIES  DEPENDS "extface_threads" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[grab-hdf5]=] "/root/repo/_ts_build/tests/bin/grab" "DB_HDF5")
+set_tests_properties([=[grab-hdf5]=] PROPERTIES  LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[group_test]=] "/root/repo/_ts_build/tests/bin/group_test")
+set_tests_properties([=[group_test]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[group_test-hdf5]=] "/root/repo/_ts_build/tests/bin/group_test" "DB_HDF5")
+set_tests_properties([=[group_test-hdf5]=] PROPERTIES  DEPENDS "group_test" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[hashperf]=] "/root/repo/_ts_build/tests/bin/hashperf")
+set_tests_properties([=[hashperf]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;435;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[hyper_accruate_lineout_test]=] "/root/repo/_ts_build/tests/bin/hyper_accruate_lineout_test")
+set_tests_properties([=[hyper_accruate_lineout_test]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[hyper_accruate_lineout_test-hdf5]=] "/root/repo/_ts_build/tests/bin/hyper_accruate_lineout_test" "DB_HDF5")
+set_tests_properties([=[hyper_accruate_lineout_test-hdf5]=] PROPERTIES  DEPENDS "hyper_accruate_lineout_test" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[largefile-hdf5]=] "/root/repo/_ts_build/tests/bin/largefile" "DB_HDF5")
+set_tests_properties([=[largefile-hdf5]=] PROPERTIES  LABELS "hdf5" RESOURCE_LOCK "largefile.silo" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[listtypes]=] "/root/repo/_ts_build/tests/bin/listtypes")
+set_tests_properties([=[listtypes]=] PROPERTIES  DEPENDS "ucd" LABELS "pdb" REQUIRED_FILES "ucd.pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[listtypes-hdf5]=] "/root/repo/_ts_build/tests/bin/listtypes" "DB_HDF5")
+set_tests_properties([=[listtypes-hdf5]=] PROPERTIES  DEPENDS "ucd-hdf5" LABELS "hdf5" REQUIRED_FILES "ucd.h5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[majorder]=] "/root/repo/_ts_build/tests/bin/majorder")
+set_tests_properties([=[majorder]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[majorder-hdf5]=] "/root/repo/_ts_build/tests/bin/majorder" "DB_HDF5")
+set_tests_properties([=[majorder-hdf5]=] PROPERTIES  DEPENDS "majorder" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[mat3d_3across]=] "/root/repo/_ts_build/tests/bin/mat3d_3across")
+set_tests_properties([=[mat3d_3across]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[mat3d_3across-hdf5]=] "/root/repo/_ts_build/tests/bin/mat3d_3across" "DB_HDF5")
+set_tests_properties([=[mat3d_3across-hdf5]=] PROPERTIES  DEPENDS "mat3d_3across" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[memfile_simple-hdf5]=] "/root/repo/_ts_build/tests/bin/memfile_simple" "DB_HDF5")
+set_tests_properties([=[memfile_simple-hdf5]=] PROPERTIES  DEPENDS "testall-small-hdf5" LABELS "hdf5" REQUIRED_FILES "rect2d.h5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[misc]=] "/root/repo/_ts_build/tests/bin/misc")
+set_tests_properties([=[misc]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[misc-hdf5]=] "/root/repo/_ts_build/tests/bin/misc" "DB_HDF5")
+set_tests_properties([=[misc-hdf5]=] PROPERTIES  DEPENDS "misc" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[mk_nasf_h5-hdf5]=] "/root/repo/_ts_build/tests/bin/mk_nasf_h5" "DB_HDF5")
+set_tests_properties([=[mk_nasf_h5-hdf5]=] PROPERTIES  LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[mk_nasf_pdb]=] "/root/repo/_ts_build/tests/bin/mk_nasf_pdb")
+set_tests_properties([=[mk_nasf_pdb]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;435;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[mmadjacency]=] "/root/repo/_ts_build/tests/bin/mmadjacency")
+set_tests_properties([=[mmadjacency]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[mmadjacency-hdf5]=] "/root/repo/_ts_build/tests/bin/mmadjacency" "DB_HDF5")
+set_tests_properties([=[mmadjacency-hdf5]=] PROPERTIES  DEPENDS "mmadjacency" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file]=] "/root/repo/_ts_build/tests/bin/multi_file")
+set_tests_properties([=[multi_file]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_file_tests" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file-hdf5]=] "/root/repo/_ts_build/tests/bin/multi_file" "DB_HDF5")
+set_tests_properties([=[multi_file-hdf5]=] PROPERTIES  DEPENDS "multi_file" LABELS "multi" RESOURCE_LOCK "multi_file_tests" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_test]=] "/root/repo/_ts_build/tests/bin/multi_test")
+set_tests_properties([=[multi_test]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_test-hdf5]=] "/root/repo/_ts_build/tests/bin/multi_test" "DB_HDF5")
+set_tests_properties([=[multi_test-hdf5]=] PROPERTIES  DEPENDS "multi_test" LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_writer-hdf5]=] "/root/repo/_ts_build/tests/bin/multi_writer" "DB_HDF5")
+set_tests_properties([=[multi_writer-hdf5]=] PROPERTIES  LABELS "hdf5" RESOURCE_LOCK "multi_writer.silo" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multispec]=] "/root/repo/_ts_build/tests/bin/multispec")
+set_tests_properties([=[multispec]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multispec-hdf5]=] "/root/repo/_ts_build/tests/bin/multispec" "DB_HDF5")
+set_tests_properties([=[multispec-hdf5]=] PROPERTIES  DEPENDS "multispec" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[namescheme]=] "/root/repo/_ts_build/tests/bin/namescheme")
+set_tests_properties([=[namescheme]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[namescheme-hdf5]=] "/root/repo/_ts_build/tests/bin/namescheme" "DB_HDF5")
+set_tests_properties([=[namescheme-hdf5]=] PROPERTIES  DEPENDS "namescheme" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[obj]=] "/root/repo/_ts_build/tests/bin/obj")
+set_tests_properties([=[obj]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[obj-hdf5]=] "/root/repo/_ts_build/tests/bin/obj" "DB_HDF5")
+set_tests_properties([=[obj-hdf5]=] PROPERTIES  DEPENDS "obj" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[objcache]=] "/root/repo/_ts_build/tests/bin/objcache")
+set_tests_properties([=[objcache]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;435;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[onehex]=] "/root/repo/_ts_build/tests/bin/onehex")
+set_tests_properties([=[onehex]=] PROPERTIES  DEPENDS "testsilock" LABELS "hdf5" RESOURCE_LOCK "onehex.silo" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[onehex-hdf5]=] "/root/repo/_ts_build/tests/bin/onehex" "DB_HDF5")
+set_tests_properties([=[onehex-hdf5]=] PROPERTIES  DEPENDS "testsilock-hdf5" LABELS "hdf5" RESOURCE_LOCK "onehex.silo" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[oneprism]=] "/root/repo/_ts_build/tests/bin/oneprism")
+set_tests_properties([=[oneprism]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[oneprism-hdf5]=] "/root/repo/_ts_build/tests/bin/oneprism" "DB_HDF5")
+set_tests_properties([=[oneprism-hdf5]=] PROPERTIES  DEPENDS "oneprism" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[onepyramid]=] "/root/repo/_ts_build/tests/bin/onepyramid")
+set_tests_properties([=[onepyramid]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[onepyramid-hdf5]=] "/root/repo/_ts_build/tests/bin/onepyramid" "DB_HDF5")
+set_tests_properties([=[onepyramid-hdf5]=] PROPERTIES  DEPENDS "onepyramid" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[onetet]=] "/root/repo/_ts_build/tests/bin/onetet")
+set_tests_properties([=[onetet]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[onetet-hdf5]=] "/root/repo/_ts_build/tests/bin/onetet" "DB_HDF5")
+set_tests_properties([=[onetet-hdf5]=] PROPERTIES  DEPENDS "onetet" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[partial_io-hdf5]=] "/root/repo/_ts_build/tests/bin/partial_io" "DB_HDF5")
+set_tests_properties([=[partial_io-hdf5]=] PROPERTIES  LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[pdbio]=] "/root/repo/_ts_build/tests/bin/pdbio")
+set_tests_properties([=[pdbio]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;435;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[pdbtst]=] "/root/repo/_ts_build/tests/bin/pdbtst")
+set_tests_properties([=[pdbtst]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;435;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[point]=] "/root/repo/_ts_build/tests/bin/point")
+set_tests_properties([=[point]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[point-hdf5]=] "/root/repo/_ts_build/tests/bin/point" "DB_HDF5")
+set_tests_properties([=[point-hdf5]=] PROPERTIES  DEPENDS "point" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[polyzl]=] "/root/repo/_ts_build/tests/bin/polyzl")
+set_tests_properties([=[polyzl]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[polyzl-hdf5]=] "/root/repo/_ts_build/tests/bin/polyzl" "DB_HDF5")
+set_tests_properties([=[polyzl-hdf5]=] PROPERTIES  DEPENDS "polyzl" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[quad]=] "/root/repo/_ts_build/tests/bin/quad")
+set_tests_properties([=[quad]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[quad-hdf5]=] "/root/repo/_ts_build/tests/bin/quad" "DB_HDF5")
+set_tests_properties([=[quad-hdf5]=] PROPERTIES  DEPENDS "quad" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[readstuff-hdf5]=] "/root/repo/_ts_build/tests/bin/readstuff" "DB_HDF5")
+set_tests_properties([=[readstuff-hdf5]=] PROPERTIES  DEPENDS "multi_test-hdf5" LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[realloc_obj_and_opts]=] "/root/repo/_ts_build/tests/bin/realloc_obj_and_opts")
+set_tests_properties([=[realloc_obj_and_opts]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[realloc_obj_and_opts-hdf5]=] "/root/repo/_ts_build/tests/bin/realloc_obj_and_opts" "DB_HDF5")
+set_tests_properties([=[realloc_obj_and_opts-hdf5]=] PROPERTIES  DEPENDS "realloc_obj_and_opts" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[sami]=] "/root/repo/_ts_build/tests/bin/sami")
+set_tests_properties([=[sami]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[sami-hdf5]=] "/root/repo/_ts_build/tests/bin/sami" "DB_HDF5")
+set_tests_properties([=[sami-hdf5]=] PROPERTIES  DEPENDS "sami" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[simple]=] "/root/repo/_ts_build/tests/bin/simple")
+set_tests_properties([=[simple]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[simple-hdf5]=] "/root/repo/_ts_build/tests/bin/simple" "DB_HDF5")
+set_tests_properties([=[simple-hdf5]=] PROPERTIES  DEPENDS "simple" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[spec]=] "/root/repo/_ts_build/tests/bin/spec")
+set_tests_properties([=[spec]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[spec-hdf5]=] "/root/repo/_ts_build/tests/bin/spec" "DB_HDF5")
+set_tests_properties([=[spec-hdf5]=] PROPERTIES  DEPENDS "spec" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[specmix]=] "/root/repo/_ts_build/tests/bin/specmix")
+set_tests_properties([=[specmix]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[specmix-hdf5]=] "/root/repo/_ts_build/tests/bin/specmix" "DB_HDF5")
+set_tests_properties([=[specmix-hdf5]=] PROPERTIES  DEPENDS "specmix" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[subhex]=] "/root/repo/_ts_build/tests/bin/subhex")
+set_tests_properties([=[subhex]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[subhex-hdf5]=] "/root/repo/_ts_build/tests/bin/subhex" "DB_HDF5")
+set_tests_properties([=[subhex-hdf5]=] PROPERTIES  DEPENDS "subhex" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testall]=] "/root/repo/_ts_build/tests/bin/testall")
+set_tests_properties([=[testall]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testall-hdf5]=] "/root/repo/_ts_build/tests/bin/testall" "DB_HDF5")
+set_tests_properties([=[testall-hdf5]=] PROPERTIES  DEPENDS "testall" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testfs]=] "/root/repo/_ts_build/tests/bin/testfs")
+set_tests_properties([=[testfs]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testfs-hdf5]=] "/root/repo/_ts_build/tests/bin/testfs" "DB_HDF5")
+set_tests_properties([=[testfs-hdf5]=] PROPERTIES  DEPENDS "testfs" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testhdf5-hdf5]=] "/root/repo/_ts_build/tests/bin/testhdf5" "DB_HDF5")
+set_tests_properties([=[testhdf5-hdf5]=] PROPERTIES  LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testpdb]=] "/root/repo/_ts_build/tests/bin/testpdb")
+set_tests_properties([=[testpdb]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;435;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[threaded_read]=] "/root/repo/_ts_build/tests/bin/threaded_read")
+set_tests_properties([=[threaded_read]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[threaded_read-hdf5]=] "/root/repo/_ts_build/tests/bin/threaded_read" "DB_HDF5")
+set_tests_properties([=[threaded_read-hdf5]=] PROPERTIES  DEPENDS "threaded_read" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[toc_index-hdf5]=] "/root/repo/_ts_build/tests/bin/toc_index" "DB_HDF5")
+set_tests_properties([=[toc_index-hdf5]=] PROPERTIES  LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;428;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[twohex]=] "/root/repo/_ts_build/tests/bin/twohex")
+set_tests_properties([=[twohex]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[twohex-hdf5]=] "/root/repo/_ts_build/tests/bin/twohex" "DB_HDF5")
+set_tests_properties([=[twohex-hdf5]=] PROPERTIES  DEPENDS "twohex" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[ucd]=] "/root/repo/_ts_build/tests/bin/ucd")
+set_tests_properties([=[ucd]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[ucd-hdf5]=] "/root/repo/_ts_build/tests/bin/ucd" "DB_HDF5")
+set_tests_properties([=[ucd-hdf5]=] PROPERTIES  DEPENDS "ucd" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[ucd1d]=] "/root/repo/_ts_build/tests/bin/ucd1d")
+set_tests_properties([=[ucd1d]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[ucd1d-hdf5]=] "/root/repo/_ts_build/tests/bin/ucd1d" "DB_HDF5")
+set_tests_properties([=[ucd1d-hdf5]=] PROPERTIES  DEPENDS "ucd1d" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[ucdsamp3]=] "/root/repo/_ts_build/tests/bin/ucdsamp3")
+set_tests_properties([=[ucdsamp3]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[ucdsamp3-hdf5]=] "/root/repo/_ts_build/tests/bin/ucdsamp3" "DB_HDF5")
+set_tests_properties([=[ucdsamp3-hdf5]=] PROPERTIES  DEPENDS "ucdsamp3" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[wave]=] "/root/repo/_ts_build/tests/bin/wave")
+set_tests_properties([=[wave]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[wave-hdf5]=] "/root/repo/_ts_build/tests/bin/wave" "DB_HDF5")
+set_tests_properties([=[wave-hdf5]=] PROPERTIES  DEPENDS "wave" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[newsami]=] "/root/repo/_ts_build/tests/bin/newsami")
+set_tests_properties([=[newsami]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[newsami-hdf5]=] "/root/repo/_ts_build/tests/bin/newsami" "DB_HDF5")
+set_tests_properties([=[newsami-hdf5]=] PROPERTIES  DEPENDS "newsami" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[rocket]=] "/root/repo/_ts_build/tests/bin/rocket")
+set_tests_properties([=[rocket]=] PROPERTIES  LABELS "pdb" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;442;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[rocket-hdf5]=] "/root/repo/_ts_build/tests/bin/rocket" "DB_HDF5")
+set_tests_properties([=[rocket-hdf5]=] PROPERTIES  DEPENDS "rocket" LABELS "hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;457;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[convperf-tail]=] "/root/repo/_ts_build/tests/bin/convperf" "n=1001")
+set_tests_properties([=[convperf-tail]=] PROPERTIES  LABELS "pdb" RESOURCE_LOCK "convperf.pdb" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;510;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[largefile-silo-vfd]=] "/root/repo/_ts_build/tests/bin/largefile" "-niters" "200" "-iostats" "DB_HDF5_OPTS(DBOPT_H5_VFD=DB_H5VFD_SILO,DBOPT_H5_SILO_BLOCK_COUNT=8)")
+set_tests_properties([=[largefile-silo-vfd]=] PROPERTIES  LABELS "hdf5" RESOURCE_LOCK "largefile.silo" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;521;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[largefile-silo-vfd-async]=] "/root/repo/_ts_build/tests/bin/largefile" "-niters" "200" "-iostats" "DB_HDF5_OPTS(DBOPT_H5_VFD=DB_H5VFD_SILO,DBOPT_H5_SILO_BLOCK_COUNT=8,DBOPT_H5_SILO_ASYNC_FLUSH=1)")
+set_tests_properties([=[largefile-silo-vfd-async]=] PROPERTIES  LABELS "hdf5" RESOURCE_LOCK "largefile.silo" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;523;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[largefile-silo-vfd-direct]=] "/root/repo/_ts_build/tests/bin/largefile" "-niters" "200" "-iostats" "DB_HDF5_OPTS(DBOPT_H5_VFD=DB_H5VFD_SILO,DBOPT_H5_SILO_BLOCK_COUNT=8,DBOPT_H5_SILO_USE_DIRECT=1)")
+set_tests_properties([=[largefile-silo-vfd-direct]=] PROPERTIES  LABELS "hdf5" RESOURCE_LOCK "largefile.silo" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;525;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[largefile-silo-vfd-meta-at-end]=] "/root/repo/_ts_build/tests/bin/largefile" "-niters" "200" "-iostats" "DB_HDF5_OPTS(DBOPT_H5_VFD=DB_H5VFD_SILO,DBOPT_H5_SILO_BLOCK_COUNT=8,DBOPT_H5_SILO_META_AT_END=1)")
+set_tests_properties([=[largefile-silo-vfd-meta-at-end]=] PROPERTIES  LABELS "hdf5" RESOURCE_LOCK "largefile.silo" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;527;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[largefile-silo-vfd-shared-cache]=] "/root/repo/_ts_build/tests/bin/largefile" "-niters" "200" "-iostats" "DB_HDF5_OPTS(DBOPT_H5_VFD=DB_H5VFD_SILO,DBOPT_H5_SILO_CACHE_MBYTES=1,DBOPT_H5_SILO_SHARED_CACHE=1)")
+set_tests_properties([=[largefile-silo-vfd-shared-cache]=] PROPERTIES  LABELS "hdf5" RESOURCE_LOCK "largefile.silo" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;529;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_writer-threads]=] "/root/repo/_ts_build/tests/bin/multi_writer" "DB_HDF5" "threads")
+set_tests_properties([=[multi_writer-threads]=] PROPERTIES  LABELS "hdf5" RESOURCE_LOCK "multi_writer.silo" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;534;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[onehex-split]=] "/root/repo/_ts_build/tests/bin/onehex" "split")
+set_tests_properties([=[onehex-split]=] PROPERTIES  LABELS "hdf5" RESOURCE_LOCK "onehex.silo" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;548;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[onehex-custom]=] "/root/repo/_ts_build/tests/bin/onehex" "custom")
+set_tests_properties([=[onehex-custom]=] PROPERTIES  LABELS "hdf5" RESOURCE_LOCK "onehex.silo" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;549;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-gzip]=] "/root/repo/_ts_build/tests/bin/compression" "gzip")
+set_tests_properties([=[compression-gzip]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;555;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-gzip-read]=] "/root/repo/_ts_build/tests/bin/compression" "readonly")
+set_tests_properties([=[compression-gzip-read]=] PROPERTIES  DEPENDS "compression-gzip" LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;556;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-gzip-mt]=] "/root/repo/_ts_build/tests/bin/compression" "gzip" "threads=4")
+set_tests_properties([=[compression-gzip-mt]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;560;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-gzip-mt-read]=] "/root/repo/_ts_build/tests/bin/compression" "readonly")
+set_tests_properties([=[compression-gzip-mt-read]=] PROPERTIES  DEPENDS "compression-gzip-mt" LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;561;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-gzip-mtcompare]=] "/root/repo/_ts_build/tests/bin/compression" "gzip" "mtcompare" "threads=4")
+set_tests_properties([=[compression-gzip-mtcompare]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;563;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-optlist]=] "/root/repo/_ts_build/tests/bin/compression" "optlist")
+set_tests_properties([=[compression-optlist]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;566;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-auto]=] "/root/repo/_ts_build/tests/bin/compression" "auto")
+set_tests_properties([=[compression-auto]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;569;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-auto-read]=] "/root/repo/_ts_build/tests/bin/compression" "readonly")
+set_tests_properties([=[compression-auto-read]=] PROPERTIES  DEPENDS "compression-auto" LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;570;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-autospeed]=] "/root/repo/_ts_build/tests/bin/compression" "autospeed")
+set_tests_properties([=[compression-autospeed]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;572;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-zfp]=] "/root/repo/_ts_build/tests/bin/compression" "zfp")
+set_tests_properties([=[compression-zfp]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;597;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-zfp-read]=] "/root/repo/_ts_build/tests/bin/compression" "zfp" "readonly")
+set_tests_properties([=[compression-zfp-read]=] PROPERTIES  DEPENDS "compression-zfp" LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;598;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-zfp-mt]=] "/root/repo/_ts_build/tests/bin/compression" "zfp" "threads=4")
+set_tests_properties([=[compression-zfp-mt]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;602;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-zfp-mt-read]=] "/root/repo/_ts_build/tests/bin/compression" "zfp" "readonly")
+set_tests_properties([=[compression-zfp-mt-read]=] PROPERTIES  DEPENDS "compression-zfp-mt" LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;603;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-zfp-mtcompare]=] "/root/repo/_ts_build/tests/bin/compression" "zfp" "mtcompare" "threads=4")
+set_tests_properties([=[compression-zfp-mtcompare]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;605;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[compression-zfp-exec]=] "/root/repo/_ts_build/tests/bin/compression" "zfpexec" "threads=4")
+set_tests_properties([=[compression-zfp-exec]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "compression.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;608;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[chunked_slice-zfp]=] "/root/repo/_ts_build/tests/bin/chunked_slice" "DB_HDF5" "zfp")
+set_tests_properties([=[chunked_slice-zfp]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "chunked_slice.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;612;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[chunked_slice-zfprate]=] "/root/repo/_ts_build/tests/bin/chunked_slice" "DB_HDF5" "zfprate")
+set_tests_properties([=[chunked_slice-zfprate]=] PROPERTIES  LABELS "compression" RESOURCE_LOCK "chunked_slice.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;613;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testall-small]=] "/root/repo/_ts_build/tests/bin/testall" "-small")
+set_tests_properties([=[testall-small]=] PROPERTIES  DEPENDS "testall" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;626;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testall-small-hdf5]=] "/root/repo/_ts_build/tests/bin/testall" "-small" "DB_HDF5")
+set_tests_properties([=[testall-small-hdf5]=] PROPERTIES  DEPENDS "testall-hdf5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;632;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_test-read]=] "/root/repo/_ts_build/tests/bin/multi_test" "testread")
+set_tests_properties([=[multi_test-read]=] PROPERTIES  DEPENDS "multi_test" LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;647;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_test-badread]=] "/root/repo/_ts_build/tests/bin/multi_test" "testbadread")
+set_tests_properties([=[multi_test-badread]=] PROPERTIES  DEPENDS "multi_test" LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;649;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_test-earlyclose]=] "/root/repo/_ts_build/tests/bin/multi_test" "earlyclose")
+set_tests_properties([=[multi_test-earlyclose]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;651;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_test-read-hdf5]=] "/root/repo/_ts_build/tests/bin/multi_test" "testread" "DB_HDF5")
+set_tests_properties([=[multi_test-read-hdf5]=] PROPERTIES  DEPENDS "multi_test-hdf5" LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;655;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_test-badread-hdf5]=] "/root/repo/_ts_build/tests/bin/multi_test" "testbadread" "DB_HDF5")
+set_tests_properties([=[multi_test-badread-hdf5]=] PROPERTIES  DEPENDS "multi_test-hdf5" LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;657;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_test-earlyclose-hdf5]=] "/root/repo/_ts_build/tests/bin/multi_test" "earlyclose" "DB_HDF5")
+set_tests_properties([=[multi_test-earlyclose-hdf5]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;659;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_test-flush]=] "/root/repo/_ts_build/tests/bin/multi_test" "testflush" "DB_HDF5")
+set_tests_properties([=[multi_test-flush]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;660;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_test-libver]=] "/root/repo/_ts_build/tests/bin/multi_test" "libver" "DB_HDF5")
+set_tests_properties([=[multi_test-libver]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;661;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_test-libver-read]=] "/root/repo/_ts_build/tests/bin/multi_test" "testread" "DB_HDF5")
+set_tests_properties([=[multi_test-libver-read]=] PROPERTIES  DEPENDS "multi_test-libver" LABELS "multi" RESOURCE_LOCK "multi_curv2d.pdb;multi_curv3d.pdb;multi_point2d.pdb;multi_rect2d.pdb;multi_rect3d.pdb;multi_ucd3d.pdb;
+         multi_curv2d.h5;multi_curv3d.h5;multi_point2d.h5;multi_rect2d.h5;multi_rect3d.h5;multi_ucd3d.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;662;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file-usens]=] "/root/repo/_ts_build/tests/bin/multi_file" "use-ns")
+set_tests_properties([=[multi_file-usens]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_file_tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;698;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file-evalns]=] "/root/repo/_ts_build/tests/bin/multi_file" "eval-ns")
+set_tests_properties([=[multi_file-evalns]=] PROPERTIES  DEPENDS "multi_file-usens" LABELS "multi" RESOURCE_LOCK "multi_file_tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;699;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file-usens-empties]=] "/root/repo/_ts_build/tests/bin/multi_file" "use-ns" "empties")
+set_tests_properties([=[multi_file-usens-empties]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_file_tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;701;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file-multidir]=] "/root/repo/_ts_build/tests/bin/multi_file" "multidir")
+set_tests_properties([=[multi_file-multidir]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_file_tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;702;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file-multidir-usens]=] "/root/repo/_ts_build/tests/bin/multi_file" "multidir" "use-ns")
+set_tests_properties([=[multi_file-multidir-usens]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_file_tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;703;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file-usens-hdf5]=] "/root/repo/_ts_build/tests/bin/multi_file" "use-ns" "DB_HDF5")
+set_tests_properties([=[multi_file-usens-hdf5]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_file_tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;706;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file-evalns-hdf5]=] "/root/repo/_ts_build/tests/bin/multi_file" "eval-ns" "DB_HDF5")
+set_tests_properties([=[multi_file-evalns-hdf5]=] PROPERTIES  DEPENDS "multi_file-usens-hdf5" LABELS "multi" RESOURCE_LOCK "multi_file_tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;707;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file-usens-empties-hdf5]=] "/root/repo/_ts_build/tests/bin/multi_file" "use-ns" "empties" "DB_HDF5")
+set_tests_properties([=[multi_file-usens-empties-hdf5]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_file_tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;709;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file-multidir-hdf5]=] "/root/repo/_ts_build/tests/bin/multi_file" "multidir" "DB_HDF5")
+set_tests_properties([=[multi_file-multidir-hdf5]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_file_tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;710;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[multi_file-multidir-usens-hdf5]=] "/root/repo/_ts_build/tests/bin/multi_file" "multidir" "use-ns" "DB_HDF5")
+set_tests_properties([=[multi_file-multidir-usens-hdf5]=] PROPERTIES  LABELS "multi" RESOURCE_LOCK "multi_file_tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;711;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[partial-io-setup]=] "/root/repo/_ts_build/tests/bin/testall" "DB_HDF5")
+set_tests_properties([=[partial-io-setup]=] PROPERTIES  DEPENDS "testall-hdf5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;722;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[partial-io-rect3d]=] "/root/repo/_ts_build/tests/bin/partial_io" "DB_HDF5" "point-query" "rect3d.h5" "d" "10" "[0,0,0,1,1,1,2,2,2,3,3,3,4,4,4,5,5,5,6,6,6,7,7,7,8,8,8,9,9,9]")
+set_tests_properties([=[partial-io-rect3d]=] PROPERTIES  DEPENDS "partial-io-setup" RESOURCE_LOCK "partial.h5;rect3d.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;724;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[partial-io-ucd3d]=] "/root/repo/_ts_build/tests/bin/partial_io" "DB_HDF5" "point-query" "ucd3d.h5" "d" "5" "[0,26,234,1482,2574]")
+set_tests_properties([=[partial-io-ucd3d]=] PROPERTIES  DEPENDS "partial-io-setup" RESOURCE_LOCK "partial.h5;ucd3d.h5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;726;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testdtypes]=] "/usr/bin/cmake" "-E" "env" "ASAN_OPTIONS=detect_leaks=0" "/root/repo/_ts_build/tests/bin/testdtypes")
+set_tests_properties([=[testdtypes]=] PROPERTIES  DEPENDS "specmix-hdf5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;735;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testdtypes-hdf5]=] "/usr/bin/cmake" "-E" "env" "ASAN_OPTIONS=detect_leaks=0" "/root/repo/_ts_build/tests/bin/testdtypes" "DB_HDF5")
+set_tests_properties([=[testdtypes-hdf5]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;740;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testsilock]=] "/usr/bin/cmake" "-E" "env" "/root/repo/_ts_build/tests/bin/testsilock")
+set_tests_properties([=[testsilock]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;752;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[testsilock-hdf5]=] "/usr/bin/cmake" "-E" "env" "/root/repo/_ts_build/tests/bin/testsilock" "DB_HDF5")
+set_tests_properties([=[testsilock-hdf5]=] PROPERTIES  DEPENDS "testsilock" RESOURCE_LOCK "onehex.silo" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;757;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[checksums]=] "/usr/bin/cmake" "-E" "env" "PATH=:/root/.rbenv/bin:/root/.rbenv/shims:/root/.dotnet:/usr/local/go/bin:/root/go/bin:/root/.pyenv/bin:/root/.pyenv/shims:/root/.cargo/bin:/root/miniconda/bin:/usr/local/sbin:/usr/local/bin:/usr/sbin:/usr/bin:/sbin:/bin" "ASAN_OPTIONS=detect_leaks=0" "/root/repo/_ts_build/tests/bin/checksums")
+set_tests_properties([=[checksums]=] PROPERTIES  DEPENDS "multi_test-hdf5" SKIP_RETURN_CODE "17" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;771;add_test;/root/repo/tests/CMakeLists.txt;0;")
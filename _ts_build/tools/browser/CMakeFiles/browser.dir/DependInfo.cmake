@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/browser/array.c" "tools/browser/CMakeFiles/browser.dir/array.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/array.c.o.d"
+  "/root/repo/tools/browser/bif.c" "tools/browser/CMakeFiles/browser.dir/bif.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/bif.c.o.d"
+  "/root/repo/tools/browser/browser.c" "tools/browser/CMakeFiles/browser.dir/browser.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/browser.c.o.d"
+  "/root/repo/tools/browser/cons.c" "tools/browser/CMakeFiles/browser.dir/cons.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/cons.c.o.d"
+  "/root/repo/tools/browser/file.c" "tools/browser/CMakeFiles/browser.dir/file.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/file.c.o.d"
+  "/root/repo/tools/browser/func.c" "tools/browser/CMakeFiles/browser.dir/func.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/func.c.o.d"
+  "/root/repo/tools/browser/lex.c" "tools/browser/CMakeFiles/browser.dir/lex.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/lex.c.o.d"
+  "/root/repo/tools/browser/num.c" "tools/browser/CMakeFiles/browser.dir/num.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/num.c.o.d"
+  "/root/repo/tools/browser/obj.c" "tools/browser/CMakeFiles/browser.dir/obj.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/obj.c.o.d"
+  "/root/repo/tools/browser/output.c" "tools/browser/CMakeFiles/browser.dir/output.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/output.c.o.d"
+  "/root/repo/tools/browser/parse.c" "tools/browser/CMakeFiles/browser.dir/parse.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/parse.c.o.d"
+  "/root/repo/tools/browser/prim.c" "tools/browser/CMakeFiles/browser.dir/prim.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/prim.c.o.d"
+  "/root/repo/tools/browser/ptr.c" "tools/browser/CMakeFiles/browser.dir/ptr.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/ptr.c.o.d"
+  "/root/repo/tools/browser/range.c" "tools/browser/CMakeFiles/browser.dir/range.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/range.c.o.d"
+  "/root/repo/tools/browser/sdo.c" "tools/browser/CMakeFiles/browser.dir/sdo.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/sdo.c.o.d"
+  "/root/repo/tools/browser/stc.c" "tools/browser/CMakeFiles/browser.dir/stc.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/stc.c.o.d"
+  "/root/repo/tools/browser/str.c" "tools/browser/CMakeFiles/browser.dir/str.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/str.c.o.d"
+  "/root/repo/tools/browser/switch.c" "tools/browser/CMakeFiles/browser.dir/switch.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/switch.c.o.d"
+  "/root/repo/tools/browser/sym.c" "tools/browser/CMakeFiles/browser.dir/sym.c.o" "gcc" "tools/browser/CMakeFiles/browser.dir/sym.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "../../bin/browser"
+  "../../bin/browser.pdb"
+  "CMakeFiles/browser.dir/array.c.o"
+  "CMakeFiles/browser.dir/array.c.o.d"
+  "CMakeFiles/browser.dir/bif.c.o"
+  "CMakeFiles/browser.dir/bif.c.o.d"
+  "CMakeFiles/browser.dir/browser.c.o"
+  "CMakeFiles/browser.dir/browser.c.o.d"
+  "CMakeFiles/browser.dir/cons.c.o"
+  "CMakeFiles/browser.dir/cons.c.o.d"
+  "CMakeFiles/browser.dir/file.c.o"
+  "CMakeFiles/browser.dir/file.c.o.d"
+  "CMakeFiles/browser.dir/func.c.o"
+  "CMakeFiles/browser.dir/func.c.o.d"
+  "CMakeFiles/browser.dir/lex.c.o"
+  "CMakeFiles/browser.dir/lex.c.o.d"
+  "CMakeFiles/browser.dir/num.c.o"
+  "CMakeFiles/browser.dir/num.c.o.d"
+  "CMakeFiles/browser.dir/obj.c.o"
+  "CMakeFiles/browser.dir/obj.c.o.d"
+  "CMakeFiles/browser.dir/output.c.o"
+  "CMakeFiles/browser.dir/output.c.o.d"
+  "CMakeFiles/browser.dir/parse.c.o"
+  "CMakeFiles/browser.dir/parse.c.o.d"
+  "CMakeFiles/browser.dir/prim.c.o"
+  "CMakeFiles/browser.dir/prim.c.o.d"
+  "CMakeFiles/browser.dir/ptr.c.o"
+  "CMakeFiles/browser.dir/ptr.c.o.d"
+  "CMakeFiles/browser.dir/range.c.o"
+  "CMakeFiles/browser.dir/range.c.o.d"
+  "CMakeFiles/browser.dir/sdo.c.o"
+  "CMakeFiles/browser.dir/sdo.c.o.d"
+  "CMakeFiles/browser.dir/stc.c.o"
+  "CMakeFiles/browser.dir/stc.c.o.d"
+  "CMakeFiles/browser.dir/str.c.o"
+  "CMakeFiles/browser.dir/str.c.o.d"
+  "CMakeFiles/browser.dir/switch.c.o"
+  "CMakeFiles/browser.dir/switch.c.o.d"
+  "CMakeFiles/browser.dir/sym.c.o"
+  "CMakeFiles/browser.dir/sym.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/browser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -56,6 +56,12 @@ product endorsement purposes.
    is explicitly upgraded to the 1.8 API, this symbol should be removed. */
 #define H5_USE_16_API
 
+/* The _GNU_SOURCE wrapper logic is to enable the O_DIRECT flag. It must
+   come before any system header, including those hdf5.h pulls in. */
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
 #include <config.h>
 #if defined(HAVE_HDF5_H) && defined(HAVE_LIBHDF5)
 
@@ -66,14 +72,10 @@ product endorsement purposes.
 
 #if HDF5_VERSION_GE(1,8,4)
 
-/* The _GNU_SOURCE wrapper logic is to enable the O_DIRECT flag */
-#ifdef __linux__
-#define _GNU_SOURCE
-#endif
-
 #include <assert.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <stdio.h> /* for snprintf */
 #include <stdlib.h>
 #include <string.h>
@@ -82,6 +84,26 @@ product endorsement purposes.
 #ifndef _WIN32
 #include <unistd.h>
 #endif
+#if defined(HAVE_PREADV) || defined(HAVE_PWRITEV)
+#include <sys/uio.h>
+#endif
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+#if defined(HAVE_PTHREAD) && defined(HAVE_PREADV) && defined(HAVE_PWRITEV)
+#define SILO_VFD_ASYNC_FLUSH
+#endif
+
+#if defined(O_DIRECT) && defined(HAVE_POSIX_MEMALIGN) && defined(HAVE_PREADV) && defined(HAVE_PWRITEV)
+#define SILO_VFD_DIRECT
+#endif
+
+#if defined(HAVE_PREADV) && defined(HAVE_PWRITEV) && defined(F_SETLKW)
+#define SILO_VFD_MULTI_WRITER
+#endif
 
 #ifdef __linux__
 #undef _GNU_SOURCE
@@ -91,11 +113,11 @@ product endorsement purposes.
    TO DO:
 
      *1. Examine file block alignment with HDF5 lib metadata allocations
-      2. On systems that support O_DIRECT, try posix_madvise/posix_memalign
-      3. Support partial last block
-      4. Aggregate multiple blocks
+     *2. On systems that support O_DIRECT, try posix_madvise/posix_memalign
+     *3. Support partial last block
+     *4. Aggregate multiple blocks
      *5. allow an 'auto' block count or 'max-N'
-      6. If 5, add DBFreeSomeSiloVFDBlocks
+     *6. If 5, add DBFreeSomeSiloVFDBlocks
       7. Compare with sec2 VFD, PDB
      *8. Pre-empt raw data blocks over meta data blocks
       9. Move mdc_config from silo_hdf5.c to this file
@@ -104,11 +126,11 @@ product endorsement purposes.
     *12. Sanity check block size on read relative to write.
      13. Get performance studies on other systems
      14. Study read performance too.
-     15. Move to DICHOTOMY and write all meta blocks at end of file.
-     16. Write blocks from different MPI tasks to same file. On read
+    *15. Move to DICHOTOMY and write all meta blocks at end of file.
+    *16. Write blocks from different MPI tasks to same file. On read
          back, need to specify which 'task' but should otherwise work.
-     17. Use direct I/O where possible (and appropriate).
-     18. Capture I/O statistics here.
+    *17. Use direct I/O where possible (and appropriate).
+    *18. Capture I/O statistics here.
      19. Set mdc_config to never preempt (chews up memory in lib),
          all writes for md will come on close.
      20. Use COMPACT storage mode in driver for small datasets.
@@ -138,6 +160,10 @@ product endorsement purposes.
 #undef MAX
 #endif
 #define MAX(X,Y)	((X)>(Y)?(X):(Y))
+#ifdef MIN
+#undef MIN
+#endif
+#define MIN(X,Y)	((X)<(Y)?(X):(Y))
 
 /* File operations */
 #define OP_UNKNOWN      0
@@ -147,10 +173,23 @@ product endorsement purposes.
 #define EXACT		0
 #define CLOSEST		1
 
+/* Max. number of blocks moved in one vectored read or write */
+#ifdef IOV_MAX
+#define MAX_BLOCKS_PER_IO IOV_MAX
+#else
+#define MAX_BLOCKS_PER_IO 1024
+#endif
+
 #define SILO_BLKSZ_PROPNAME "silo_block_size"
 #define SILO_BLKCNT_PROPNAME "silo_block_count"
 #define SILO_LOGSTS_PROPNAME "silo_log_stats"
 #define SILO_USEDIR_PROPNAME "silo_use_direct"
+#define SILO_ASYNC_PROPNAME "silo_async_flush"
+#define SILO_METEND_PROPNAME "silo_meta_at_end"
+#define SILO_CBYTES_PROPNAME "silo_cache_bytes"
+#define SILO_SHARED_PROPNAME "silo_shared_cache"
+#define SILO_NWRITERS_PROPNAME "silo_nwriters"
+#define SILO_WRITER_PROPNAME "silo_writer"
 
 /* definitions related to the file stat utilities.
  * For Unix, if off_t is not 64bit big, try use the pseudo-standard
@@ -280,6 +319,27 @@ typedef struct silo_vfd_stats_t_
     hsize_t num_multiblock_writes;
     hsize_t num_multiblock_reads;
 
+    hsize_t num_coalesced_writes;
+    hsize_t num_coalesced_write_blocks;
+    hsize_t num_coalesced_reads;
+    hsize_t num_coalesced_read_blocks;
+
+    hsize_t num_async_writes;
+    hsize_t num_async_write_blocks;
+    hsize_t num_async_waits;
+
+    hsize_t num_direct_io;
+    hsize_t num_unaligned_io;
+
+    hsize_t num_block_hits;
+    hsize_t num_block_misses;
+    hsize_t num_block_evictions;
+    hsize_t num_prefetched_blocks;
+    hsize_t num_prefetch_hits;
+    hsize_t num_prefetch_wasted;
+    hsize_t num_ghost_hits;
+    hsize_t num_readahead_hints;
+
     hsize_t num_blocks_majority_md;
     hsize_t num_blocks_majority_raw;
 
@@ -300,6 +360,7 @@ typedef struct silo_vfd_stats_t_
     hsize_t total_block_reads;
     hsize_t total_block_re_reads;
     double total_time_in_reads;
+    double total_time_in_writes;
 
     int num_hot_blocks;
     int max_hot_blocks;
@@ -351,28 +412,104 @@ typedef struct silo_vfd_block_t_
     hsize_t age;
     void *buf;
     unsigned dirty;
+    unsigned prefetched;     /* read ahead and not yet used; 1 + index of read ahead stream */
+    unsigned frequent;       /* in the 2Q Am queue; otherwise A1in */
     hsize_t minmoff, maxmoff;
     hsize_t minroff, maxroff;
 } silo_vfd_block_t;
 
-typedef struct silo_vfd_pair_t_ 
+/* Read miss pattern for one stream of reads */
+typedef struct silo_vfd_read_ahead_t_
 {
-    int i;
-    hsize_t id;
-} silo_vfd_pair_t;
-
-static int compare_silo_vfd_pairs(const void *a, const void *b)
+    hsize_t next;       /* block id a sequential reader misses on next */
+    hsize_t last;       /* block id of the last read miss */
+    hsize_t stride;     /* distance between the last two misses, if strided */
+    hsize_t age;        /* op_counter at last miss, for replacement */
+    int     window;     /* blocks to read ahead; 0 if no pattern */
+} silo_vfd_read_ahead_t;
+
+/* In meta_at_end mode, raw data (and global heap) addresses start at
+   META_AT_END_RAW_BASE, well clear of any metadata address, and map onto
+   the file from raw_offset on. Metadata addresses map onto meta_buf. At
+   close, the metadata goes after the raw data, followed by a footer that
+   locates it. The head of the metadata, holding the superblock, is also
+   written at the start of the file so HDF5 tools recognize it. */
+#define META_AT_END_RAW_BASE    (((haddr_t)MAXADDR >> 2) + 1)
+#define META_AT_END_HEAD_SIZE   4096
+#define META_AT_END_FOOTER_SIZE 64
+#define META_AT_END_MAGIC       "LLNLsilM"
+#define META_AT_END_VERSION     1
+#define IS_RAW_TYPE(T)          ((T) == H5FD_MEM_DRAW || (T) == H5FD_MEM_GHEAP)
+
+/* In multi-writer mode, several independent HDF5 files share one physical
+   file. It is divided into segments of MW_SEGMENT_BLOCKS blocks and each
+   writer claims segments, one after another, as its file grows. The
+   header, in the leading segments, holds MW_HDR_WORDS words (magic,
+   version, segment size, number of writers and the next free segment)
+   followed by MW_SLOT_WORDS words per writer (segment of its index,
+   segments in its index and its file size). The index of a writer lists
+   the physical segment of each of its file's logical segments. Writers
+   claim segments under a lock on the magic word. */
+#define MW_SEGMENT_BLOCKS       16
+#define MW_MAGIC                "LLNLsilW"
+#define MW_VERSION              1
+#define MW_HDR_WORDS            5
+#define MW_SLOT_WORDS           3
+
+/* Max. number of interleaved read streams tracked for read ahead */
+#define MAX_READ_AHEAD_STREAMS 4
+
+/* A run of evicted dirty blocks waiting for the background flush thread.
+   The job owns the block buffers and frees them once written. */
+typedef struct silo_vfd_flush_job_t_
 {
-    silo_vfd_pair_t *paira = (silo_vfd_pair_t*)a;
-    silo_vfd_pair_t *pairb = (silo_vfd_pair_t*)b;
-    if (paira->id < pairb->id) return -1;
-    if (paira->id > pairb->id) return 1;
-    return 0;
-}
+    struct silo_vfd_flush_job_t_ *next;
+    hsize_t  id;
+    int      n;
+    void   **bufs;
+    hsize_t *sizes;
+} silo_vfd_flush_job_t;
 
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_SILO_g = 0;
 
+/* Files opened with a shared cache hold their blocks within one process
+   wide budget. Making room for one file evicts, and may write, blocks of
+   another, so reads, writes and closes of member files, and changes to the
+   pool, are serialized by the pool lock. Lock order is open files list,
+   then pool, then a file's flush mutex. */
+typedef struct silo_vfd_pool_t_
+{
+    hsize_t budget;                 /* bytes all member files may hold in blocks */
+    struct H5FD_silo_t *files;      /* member files, linked through pool_next */
+} silo_vfd_pool_t;
+
+static silo_vfd_pool_t silo_vfd_pool;
+
+/* All files open with this driver, linked through open_next, so that
+   H5Fget_silo_io_stats can find a file from its handle */
+static struct H5FD_silo_t *silo_vfd_open_files;
+#ifdef HAVE_PTHREAD
+static pthread_mutex_t silo_vfd_open_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define OPEN_FILES_LOCK()   pthread_mutex_lock(&silo_vfd_open_mutex)
+#define OPEN_FILES_UNLOCK() pthread_mutex_unlock(&silo_vfd_open_mutex)
+#else
+#define OPEN_FILES_LOCK()
+#define OPEN_FILES_UNLOCK()
+#endif
+
+#ifdef HAVE_PTHREAD
+static pthread_mutex_t silo_vfd_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define POOL_LOCK()   pthread_mutex_lock(&silo_vfd_pool_mutex)
+#define POOL_UNLOCK() pthread_mutex_unlock(&silo_vfd_pool_mutex)
+#else
+#define POOL_LOCK()
+#define POOL_UNLOCK()
+#endif
+
+/* Ids in the ghost ring not (or no longer) naming an evicted block */
+#define GHOST_EMPTY ((hsize_t)-1)
+
 /*
  * The description of a file belonging to this driver. The `eoa' and `eof'
  * determine the amount of hdf5 address space in use and the high-water mark
@@ -397,11 +534,48 @@ typedef struct H5FD_silo_t {
     hsize_t     block_size;
     hsize_t     op_counter;
     silo_vfd_block_t *block_list;
-    int         max_blocks;
+    int         max_blocks;         /* blocks the cache budget allows */
     int         num_blocks;
+    int         list_size;          /* entries allocated in block_list */
+    int         two_q;              /* 2Q replacement; otherwise LRU */
+    int         num_frequent;       /* blocks in the 2Q Am queue */
+    hsize_t    *ghost;              /* ring of ids recently evicted from A1in */
+    int         ghost_size;
+    int         ghost_next;
+    int         shared_cache;       /* blocks come from silo_vfd_pool */
+    struct H5FD_silo_t *pool_next;
+    struct H5FD_silo_t *open_next;
     int         log_stats;
     char       *log_name;
-    int         use_direct;
+    int         use_direct;         /* aligned block I/O goes through dfd */
+    int         dfd;                /* O_DIRECT descriptor, if use_direct */
+    size_t      align;              /* O_DIRECT offset, length and memory alignment */
+    int         async_flush;
+    silo_vfd_read_ahead_t ra[MAX_READ_AHEAD_STREAMS];
+    int         num_prefetched;     /* blocks read ahead and not yet used */
+    int         meta_at_end;        /* metadata kept in memory, written after raw data at close */
+    haddr_t     raw_base;           /* if meta_at_end, address of first raw data byte... */
+    haddr_t     raw_offset;         /* ...and its offset in the file */
+    haddr_t     meta_eoa;           /* if meta_at_end, end of allocated metadata addresses */
+    unsigned char *meta_buf;        /* if meta_at_end, all the file's metadata */
+    size_t      meta_len;           /* bytes of meta_buf holding metadata */
+    size_t      meta_max;           /* bytes allocated for meta_buf */
+    int         mw_writer;          /* writer this file is in a multi-writer file, or -1 */
+    int         mw_nwriters;
+    hsize_t     mw_seg_size;        /* bytes in a multi-writer segment */
+    hsize_t    *mw_segs;            /* physical segment of each logical one; 0 if none */
+    hsize_t     mw_nsegs;
+    hsize_t     mw_max_segs;
+    int         mw_dirty;           /* segments or size changed since open */
+#ifdef SILO_VFD_ASYNC_FLUSH
+    pthread_t       flush_thread;
+    pthread_mutex_t flush_mutex;    /* guards the queue, file_eof and stats */
+    pthread_cond_t  flush_cond;     /* signaled whenever the queue changes */
+    silo_vfd_flush_job_t *flush_head, *flush_tail;
+    int         flush_blocks;       /* blocks queued or being written */
+    int         flush_quit;
+    int         flush_errno;
+#endif
     silo_vfd_block_bitmap_t was_written_map;
     silo_vfd_block_bitmap_t was_in_mem_map;
     silo_vfd_stats_t stats;
@@ -434,6 +608,14 @@ typedef struct H5FD_silo_t {
                                  * and convert this file to a single file */
 } H5FD_silo_t;
 
+#ifdef SILO_VFD_ASYNC_FLUSH
+#define FLUSH_LOCK(F)   do { if ((F)->async_flush) pthread_mutex_lock(&(F)->flush_mutex); } while (0)
+#define FLUSH_UNLOCK(F) do { if ((F)->async_flush) pthread_mutex_unlock(&(F)->flush_mutex); } while (0)
+#else
+#define FLUSH_LOCK(F)
+#define FLUSH_UNLOCK(F)
+#endif
+
 #ifdef H5_HAVE_LSEEK64
 #   define file_offset_t        off64_t
 #elif defined (_WIN32) && !defined(__MWERKS__)
@@ -482,6 +664,7 @@ static H5FD_t *H5FD_silo_open(const char *name, unsigned flags,
 static herr_t H5FD_silo_close(H5FD_t *lf);
 static int H5FD_silo_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
 static herr_t H5FD_silo_query(const H5FD_t *_f1, unsigned long *flags);
+static herr_t H5FD_silo_get_type_map(const H5FD_t *_file, H5FD_mem_t *type_map);
 static haddr_t H5FD_silo_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
 static herr_t H5FD_silo_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
 #if HDF5_VERSION_GE(1,10,4)
@@ -568,7 +751,7 @@ static const H5FD_class_t H5FD_silo_g = {
     H5FD_silo_close,		                /*close			*/
     H5FD_silo_cmp,			        /*cmp			*/
     H5FD_silo_query,		                /*query			*/
-    NULL,					/*get_type_map		*/
+    H5FD_silo_get_type_map,			/*get_type_map		*/
     NULL,					/*alloc			*/
     NULL,					/*free			*/
     H5FD_silo_get_eoa,		                /*get_eoa		*/
@@ -742,48 +925,129 @@ static int find_block_by_id(H5FD_silo_t *file, hsize_t id, unsigned leq)
     return -1; 
 }
 
+/*
+ * Choose a block to evict using 2Q. Blocks not referenced again since
+ * they came in (A1in) leave first in, first out, ahead of those that were
+ * (Am), which leave least recently used first, whenever A1in holds more
+ * than a quarter of the blocks. A block evicted from A1in and soon missed
+ * again returns to Am (see ghost_hit). So one pass over a large dataset
+ * cannot flush the blocks in repeated use. Within the chosen queue, blocks
+ * holding mostly raw data go before those holding mostly metadata. Blocks
+ * read ahead and not yet used go last. The lowest block, holding the
+ * superblock, is never chosen. 2Q is used only with a byte budget or a
+ * shared cache. Otherwise there is no ghost ring, so every block stays in
+ * A1in, and blocks age on every use, which makes this plain LRU.
+ */
 static int find_block_to_preempt(H5FD_silo_t *file)
 {
-    int i;
-    int min_midx = -1;
-    int min_ridx = -1;
+    int i, q;
+    int min_midx[2] = {-1, -1};
+    int min_ridx[2] = {-1, -1};
     silo_vfd_block_t *bl = file->block_list;
-    hsize_t min_mage = file->op_counter;
-    hsize_t min_rage = file->op_counter;
+    int min_pidx = -1;
+    hsize_t min_mage[2], min_rage[2];
+    hsize_t min_page = file->op_counter;
+
+    min_mage[0] = min_mage[1] = file->op_counter;
+    min_rage[0] = min_rage[1] = file->op_counter;
     for (i = 1; i < file->num_blocks; i++)
     {
-#if 1
-        int msize = bl[i].maxmoff - bl[i].minmoff;
-        int rsize = bl[i].maxroff - bl[i].minroff;
+        int msize, rsize;
+
+        /* blocks read ahead are about to be used; take them last */
+        if (bl[i].prefetched)
+        {
+            if (bl[i].age < min_page)
+            {
+                min_page = bl[i].age;
+                min_pidx = i;
+            }
+            continue;
+        }
 
+        q = bl[i].frequent ? 1 : 0;
+        msize = bl[i].maxmoff - bl[i].minmoff;
+        rsize = bl[i].maxroff - bl[i].minroff;
         if (msize > rsize)
         {
-            if (bl[i].age < min_mage)
+            if (bl[i].age < min_mage[q])
             {
-                min_mage = bl[i].age;
-                min_midx = i;
+                min_mage[q] = bl[i].age;
+                min_midx[q] = i;
             }
         }
         else
         {
-            if (bl[i].age < min_rage)
+            if (bl[i].age < min_rage[q])
             {
-                min_rage = bl[i].age;
-                min_ridx = i;
+                min_rage[q] = bl[i].age;
+                min_ridx[q] = i;
             }
         }
-#else
-        if (bl[i].age < min_rage)
+    }
+
+    q = file->num_blocks - file->num_frequent > MAX(file->num_blocks / 4, 1) ? 0 : 1;
+    if (min_ridx[q] == -1 && min_midx[q] == -1)
+        q = !q;
+    if (min_ridx[q] == -1 && min_midx[q] == -1)
+        return min_pidx;
+    if (min_ridx[q] == -1)
+        return min_midx[q];
+    return min_ridx[q];
+}
+
+/* Remember the id of a block leaving A1in */
+static void ghost_add(H5FD_silo_t *file, hsize_t id)
+{
+    if (!file->ghost_size)
+        return;
+    file->ghost[file->ghost_next] = id;
+    file->ghost_next = (file->ghost_next + 1) % file->ghost_size;
+}
+
+/* Was block id evicted from A1in recently? If so, forget it; it goes to Am. */
+static int ghost_hit(H5FD_silo_t *file, hsize_t id)
+{
+    int i;
+
+    for (i = 0; i < file->ghost_size; i++)
+    {
+        if (file->ghost[i] == id)
         {
-            min_rage = bl[i].age;
-            min_ridx = i;
+            file->ghost[i] = GHOST_EMPTY;
+            return 1;
         }
-#endif
     }
+    return 0;
+}
 
-    if (min_ridx == -1)
-        return min_midx;
-    return min_ridx;
+/* Size the ghost ring to half the blocks the budget allows */
+static void ghost_resize(H5FD_silo_t *file)
+{
+    int i, n = MAX(file->max_blocks / 2, 1);
+    hsize_t *ghost;
+
+    if (!file->two_q)
+        return;
+    ghost = (hsize_t *) realloc(file->ghost, n * sizeof(hsize_t));
+
+    /* without a ghost ring, every block stays in A1in */
+    if (!ghost)
+        n = 0;
+    else
+        file->ghost = ghost;
+    for (i = 0; i < n; i++)
+        file->ghost[i] = GHOST_EMPTY;
+    file->ghost_size = n;
+    file->ghost_next = 0;
+}
+
+/* Number of blocks a budget of nbytes allows, never fewer than two */
+static int blocks_in_budget(hsize_t nbytes, hsize_t block_size)
+{
+    hsize_t n = nbytes / block_size;
+    if (n > INT_MAX) n = INT_MAX;
+    return MAX((int) n, 2);
 }
 
 static herr_t put_data_to_block_by_index(H5FD_silo_t *file, H5FD_mem_t type, const void *srcbuf, hsize_t size,
@@ -801,7 +1065,8 @@ static herr_t put_data_to_block_by_index(H5FD_silo_t *file, H5FD_mem_t type, con
     memcpy((char*)block->buf+off, srcbuf, size);
 
     block->dirty = 1;
-    block->age = file->op_counter++;
+    if (block->frequent || !file->two_q)
+        block->age = file->op_counter++;
 
     if (type == H5FD_MEM_DRAW)
     {
@@ -833,7 +1098,8 @@ static herr_t get_data_from_block_by_index(H5FD_silo_t *file, H5FD_mem_t type, v
     HDassert((hsize_t)off+size<=file->block_size);
     memcpy(dstbuf, (char*)block->buf+off, size);
 
-    block->age = file->op_counter++;
+    if (block->frequent || !file->two_q)
+        block->age = file->op_counter++;
 
     if (type == H5FD_MEM_DRAW)
     {
@@ -849,6 +1115,18 @@ static herr_t get_data_from_block_by_index(H5FD_silo_t *file, H5FD_mem_t type, v
     return 0;
 }
 
+/* Wall clock seconds, for timing system calls */
+static double silo_vfd_time(void)
+{
+#if HAVE_SYS_TIME_H
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return (double) tv.tv_sec + (double) tv.tv_usec * 1.0e-6;
+#else
+    return 0.0;
+#endif
+}
+
 static herr_t file_write(H5FD_silo_t *file, haddr_t addr, size_t size, const void *buf)
 {
     static const char  *func = "file_write";
@@ -877,9 +1155,13 @@ static herr_t file_write(H5FD_silo_t *file, haddr_t addr, size_t size, const voi
     /* Write data, being careful of interrupted system calls and partial results */
     while(size > 0) {
         do {
+            double t0 = silo_vfd_time();
             nbytes = HDwrite(file->fd, buf, size);
+            FLUSH_LOCK(file);
+            file->stats.total_time_in_writes += silo_vfd_time() - t0;
             file->stats.total_write_count++;
-            file->stats.total_write_bytes += nbytes;
+            if (nbytes > 0) file->stats.total_write_bytes += nbytes;
+            FLUSH_UNLOCK(file);
         } while(-1 == nbytes && EINTR == errno);
         if(-1 == nbytes) /* error */
             H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "HDwrite failed", -1, errno)
@@ -936,9 +1218,13 @@ static herr_t file_read(H5FD_silo_t *file, haddr_t addr, size_t size, void *buf)
     /* Read data, careful of interrupted system calls, partial results and eof */
     while(size > 0) {
         do {
+            double t0 = silo_vfd_time();
             nbytes = HDread(file->fd, buf, size);
+            FLUSH_LOCK(file);
+            file->stats.total_time_in_reads += silo_vfd_time() - t0;
             file->stats.total_read_count++;
-            file->stats.total_read_bytes += nbytes;
+            if (nbytes > 0) file->stats.total_read_bytes += nbytes;
+            FLUSH_UNLOCK(file);
         } while(-1 == nbytes && EINTR == errno);
         if(-1 == nbytes) /* error */
             H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_READERROR, "HDread failed", -1, errno)
@@ -970,72 +1256,798 @@ static herr_t file_read(H5FD_silo_t *file, haddr_t addr, size_t size, void *buf)
     return(ret_value);
 }
 
-static herr_t file_write_block(H5FD_silo_t *file, int blidx)
+/* Copy metadata at (virtual) addr out of the in-memory metadata of a
+   meta_at_end file. Bytes never written read as zeros. */
+static void meta_read(H5FD_silo_t const *file, haddr_t addr, size_t size, void *buf)
+{
+    size_t n = 0;
+
+    if (addr < file->meta_len)
+    {
+        n = MIN(size, file->meta_len - (size_t) addr);
+        memcpy(buf, file->meta_buf + addr, n);
+    }
+    if (n < size)
+        memset((char *) buf + n, 0, size - n);
+}
+
+/* Make room for at least len bytes of metadata, zero filling new space */
+static herr_t meta_reserve(H5FD_silo_t *file, size_t len)
 {
-    static const char  *func = "file_write_block";
-    silo_vfd_block_t *b = &(file->block_list[blidx]);
+    static const char *func = "meta_reserve";
     herr_t ret_value = 0;
-    haddr_t addr;
 
-    HDassert(b->dirty);
-    HDassert(b->buf);
+    if (len > file->meta_max)
+    {
+        size_t newmax = file->meta_max ? file->meta_max : (size_t) file->block_size;
+        unsigned char *newbuf;
+        while (newmax < len)
+            newmax *= 2;
+        if (NULL == (newbuf = (unsigned char *) realloc(file->meta_buf, newmax)))
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_NOSPACE, "realloc failed", -1, errno)
+        file->meta_buf = newbuf;
+        file->meta_max = newmax;
+    }
+    if (len > file->meta_len)
+    {
+        memset(file->meta_buf + file->meta_len, 0, len - file->meta_len);
+        file->meta_len = len;
+    }
 
-    H5Eclear2(H5E_DEFAULT);
+    return ret_value;
+}
 
-    addr = b->id * file->block_size;
+static herr_t meta_write(H5FD_silo_t *file, haddr_t addr, size_t size, const void *buf)
+{
+    if (meta_reserve(file, (size_t) (addr + size)) < 0)
+        return -1;
+    memcpy(file->meta_buf + addr, buf, size);
+    return 0;
+}
 
-    if (file_write(file, addr, file->block_size, b->buf) < 0)
-        H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "file_write_block failed", -1, -1)
+/* Words the VFD stores in the file itself are little-endian 64 bit
+   integers; these put and get the i'th word of p */
+static void encode_word(unsigned char *p, int i, unsigned long long val)
+{
+    int j;
 
-    if (file->log_stats)
+    for (j = 0; j < 8; j++)
+        p[8*i+j] = (unsigned char) ((val >> (8*j)) & 0xff);
+}
+
+static unsigned long long decode_word(unsigned char const *p, int i)
+{
+    unsigned long long val = 0;
+    int j;
+
+    for (j = 7; j >= 0; j--)
+        val = (val << 8) | p[8*i+j];
+    return val;
+}
+
+/* The footer is eight words: magic, version, block size, raw data base
+   address, raw data file offset, raw data eoa, metadata file offset and
+   metadata eoa. */
+static void encode_footer(H5FD_silo_t const *file, haddr_t meta_offset, unsigned char *p)
+{
+    memcpy(p, META_AT_END_MAGIC, 8);
+    encode_word(p, 1, META_AT_END_VERSION);
+    encode_word(p, 2, file->block_size);
+    encode_word(p, 3, file->raw_base);
+    encode_word(p, 4, file->raw_offset);
+    encode_word(p, 5, file->eoa - file->raw_offset + file->raw_base);
+    encode_word(p, 6, meta_offset);
+    encode_word(p, 7, file->meta_eoa);
+}
+
+/* Look for a metadata-at-end footer at the end of the file and, if there
+   is one, read all the file's metadata into memory with a single read.
+   Returns 1 if the file was written in meta_at_end mode, 0 if not and -1
+   on error. */
+static int load_meta_at_end(H5FD_silo_t *file, haddr_t file_size)
+{
+    static const char *func = "load_meta_at_end";
+    unsigned char footer[META_AT_END_FOOTER_SIZE];
+    haddr_t raw_eoa, meta_offset, meta_eoa;
+    int ret_value = 1;
+
+    if (file_size < META_AT_END_FOOTER_SIZE)
+        return 0;
+    if (file_read(file, file_size - META_AT_END_FOOTER_SIZE, sizeof(footer), footer) < 0)
+        return -1;
+    if (memcmp(footer, META_AT_END_MAGIC, 8))
+        return 0;
+    if (decode_word(footer, 1) != META_AT_END_VERSION)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_FILE, H5E_VERSION, "unknown silo metadata footer version", -1, -1)
+
+    file->raw_base = (haddr_t) decode_word(footer, 3);
+    file->raw_offset = (haddr_t) decode_word(footer, 4);
+    raw_eoa = (haddr_t) decode_word(footer, 5);
+    meta_offset = (haddr_t) decode_word(footer, 6);
+    meta_eoa = (haddr_t) decode_word(footer, 7);
+    if (raw_eoa < file->raw_base || meta_eoa > file->raw_base ||
+        meta_offset + meta_eoa + META_AT_END_FOOTER_SIZE != file_size)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_FILE, H5E_BADVALUE, "corrupt silo metadata footer", -1, -1)
+
+    if (meta_reserve(file, (size_t) meta_eoa) < 0)
+        return -1;
+    if (file_read(file, meta_offset, (size_t) meta_eoa, file->meta_buf) < 0)
+        return -1;
+    file->meta_at_end = 1;
+    file->meta_eoa = meta_eoa;
+    file->eoa = raw_eoa - file->raw_base + file->raw_offset;
+
+    return ret_value;
+}
+
+/* Write the metadata of a meta_at_end file after its raw data, then the
+   footer, and a copy of the leading metadata, holding the superblock, at
+   the start of the file. Raw data blocks must already be on disk. */
+static herr_t write_meta_at_end(H5FD_silo_t *file)
+{
+    static const char *func = "write_meta_at_end";
+    unsigned char footer[META_AT_END_FOOTER_SIZE];
+    haddr_t meta_offset;
+    herr_t ret_value = 0;
+
+    meta_offset = (file->eoa + file->block_size - 1) / file->block_size * file->block_size;
+    if (meta_reserve(file, (size_t) file->meta_eoa) < 0)
+        return -1;
+    encode_footer(file, meta_offset, footer);
+
+    if (file_write(file, meta_offset, (size_t) file->meta_eoa, file->meta_buf) < 0 ||
+        file_write(file, meta_offset + file->meta_eoa, sizeof(footer), footer) < 0 ||
+        file_write(file, 0, (size_t) MIN(file->meta_eoa, file->raw_offset), file->meta_buf) < 0)
+        return -1;
+    if (HDftruncate(file->fd, (file_offset_t) (meta_offset + file->meta_eoa + sizeof(footer))) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_SEEKERROR, "unable to truncate file", -1, errno)
+
+    file->stats.total_vfd_md_write_count++;
+    file->stats.total_vfd_md_write_bytes += file->meta_eoa;
+
+    return ret_value;
+}
+
+/* Multi-writer files start with their magic */
+static int is_multi_writer_file(H5FD_silo_t *file, haddr_t file_size)
+{
+    char magic[8];
+
+    if (file_size < 8 || file_read(file, 0, sizeof(magic), magic) < 0)
+        return 0;
+    return !memcmp(magic, MW_MAGIC, 8);
+}
+
+#ifdef SILO_VFD_MULTI_WRITER
+/* Move len bytes at physical offset off, being careful of interrupted
+   system calls and partial results. Reads past the end of the file zero
+   fill. Returns -1 with errno set on failure. */
+static int mw_pio(H5FD_silo_t *file, int op, haddr_t off, void *buf, size_t len)
+{
+    char *p = (char *) buf;
+
+    while (len > 0)
     {
-        int msize = 0, rsize = 0;
-        if (b->maxmoff > b->minmoff)
-            msize = b->maxmoff - b->minmoff;
-        if (b->maxroff > b->minroff)
-            rsize = b->maxroff - b->minroff;
+        ssize_t nbytes;
+        do {
+            if (op == OP_WRITE)
+                nbytes = pwrite(file->fd, p, len, (file_offset_t) off);
+            else
+                nbytes = pread(file->fd, p, len, (file_offset_t) off);
+        } while (-1 == nbytes && EINTR == errno);
+        if (-1 == nbytes)
+            return -1;
+        if (0 == nbytes)
+        {
+            HDassert(op == OP_READ);
+            HDmemset(p, 0, len);
+            break;
+        }
+        p += nbytes;
+        off += (haddr_t) nbytes;
+        len -= (size_t) nbytes;
+    }
+    return 0;
+}
 
-        if (rsize >= msize)
-            file->stats.total_block_raw_writes++;
-        else
-            file->stats.total_block_md_writes++;
+/* Serializes header updates among the threads of this process. Classic
+   fcntl locks belong to the process, so on their own they would let two
+   threads writing different files of one multi-writer file claim the
+   same segments. */
+#ifdef HAVE_PTHREAD
+static pthread_mutex_t silo_vfd_mw_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define MW_LOCK()   pthread_mutex_lock(&silo_vfd_mw_mutex)
+#define MW_UNLOCK() pthread_mutex_unlock(&silo_vfd_mw_mutex)
+#else
+#define MW_LOCK()
+#define MW_UNLOCK()
+#endif
+
+/* Take or release the lock, held across processes and threads, on the
+   header; readers, which cannot write lock, share theirs. Open file
+   description locks are used where the system has them since, unlike
+   classic ones, closing another descriptor of the file does not drop
+   them. */
+static int mw_lock(H5FD_silo_t *file, int lock)
+{
+    struct flock fl;
+    int status;
+
+    if (lock)
+        MW_LOCK();
+    memset(&fl, 0, sizeof(fl));
+    fl.l_type = !lock ? F_UNLCK : file->write_access ? F_WRLCK : F_RDLCK;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = 0;
+    fl.l_len = 8;
+#ifdef F_OFD_SETLKW
+    do {
+        status = fcntl(file->fd, F_OFD_SETLKW, &fl);
+    } while (-1 == status && EINTR == errno);
+    if (-1 == status && EINVAL == errno)
+#endif
+    do {
+        status = fcntl(file->fd, F_SETLKW, &fl);
+    } while (-1 == status && EINTR == errno);
+    if (!lock || status < 0)
+        MW_UNLOCK();
+    return status;
+}
+
+/* Claim n consecutive segments of the physical file, returning the first */
+static herr_t mw_claim(H5FD_silo_t *file, hsize_t n, hsize_t *first)
+{
+    static const char *func = "mw_claim";
+    unsigned char word[8];
+    herr_t ret_value = 0;
+    int failed;
+
+    if (mw_lock(file, 1) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_FILE, H5E_CANTLOCK, "can't lock multi-writer header", -1, errno)
+    failed = mw_pio(file, OP_READ, 8*4, word, 8) < 0;
+    if (!failed)
+    {
+        *first = (hsize_t) decode_word(word, 0);
+        encode_word(word, 0, *first + n);
+        failed = mw_pio(file, OP_WRITE, 8*4, word, 8) < 0;
+    }
+    mw_lock(file, 0);
+    if (failed)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't update multi-writer header", -1, errno)
+
+    return ret_value;
+}
+
+/* Claim segments for any of [0,eoa) not already mapped */
+static herr_t mw_grow(H5FD_silo_t *file, haddr_t eoa)
+{
+    static const char *func = "mw_grow";
+    hsize_t need = (eoa + file->mw_seg_size - 1) / file->mw_seg_size;
+    hsize_t first, i;
+    herr_t ret_value = 0;
+
+    if (need <= file->mw_nsegs)
+        return 0;
+
+    if (need > file->mw_max_segs)
+    {
+        hsize_t newmax = MAX(MAX(need, 2 * file->mw_max_segs), 64);
+        hsize_t *newsegs;
+        FLUSH_LOCK(file);
+        newsegs = (hsize_t *) realloc(file->mw_segs, (size_t) newmax * sizeof(hsize_t));
+        if (newsegs)
+        {
+            file->mw_segs = newsegs;
+            file->mw_max_segs = newmax;
+        }
+        FLUSH_UNLOCK(file);
+        if (!newsegs)
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_NOSPACE, "realloc failed", -1, errno)
+    }
+
+    if (mw_claim(file, need - file->mw_nsegs, &first) < 0)
+        return -1;
+
+    FLUSH_LOCK(file);
+    for (i = file->mw_nsegs; i < need; i++)
+        file->mw_segs[i] = first + (i - file->mw_nsegs);
+    file->mw_nsegs = need;
+    FLUSH_UNLOCK(file);
+    file->mw_dirty = 1;
+
+    return ret_value;
+}
+
+/* Join (as a writer) or read one of the files sharing a multi-writer
+   file. The first writer to find the physical file empty, or to be
+   asked to truncate one that is not a multi-writer file, lays out the
+   header. A writer truncating its file starts over with no segments;
+   otherwise the writer's index and size are loaded. */
+static herr_t mw_open(H5FD_silo_t *file, unsigned flags, int nwriters, int writer)
+{
+    static const char *func = "mw_open";
+    unsigned char hdr[8*MW_HDR_WORDS], slot[8*MW_SLOT_WORDS];
+    unsigned char *index;
+    hsize_t index_seg, size;
+    h5_stat_t sb;
+    herr_t ret_value = 0;
+
+    file->mw_writer = writer;
+
+    if (mw_lock(file, 1) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_FILE, H5E_CANTLOCK, "can't lock multi-writer header", -1, errno)
+    if (mw_pio(file, OP_READ, 0, hdr, sizeof(hdr)) < 0 || HDfstat(file->fd, &sb) < 0)
+    {
+        mw_lock(file, 0);
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_READERROR, "can't read multi-writer header", -1, errno)
+    }
+    if (memcmp(hdr, MW_MAGIC, 8))
+    {
+        hsize_t seg = MW_SEGMENT_BLOCKS * file->block_size;
+        hsize_t hdr_bytes = 8 * (MW_HDR_WORDS + MW_SLOT_WORDS * (hsize_t) nwriters);
+        unsigned char *p;
+        int failed;
+
+        if (!file->write_access || nwriters <= 0 || (sb.st_size != 0 && !(flags & H5F_ACC_TRUNC)))
+        {
+            mw_lock(file, 0);
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_FILE, H5E_BADFILE, "not a multi-writer silo file", -1, -1)
+        }
+        if (NULL == (p = (unsigned char *) calloc(1, (size_t) hdr_bytes)))
+        {
+            mw_lock(file, 0);
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_NOSPACE, "calloc failed", -1, errno)
+        }
+        memcpy(p, MW_MAGIC, 8);
+        encode_word(p, 1, MW_VERSION);
+        encode_word(p, 2, seg);
+        encode_word(p, 3, (unsigned long long) nwriters);
+        encode_word(p, 4, (hdr_bytes + seg - 1) / seg);
+        memcpy(hdr, p, sizeof(hdr));
+        failed = HDftruncate(file->fd, 0) < 0 ||
+                 mw_pio(file, OP_WRITE, 8, p + 8, (size_t) hdr_bytes - 8) < 0 ||
+                 mw_pio(file, OP_WRITE, 0, p, 8) < 0;
+        free(p);
+        if (failed)
+        {
+            mw_lock(file, 0);
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't write multi-writer header", -1, errno)
+        }
+    }
+    mw_lock(file, 0);
+
+    if (decode_word(hdr, 1) != MW_VERSION)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_FILE, H5E_VERSION, "unknown multi-writer silo file version", -1, -1)
+    file->mw_seg_size = (hsize_t) decode_word(hdr, 2);
+    file->mw_nwriters = (int) decode_word(hdr, 3);
+    if (file->mw_seg_size == 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_FILE, H5E_BADVALUE, "corrupt multi-writer header", -1, -1)
+    if (nwriters > 0 && nwriters != file->mw_nwriters)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_ARGS, H5E_BADVALUE, "multi-writer file has a different number of writers", -1, -1)
+    if (writer >= file->mw_nwriters)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_ARGS, H5E_BADVALUE, "no such writer in multi-writer file", -1, -1)
+
+    /* a truncated file has no segments and nothing to load */
+    if (file->write_access && (flags & H5F_ACC_TRUNC))
+    {
+        file->eof = file->file_eof = 0;
+        file->mw_dirty = 1;
+        return 0;
+    }
+
+    if (mw_pio(file, OP_READ, 8 * (MW_HDR_WORDS + MW_SLOT_WORDS * (haddr_t) writer), slot, sizeof(slot)) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_READERROR, "can't read multi-writer slot", -1, errno)
+    index_seg = (hsize_t) decode_word(slot, 0);
+    file->mw_nsegs = (hsize_t) decode_word(slot, 1);
+    size = (hsize_t) decode_word(slot, 2);
+    if (!file->write_access && size == 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_FILE, H5E_NOTFOUND, "writer never closed its file", -1, -1)
+
+    if (file->mw_nsegs)
+    {
+        hsize_t i;
+        if (NULL == (file->mw_segs = (hsize_t *) malloc((size_t) file->mw_nsegs * sizeof(hsize_t))) ||
+            NULL == (index = (unsigned char *) malloc((size_t) file->mw_nsegs * 8)))
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_NOSPACE, "malloc failed", -1, errno)
+        file->mw_max_segs = file->mw_nsegs;
+        if (mw_pio(file, OP_READ, index_seg * file->mw_seg_size, index, (size_t) file->mw_nsegs * 8) < 0)
+        {
+            free(index);
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_READERROR, "can't read multi-writer index", -1, errno)
+        }
+        for (i = 0; i < file->mw_nsegs; i++)
+            file->mw_segs[i] = (hsize_t) decode_word(index, (int) i);
+        free(index);
+    }
+    file->eof = file->file_eof = size;
+
+    return ret_value;
+}
+
+/* Write the index of a multi-writer file's segments into segments of
+   its own, then point its slot in the header at it */
+static herr_t mw_close(H5FD_silo_t *file)
+{
+    static const char *func = "mw_close";
+    unsigned char slot[8*MW_SLOT_WORDS];
+    unsigned char *index = 0;
+    hsize_t index_seg = 0, i;
+    herr_t ret_value = 0;
+
+    if (file->mw_nsegs)
+    {
+        size_t nbytes = (size_t) file->mw_nsegs * 8;
+        int failed;
+
+        if (mw_claim(file, (nbytes + file->mw_seg_size - 1) / file->mw_seg_size, &index_seg) < 0)
+            return -1;
+        if (NULL == (index = (unsigned char *) malloc(nbytes)))
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_NOSPACE, "malloc failed", -1, errno)
+        for (i = 0; i < file->mw_nsegs; i++)
+            encode_word(index, (int) i, file->mw_segs[i]);
+        failed = mw_pio(file, OP_WRITE, index_seg * file->mw_seg_size, index, nbytes) < 0;
+        free(index);
+        if (failed)
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't write multi-writer index", -1, errno)
+    }
+
+    encode_word(slot, 0, index_seg);
+    encode_word(slot, 1, file->mw_nsegs);
+    encode_word(slot, 2, MAX(file->eoa, file->eof));
+    if (mw_pio(file, OP_WRITE, 8 * (MW_HDR_WORDS + MW_SLOT_WORDS * (haddr_t) file->mw_writer), slot, sizeof(slot)) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't write multi-writer slot", -1, errno)
+
+    return ret_value;
+}
+
+/* Limit the nd io vectors at logical address addr to the segment holding
+   it, shortening the last one kept by *cut bytes, and find where they go
+   in the physical file. Returns 0 if the segment is not mapped. Safe to
+   call from the flush thread. */
+static int mw_map(H5FD_silo_t *file, haddr_t addr, struct iovec *v, int *nd,
+    size_t *cut, haddr_t *paddr)
+{
+    hsize_t s = addr / file->mw_seg_size, pseg;
+    size_t left = (size_t) (file->mw_seg_size - addr % file->mw_seg_size);
+    int i;
+
+    FLUSH_LOCK(file);
+    pseg = s < file->mw_nsegs ? file->mw_segs[s] : 0;
+    FLUSH_UNLOCK(file);
+
+    for (i = 0; i < *nd && v[i].iov_len <= left; i++)
+        left -= v[i].iov_len;
+    if (i < *nd && left > 0)
+    {
+        *cut = v[i].iov_len - left;
+        v[i].iov_len = left;
+        i++;
+    }
+    *nd = i;
+    *paddr = pseg * file->mw_seg_size + addr % file->mw_seg_size;
+
+    return pseg != 0;
+}
+#endif
+
+#ifdef SILO_VFD_DIRECT
+/* Number of leading io vectors at addr that meet O_DIRECT's alignment
+   requirements on file offset, length and memory address */
+static int direct_iov_count(H5FD_silo_t const *file, haddr_t addr, struct iovec const *v, int nv)
+{
+    int i;
+
+    if (addr % file->align)
+        return 0;
+    for (i = 0; i < nv; i++)
+    {
+        if ((size_t) v[i].iov_base % file->align || v[i].iov_len % file->align)
+            break;
+    }
+    return i;
+}
+#endif
+
+#if defined(HAVE_PREADV) && defined(HAVE_PWRITEV)
+/* Move the bytes described by the nv io vectors at addr with as few
+   vectored system calls as possible, being careful of interrupted system
+   calls, partial results and eof. Reads past the end of the file zero
+   fill. The vectors are consumed. Returns -1 with errno set on failure.
+   Safe to call from the flush thread: does not touch the HDF5 error stack.
+   In multi-writer mode, addr is logical and each call stays within one
+   segment. */
+static int file_rwv(H5FD_silo_t *file, int op, haddr_t addr, struct iovec *v, int nv)
+{
+    ssize_t nbytes;
+    int i;
+
+    while (nv > 0)
+    {
+        int nd = nv, mapped = 1;
+        size_t cut = 0;
+        haddr_t paddr = addr;
+
+#ifdef SILO_VFD_MULTI_WRITER
+        if (file->mw_writer >= 0)
+            mapped = mw_map(file, addr, v, &nd, &cut, &paddr);
+#endif
+        do {
+            double t0 = silo_vfd_time();
+            int fd = file->fd, nx = nd, direct = 0;
+            if (!mapped)
+            {
+                /* never written; a writer must have claimed it first */
+                nbytes = op == OP_WRITE ? -1 : 0;
+                errno = EFAULT;
+                break;
+            }
+#ifdef SILO_VFD_DIRECT
+            /* aligned leading vectors bypass the page cache; an unaligned
+               tail, such as the partial last block, goes through fd */
+            if (file->use_direct && (nx = direct_iov_count(file, paddr, v, nd)) > 0)
+            {
+                fd = file->dfd;
+                direct = 1;
+            }
+            else
+                nx = nd;
+#endif
+            if (op == OP_WRITE)
+            {
+                nbytes = pwritev(fd, v, nx, (file_offset_t)paddr);
+                if (-1 == nbytes && EINVAL == errno && direct)
+                    nbytes = pwritev(file->fd, v, nx, (file_offset_t)paddr);
+            }
+            else
+            {
+                nbytes = preadv(fd, v, nx, (file_offset_t)paddr);
+                if (-1 == nbytes && EINVAL == errno && direct)
+                    nbytes = preadv(file->fd, v, nx, (file_offset_t)paddr);
+            }
+            FLUSH_LOCK(file);
+            if (op == OP_WRITE)
+            {
+                file->stats.total_time_in_writes += silo_vfd_time() - t0;
+                file->stats.total_write_count++;
+                if (nbytes > 0) file->stats.total_write_bytes += nbytes;
+            }
+            else
+            {
+                file->stats.total_time_in_reads += silo_vfd_time() - t0;
+                file->stats.total_read_count++;
+                if (nbytes > 0) file->stats.total_read_bytes += nbytes;
+            }
+            if (direct)
+                file->stats.num_direct_io++;
+            else if (file->use_direct)
+                file->stats.num_unaligned_io++;
+            FLUSH_UNLOCK(file);
+        } while(-1 == nbytes && EINTR == errno);
+        if (0 == nbytes)
+        {
+            HDassert(op == OP_READ);
+            /* end of file (or segment) but not end of format address space */
+            for (i = 0; i < nd; i++)
+            {
+                HDmemset(v[i].iov_base, 0, v[i].iov_len);
+                nbytes += v[i].iov_len;
+            }
+        }
+        if (cut)
+            v[nd-1].iov_len += cut;
+        if (-1 == nbytes)
+            return -1;
+        addr += (haddr_t)nbytes;
+        while (nv > 0 && (size_t)nbytes >= v->iov_len)
+        {
+            nbytes -= v->iov_len;
+            v++;
+            nv--;
+        }
+        if (nv > 0)
+        {
+            v->iov_base = (char *)v->iov_base + nbytes;
+            v->iov_len -= nbytes;
+        }
+    }
+
+    FLUSH_LOCK(file);
+    if (op == OP_WRITE && addr > file->file_eof)
+        file->file_eof = addr;
+    FLUSH_UNLOCK(file);
+
+    return 0;
+}
+
+static int file_iov(struct iovec *iov, void **bufs, hsize_t const *sizes, int n)
+{
+    int i, nv = 0;
 
-        if (get_block_bitmap_by_id(&(file->was_written_map), b->id))
-            update_hotblock_stats(file, b->id, OP_WRITE, (rsize+msize)?(float)rsize/(msize+rsize):(float)0);
+    HDassert(n <= MAX_BLOCKS_PER_IO);
 
-        set_block_bitmap_by_id(&(file->was_written_map), b->id);
+    for (i = 0; i < n; i++)
+    {
+        if (sizes[i] == 0) continue;
+        iov[nv].iov_base = bufs[i];
+        iov[nv].iov_len = (size_t) sizes[i];
+        nv++;
     }
+    return nv;
+}
+#endif
+
+/* Write or read a run of blocks at consecutive addresses starting at addr
+   with as few system calls as possible. Reads past the end of the file
+   zero fill. */
+static herr_t file_rw_blocks(H5FD_silo_t *file, int op, haddr_t addr,
+    void **bufs, hsize_t const *sizes, int n)
+{
+    static const char  *func = "file_rw_blocks";
+    herr_t              ret_value = 0;
+#if defined(HAVE_PREADV) && defined(HAVE_PWRITEV)
+    struct iovec        iov[MAX_BLOCKS_PER_IO];
+    int                 nv = file_iov(iov, bufs, sizes, n);
+
+    if (REGION_OVERFLOW(addr, (hsize_t) n * file->block_size))
+        H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_OVERFLOW, "addr overflow", -1, -1)
+
+    if (file_rwv(file, op, addr, iov, nv) < 0)
+    {
+        if (op == OP_WRITE)
+            H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "pwritev failed", -1, errno)
+        H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_READERROR, "preadv failed", -1, errno)
+    }
+#else
+    int i;
+
+    for (i = 0; i < n; i++)
+    {
+        if (sizes[i] == 0) continue;
+        if (op == OP_WRITE && file_write(file, addr, sizes[i], bufs[i]) < 0)
+            H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "file_write failed", -1, -1)
+        if (op == OP_READ && file_read(file, addr, sizes[i], bufs[i]) < 0)
+            H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_READERROR, "file_read failed", -1, -1)
+        addr += file->block_size;
+    }
+#endif
+
+    return(ret_value);
+}
+
+/* Gather the buffers and sizes for writing the n blocks starting at blidx
+   in the block list and mark them clean. The blocks must have consecutive
+   ids. The last block in the file is written only up to the end of the
+   file's data. */
+static void prepare_write_blocks(H5FD_silo_t *file, int blidx, int n,
+    void **bufs, hsize_t *sizes)
+{
+    silo_vfd_block_t *bl = &(file->block_list[blidx]);
+    haddr_t addr, end = MAX(file->eoa, file->eof);
+    int i;
+
+    HDassert(n <= MAX_BLOCKS_PER_IO);
+
+    addr = bl[0].id * file->block_size;
+
+    for (i = 0; i < n; i++)
+    {
+        haddr_t baddr = addr + i * file->block_size;
+
+        HDassert(bl[i].dirty);
+        HDassert(bl[i].buf);
+        HDassert(bl[i].id == bl[0].id + i);
+
+        bufs[i] = bl[i].buf;
+        sizes[i] = file->block_size;
+        if (baddr + file->block_size > end)
+            sizes[i] = end > baddr ? end - baddr : 0;
+    }
+
+    if (file->log_stats && n > 1)
+    {
+        file->stats.num_coalesced_writes++;
+        file->stats.num_coalesced_write_blocks += n;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        silo_vfd_block_t *b = &bl[i];
+
+        if (file->log_stats)
+        {
+            int msize = 0, rsize = 0;
+            if (b->maxmoff > b->minmoff)
+                msize = b->maxmoff - b->minmoff;
+            if (b->maxroff > b->minroff)
+                rsize = b->maxroff - b->minroff;
+
+            if (rsize >= msize)
+                file->stats.total_block_raw_writes++;
+            else
+                file->stats.total_block_md_writes++;
+
+            if (get_block_bitmap_by_id(&(file->was_written_map), b->id))
+                update_hotblock_stats(file, b->id, OP_WRITE, (rsize+msize)?(float)rsize/(msize+rsize):(float)0);
+
+            set_block_bitmap_by_id(&(file->was_written_map), b->id);
+        }
 
-    if (ret_value == 0)
         b->dirty = 0;
+    }
+}
+
+/* Write the n blocks starting at blidx in the block list. If the write
+   fails, the blocks stay dirty. */
+static herr_t file_write_blocks(H5FD_silo_t *file, int blidx, int n)
+{
+    static const char  *func = "file_write_blocks";
+    void *bufs[MAX_BLOCKS_PER_IO];
+    hsize_t sizes[MAX_BLOCKS_PER_IO];
+    herr_t ret_value = 0;
+    int i;
+
+    H5Eclear2(H5E_DEFAULT);
+
+    prepare_write_blocks(file, blidx, n, bufs, sizes);
+
+    if (file_rw_blocks(file, OP_WRITE, file->block_list[blidx].id * file->block_size, bufs, sizes, n) < 0)
+    {
+        for (i = 0; i < n; i++)
+            file->block_list[blidx+i].dirty = 1;
+        H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "file_write_blocks failed", -1, -1)
+    }
 
     return(ret_value);
 }
 
-static herr_t file_read_block(H5FD_silo_t *file, int blidx)
+static herr_t file_write_block(H5FD_silo_t *file, int blidx)
+{
+    return file_write_blocks(file, blidx, 1);
+}
+
+/* Read the n blocks starting at blidx in the block list. The blocks must
+   have consecutive ids. */
+static herr_t file_read_blocks(H5FD_silo_t *file, int blidx, int n)
 {
-    static const char  *func = "file_read_block";
-    silo_vfd_block_t *b = &(file->block_list[blidx]);
+    static const char  *func = "file_read_blocks";
+    silo_vfd_block_t *bl = &(file->block_list[blidx]);
+    void *bufs[MAX_BLOCKS_PER_IO];
+    hsize_t sizes[MAX_BLOCKS_PER_IO];
     herr_t ret_value = 0;
-    haddr_t addr;
+    int i;
+
+    HDassert(n <= MAX_BLOCKS_PER_IO);
 
     H5Eclear2(H5E_DEFAULT);
 
-    addr = b->id * file->block_size;
+    for (i = 0; i < n; i++)
+    {
+        HDassert(bl[i].id == bl[0].id + i);
+        bufs[i] = bl[i].buf;
+        sizes[i] = file->block_size;
+    }
 
-    if (file_read(file, addr, file->block_size, b->buf) < 0)
-        H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_READERROR, "file_read_block failed", -1, -1)
-    file->stats.total_block_reads++;
+    if (file_rw_blocks(file, OP_READ, bl[0].id * file->block_size, bufs, sizes, n) < 0)
+        H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_READERROR, "file_read_blocks failed", -1, -1)
+    file->stats.total_block_reads += n;
 
-    /* check if the block was ever in memory before */
-    if (file->log_stats)
+    if (file->log_stats && n > 1)
     {
-        if (get_block_bitmap_by_id(&(file->was_in_mem_map), b->id))
-            update_hotblock_stats(file, b->id, OP_READ, 0);
+        file->stats.num_coalesced_reads++;
+        file->stats.num_coalesced_read_blocks += n;
     }
 
-    if (ret_value == 0)
-        b->dirty = 0;
+    for (i = 0; i < n; i++)
+    {
+        /* check if the block was ever in memory before */
+        if (file->log_stats)
+        {
+            if (get_block_bitmap_by_id(&(file->was_in_mem_map), bl[i].id))
+                update_hotblock_stats(file, bl[i].id, OP_READ, 0);
+        }
+
+        bl[i].dirty = 0;
+    }
 
     return(ret_value);
 }
@@ -1048,6 +2060,20 @@ static herr_t remove_block_by_index(H5FD_silo_t *file, int blidx)
 
     HDassert(file->num_blocks>0);
 
+    if (b->frequent)
+        file->num_frequent--;
+    else if (!b->prefetched)
+        ghost_add(file, b->id);
+
+    /* read ahead too far; shrink that stream's window */
+    if (b->prefetched)
+    {
+        file->ra[b->prefetched-1].window /= 2;
+        file->num_prefetched--;
+        file->stats.num_prefetch_wasted++;
+    }
+    file->stats.num_block_evictions++;
+
     if (file->log_stats)
     {
         int msize = b->maxmoff - b->minmoff;
@@ -1074,7 +2100,17 @@ static herr_t insert_block_by_index(H5FD_silo_t *file, int blidx)
     int i;
     silo_vfd_block_t *bl = file->block_list;
 
-    HDassert(file->num_blocks<file->max_blocks);
+    /* the list grows as blocks come in; a shared cache can briefly hold
+       more blocks than its budget */
+    if (file->num_blocks == file->list_size)
+    {
+        int n = MAX(2 * file->list_size, 16);
+        silo_vfd_block_t *newbl = (silo_vfd_block_t *) realloc(bl, n * sizeof(silo_vfd_block_t));
+        if (!newbl)
+            return -1;
+        file->block_list = bl = newbl;
+        file->list_size = n;
+    }
 
     for (i = file->num_blocks; i > blidx+1; i--)
         bl[i] = bl[i-1];
@@ -1091,21 +2127,36 @@ static herr_t insert_block_by_index(H5FD_silo_t *file, int blidx)
     return 0;
 }
 
+/* Block buffers are aligned for direct I/O when it is in use */
+static void *alloc_block_buf(H5FD_silo_t const *file)
+{
+#ifdef SILO_VFD_DIRECT
+    if (file->use_direct)
+    {
+        void *buf;
+        if (posix_memalign(&buf, file->align, (size_t) file->block_size) != 0)
+            return 0;
+        return buf;
+    }
+#endif
+    return malloc((size_t) file->block_size);
+}
+
 static int alloc_block_by_id(H5FD_silo_t *file, hsize_t id)
 {
-    haddr_t addr0 = id * file->block_size;
     silo_vfd_block_t *b;
     int blidx = find_block_by_id(file, id, CLOSEST);
 
     /* blidx refers to the block in the list JUST BEFORE the block we're inserting */ 
-    insert_block_by_index(file, blidx);
+    if (insert_block_by_index(file, blidx) < 0)
+        HDassert(0);
 
     /* update blidx to point to the block we're inserting */
     blidx++;
 
     b = &(file->block_list[blidx]);
 
-    b->buf = malloc(file->block_size);
+    b->buf = alloc_block_buf(file);
     HDassert(b->buf);
     b->id = id;
     b->age = file->op_counter++;
@@ -1113,9 +2164,14 @@ static int alloc_block_by_id(H5FD_silo_t *file, hsize_t id)
     b->maxmoff = 0;
     b->minroff = file->block_size;
     b->maxroff = 0;
-
-    if (addr0<file->file_eof)
-        file_read_block(file, blidx);
+    b->dirty = 0;
+    b->prefetched = 0;
+    b->frequent = ghost_hit(file, id);
+    if (b->frequent)
+    {
+        file->num_frequent++;
+        file->stats.num_ghost_hits++;
+    }
 
     if (file->log_stats)
     {
@@ -1126,6 +2182,312 @@ static int alloc_block_by_id(H5FD_silo_t *file, hsize_t id)
     return blidx;
 }
 
+/*
+ * Find the run of dirty blocks around blidx that are completely filled
+ * (and so unlikely to be written again soon). The run always includes
+ * the block at blidx.
+ */
+static int block_run_bounds(H5FD_silo_t *file, int blidx, int *first_out)
+{
+    silo_vfd_block_t *bl = file->block_list;
+    int first = blidx, last = blidx;
+
+#define BLOCK_IS_FULL(B) ((B).dirty && \
+    MIN((B).minmoff,(B).minroff) == 0 && \
+    MAX((B).maxmoff,(B).maxroff) == file->block_size-1)
+
+    while (first > 0 && last - first + 1 < MAX_BLOCKS_PER_IO &&
+           bl[first-1].id == bl[first].id - 1 && BLOCK_IS_FULL(bl[first-1]))
+        first--;
+    while (last < file->num_blocks-1 && last - first + 1 < MAX_BLOCKS_PER_IO &&
+           bl[last+1].id == bl[last].id + 1 && BLOCK_IS_FULL(bl[last+1]))
+        last++;
+
+#undef BLOCK_IS_FULL
+
+    *first_out = first;
+    return last - first + 1;
+}
+
+#ifdef SILO_VFD_ASYNC_FLUSH
+/*
+ * Body of the background flush thread. Writes queued runs of blocks in
+ * order until asked to quit and the queue is empty. A job stays at the
+ * head of the queue while it is being written so that readers of the same
+ * blocks wait for it.
+ */
+static void *flush_thread_main(void *arg)
+{
+    H5FD_silo_t *file = (H5FD_silo_t *) arg;
+
+    pthread_mutex_lock(&file->flush_mutex);
+    while (1)
+    {
+        silo_vfd_flush_job_t *job;
+        struct iovec iov[MAX_BLOCKS_PER_IO];
+        int i, nv;
+
+        while (!file->flush_head && !file->flush_quit)
+            pthread_cond_wait(&file->flush_cond, &file->flush_mutex);
+        if (!file->flush_head)
+            break;
+        job = file->flush_head;
+        pthread_mutex_unlock(&file->flush_mutex);
+
+        nv = file_iov(iov, job->bufs, job->sizes, job->n);
+        i = file_rwv(file, OP_WRITE, job->id * file->block_size, iov, nv);
+
+        pthread_mutex_lock(&file->flush_mutex);
+        if (i < 0 && !file->flush_errno)
+            file->flush_errno = errno ? errno : EIO;
+        file->flush_head = job->next;
+        if (!file->flush_head)
+            file->flush_tail = 0;
+        file->flush_blocks -= job->n;
+        pthread_cond_broadcast(&file->flush_cond);
+        pthread_mutex_unlock(&file->flush_mutex);
+
+        for (i = 0; i < job->n; i++)
+            free(job->bufs[i]);
+        free(job);
+
+        pthread_mutex_lock(&file->flush_mutex);
+    }
+    pthread_mutex_unlock(&file->flush_mutex);
+
+    return 0;
+}
+
+/*
+ * Hand the run of dirty blocks around blidx to the flush thread, removing
+ * them from the block list. To bound memory, waits while more than a block
+ * list's worth of blocks is already queued.
+ */
+static herr_t queue_block_run(H5FD_silo_t *file, int blidx)
+{
+    silo_vfd_flush_job_t *job;
+    int i, first, n = block_run_bounds(file, blidx, &first);
+
+    job = (silo_vfd_flush_job_t *) malloc(sizeof(silo_vfd_flush_job_t) +
+              n * (sizeof(void*) + sizeof(hsize_t)));
+    if (!job)
+    {
+        /* no memory for the job; write the run ourselves */
+        if (file_write_blocks(file, first, n) < 0)
+            return -1;
+        for (i = 0; i < n; i++)
+            free(file->block_list[first+i].buf);
+        for (i = 0; i < n; i++)
+            remove_block_by_index(file, first);
+        return 0;
+    }
+    job->next = 0;
+    job->id = file->block_list[first].id;
+    job->n = n;
+    job->sizes = (hsize_t *) (job + 1);
+    job->bufs = (void **) (job->sizes + n);
+
+    prepare_write_blocks(file, first, n, job->bufs, job->sizes);
+    for (i = 0; i < n; i++)
+        remove_block_by_index(file, first);
+
+    pthread_mutex_lock(&file->flush_mutex);
+    while (file->flush_blocks > 0 && file->flush_blocks + n > file->max_blocks)
+        pthread_cond_wait(&file->flush_cond, &file->flush_mutex);
+    if (file->flush_tail)
+        file->flush_tail->next = job;
+    else
+        file->flush_head = job;
+    file->flush_tail = job;
+    file->flush_blocks += n;
+    file->stats.num_async_writes++;
+    file->stats.num_async_write_blocks += n;
+    pthread_cond_broadcast(&file->flush_cond);
+    pthread_mutex_unlock(&file->flush_mutex);
+
+    return 0;
+}
+
+/* Wait until no queued write overlaps the blocks [id,id+n). */
+static void wait_for_flush(H5FD_silo_t *file, hsize_t id, int n)
+{
+    silo_vfd_flush_job_t *job;
+
+    pthread_mutex_lock(&file->flush_mutex);
+    job = file->flush_head;
+    while (job)
+    {
+        if (job->id < id + n && id < job->id + job->n)
+        {
+            file->stats.num_async_waits++;
+            pthread_cond_wait(&file->flush_cond, &file->flush_mutex);
+            job = file->flush_head;
+            continue;
+        }
+        job = job->next;
+    }
+    pthread_mutex_unlock(&file->flush_mutex);
+}
+
+/* Start the flush thread. If it cannot be started, flush synchronously. */
+static void start_flush_thread(H5FD_silo_t *file)
+{
+    if (pthread_mutex_init(&file->flush_mutex, 0) != 0)
+    {
+        file->async_flush = 0;
+        return;
+    }
+    pthread_cond_init(&file->flush_cond, 0);
+    if (pthread_create(&file->flush_thread, 0, flush_thread_main, file) != 0)
+    {
+        pthread_cond_destroy(&file->flush_cond);
+        pthread_mutex_destroy(&file->flush_mutex);
+        file->async_flush = 0;
+    }
+}
+
+/* Drain the queue, stop the flush thread and return the first errno any
+   of its writes failed with. */
+static int stop_flush_thread(H5FD_silo_t *file)
+{
+    pthread_mutex_lock(&file->flush_mutex);
+    file->flush_quit = 1;
+    pthread_cond_broadcast(&file->flush_cond);
+    pthread_mutex_unlock(&file->flush_mutex);
+    pthread_join(file->flush_thread, 0);
+    pthread_cond_destroy(&file->flush_cond);
+    pthread_mutex_destroy(&file->flush_mutex);
+    file->async_flush = 0;
+    return file->flush_errno;
+}
+#endif
+
+static herr_t free_block_by_index(H5FD_silo_t *file, int blidx);
+
+/*
+ * Evict blocks from the files sharing the pool until nbytes more fit
+ * within its budget. Blocks come from whichever file holds the most, so
+ * a file in active use can take memory from idle ones and files in use
+ * together settle on roughly equal shares. Fails if a dirty block could
+ * not be written.
+ */
+static herr_t make_room_in_pool(hsize_t nbytes)
+{
+    while (1)
+    {
+        H5FD_silo_t *f, *victim = 0;
+        hsize_t used = 0, most = 0;
+
+        for (f = silo_vfd_pool.files; f; f = f->pool_next)
+        {
+            hsize_t held = (hsize_t) f->num_blocks * f->block_size;
+            used += held;
+            if (f->num_blocks > 1 && held > most)
+            {
+                most = held;
+                victim = f;
+            }
+        }
+        if (used + nbytes <= silo_vfd_pool.budget || !victim)
+            break;
+        if (free_block_by_index(victim, find_block_to_preempt(victim)) < 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+/* Change the pool's budget, evicting blocks if it shrinks */
+static herr_t set_pool_budget(hsize_t nbytes)
+{
+    H5FD_silo_t *f;
+
+    silo_vfd_pool.budget = nbytes;
+    for (f = silo_vfd_pool.files; f; f = f->pool_next)
+    {
+        f->max_blocks = blocks_in_budget(nbytes, f->block_size);
+        ghost_resize(f);
+    }
+    return make_room_in_pool(0);
+}
+
+/*
+ * Bring the blocks with ids [id,id+n) that are not in memory into memory,
+ * pre-empting other blocks to make room. Runs of consecutive blocks are
+ * read from the file with a single read. Blocks that the caller will
+ * overwrite entirely, [skip0,skip1), are not read at all. Returns the
+ * index of the block with the given id, or -1 if a dirty block could not
+ * be written to make room.
+ */
+static int alloc_blocks_by_id(H5FD_silo_t *file, hsize_t id, int n,
+    hsize_t skip0, hsize_t skip1)
+{
+    int i, blidx, nread;
+    haddr_t eof;
+
+    while (file->num_blocks + n > file->max_blocks)
+    {
+        int tmpblidx = find_block_to_preempt(file);
+        if (tmpblidx < 0) break;
+        if (free_block_by_index(file, tmpblidx) < 0)
+            return -1;
+    }
+    if (file->shared_cache && make_room_in_pool((hsize_t) n * file->block_size) < 0)
+        return -1;
+
+#ifdef SILO_VFD_ASYNC_FLUSH
+    if (file->async_flush)
+        wait_for_flush(file, id, n);
+#endif
+    FLUSH_LOCK(file);
+    eof = file->file_eof;
+    FLUSH_UNLOCK(file);
+
+    for (i = 0; i < n; i++)
+        alloc_block_by_id(file, id + i);
+    blidx = find_block_by_id(file, id, EXACT);
+
+    /* read the blocks holding file data, in runs, zeroing the rest */
+    for (i = 0, nread = 0; i <= n; i++)
+    {
+        int need = 0;
+        if (i < n)
+        {
+            hsize_t bid = id + i;
+            int skip = bid >= skip0 && bid < skip1;
+            if (!skip && bid * file->block_size < eof)
+                need = 1;
+            else if (!skip)
+                memset(file->block_list[blidx+i].buf, 0, file->block_size);
+        }
+        if (need)
+        {
+            nread++;
+            continue;
+        }
+        if (nread)
+            file_read_blocks(file, blidx + i - nread, nread);
+        nread = 0;
+    }
+
+    return blidx;
+}
+
+/*
+ * Bring the block with the given id, and as many of the missing blocks
+ * following it up to id1 as will fit in a single read, into memory.
+ */
+static int fetch_blocks_by_id(H5FD_silo_t *file, hsize_t id, hsize_t id1,
+    hsize_t skip0, hsize_t skip1)
+{
+    int n = 1, maxn = MIN(MAX(file->max_blocks / 2, 1), MAX_BLOCKS_PER_IO);
+
+    while (n < maxn && id + n <= id1 && find_block_by_id(file, id + n, EXACT) < 0)
+        n++;
+
+    return alloc_blocks_by_id(file, id, n, skip0, skip1);
+}
+
 static herr_t free_block_by_index(H5FD_silo_t *file, int blidx)
 {
     silo_vfd_block_t *b;
@@ -1137,13 +2499,127 @@ static herr_t free_block_by_index(H5FD_silo_t *file, int blidx)
     HDassert(b->buf);
 
     if (b->dirty)
-        file_write_block(file, blidx);
+    {
+        int first, n;
+#ifdef SILO_VFD_ASYNC_FLUSH
+        if (file->async_flush)
+            return queue_block_run(file, blidx);
+#endif
+        n = block_run_bounds(file, blidx, &first);
+        if (file_write_blocks(file, first, n) < 0)
+            return -1;
+    }
 
     free(b->buf);
 
     remove_block_by_index(file, blidx);
 
-    return 0;
+    return 0;
+}
+
+/*
+ * Service a read miss on block id for a request ending at block id1,
+ * reading ahead when the misses show a pattern. HDF5 interleaves a scan
+ * of the file with lookups elsewhere (b-trees, heaps), so a few streams
+ * of misses are tracked at once. A miss that continues a stream reads
+ * through a window past id1 that doubles with each sequential miss, up to
+ * a quarter of the block count, in the same read as the miss itself. No
+ * more than a quarter of the blocks are ever waiting unused, and a window
+ * is halved whenever one of its blocks is evicted unused. Misses
+ * at a constant stride, and the window after a sequential one, are passed
+ * to the kernel as hints so it can fetch them while the caller works.
+ * Returns the index of block id, or -1 if room could not be made for it.
+ */
+static int read_ahead_by_id(H5FD_silo_t *file, hsize_t id, hsize_t id1)
+{
+    silo_vfd_read_ahead_t *ra = 0;
+    int i, blidx, s, maxwin = MAX(file->max_blocks / 4, 1);
+    hsize_t lastid = id1, eofid;
+
+    FLUSH_LOCK(file);
+    eofid = file->file_eof / file->block_size;
+    FLUSH_UNLOCK(file);
+
+    /* find the stream this miss continues */
+    for (s = 0; s < MAX_READ_AHEAD_STREAMS && !ra; s++)
+    {
+        if (id > 0 && id == file->ra[s].next)
+        {
+            ra = &(file->ra[s]);
+            ra->window = ra->window ? MIN(2 * ra->window, maxwin) : 1;
+            ra->stride = 0;
+            lastid = id1 + MIN(ra->window * (id1 - id + 1), MAX(maxwin - file->num_prefetched, 0));
+            lastid = MAX(id1, MIN(lastid, eofid));
+        }
+        else if (file->ra[s].stride && id == file->ra[s].last + file->ra[s].stride)
+        {
+            ra = &(file->ra[s]);
+            ra->window = ra->window ? MIN(2 * ra->window, maxwin) : 1;
+        }
+    }
+
+    /* or else start a new one, replacing the least recently used stream.
+       A second miss on a stream that has no pattern yet sets its stride. */
+    if (!ra)
+    {
+        silo_vfd_read_ahead_t *mru = &(file->ra[0]);
+        ra = &(file->ra[0]);
+        for (s = 1; s < MAX_READ_AHEAD_STREAMS; s++)
+        {
+            if (file->ra[s].age < ra->age) ra = &(file->ra[s]);
+            if (file->ra[s].age > mru->age) mru = &(file->ra[s]);
+        }
+        if (!mru->window && id > mru->last + 1)
+        {
+            ra = mru;
+            ra->stride = id - ra->last;
+        }
+        else
+            ra->stride = 0;
+        ra->window = 0;
+    }
+    s = (int) (ra - file->ra);
+    ra->last = id;
+    ra->age = file->op_counter;
+
+    blidx = fetch_blocks_by_id(file, id, lastid, 0, 0);
+    if (blidx < 0)
+        return -1;
+
+    /* mark the blocks just read beyond the request */
+    ra->next = id1 + 1;
+    for (i = blidx; i < file->num_blocks && file->block_list[i].id <= lastid; i++)
+    {
+        silo_vfd_block_t *b = &(file->block_list[i]);
+        if (b->id != id + (i - blidx) || b->age < file->block_list[blidx].age) break;
+        if (b->id <= id1) continue;
+        b->prefetched = s + 1;
+        file->num_prefetched++;
+        file->stats.num_prefetched_blocks++;
+        ra->next = b->id + 1;
+    }
+
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_WILLNEED)
+    /* with direct I/O, hints would only fill the page cache we bypass;
+       in multi-writer mode, block ids are not file offsets */
+    if (file->use_direct || file->mw_writer >= 0)
+        ;
+    else if (ra->window && !ra->stride)
+    {
+        posix_fadvise(file->fd, (file_offset_t) (ra->next * file->block_size),
+            (file_offset_t) (ra->window * file->block_size), POSIX_FADV_WILLNEED);
+        file->stats.num_readahead_hints++;
+    }
+    else if (ra->window)
+    {
+        for (i = 1; i <= ra->window && id + i * ra->stride < eofid; i++)
+            posix_fadvise(file->fd, (file_offset_t) ((id + i * ra->stride) * file->block_size),
+                (file_offset_t) file->block_size, POSIX_FADV_WILLNEED);
+        file->stats.num_readahead_hints++;
+    }
+#endif
+
+    return blidx;
 }
 
 /*-------------------------------------------------------------------------
@@ -1230,6 +2706,12 @@ H5Pset_fapl_silo(hid_t fapl_id)
     int default_block_count = H5FD_SILO_DEFAULT_BLOCK_COUNT;
     int default_log_stats = H5FD_SILO_DEFAULT_LOG_STATS;
     int default_use_direct = H5FD_SILO_DEFAULT_USE_DIRECT;
+    int default_async_flush = H5FD_SILO_DEFAULT_ASYNC_FLUSH;
+    int default_meta_at_end = H5FD_SILO_DEFAULT_META_AT_END;
+    hsize_t default_cache_bytes = H5FD_SILO_DEFAULT_CACHE_BYTES;
+    int default_shared_cache = H5FD_SILO_DEFAULT_SHARED_CACHE;
+    int default_nwriters = H5FD_SILO_DEFAULT_NWRITERS;
+    int default_writer = H5FD_SILO_DEFAULT_WRITER;
 
     H5Eclear2(H5E_DEFAULT);
 
@@ -1244,6 +2726,18 @@ H5Pset_fapl_silo(hid_t fapl_id)
         H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTINSERT, "can't insert " SILO_LOGSTS_PROPNAME, -1, -1)
     if (H5Pinsert(fapl_id, SILO_USEDIR_PROPNAME, sizeof(int), &default_use_direct, 0, 0, 0, 0, 0) < 0)
         H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTINSERT, "can't insert " SILO_USEDIR_PROPNAME, -1, -1)
+    if (H5Pinsert(fapl_id, SILO_ASYNC_PROPNAME, sizeof(int), &default_async_flush, 0, 0, 0, 0, 0) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTINSERT, "can't insert " SILO_ASYNC_PROPNAME, -1, -1)
+    if (H5Pinsert(fapl_id, SILO_METEND_PROPNAME, sizeof(int), &default_meta_at_end, 0, 0, 0, 0, 0) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTINSERT, "can't insert " SILO_METEND_PROPNAME, -1, -1)
+    if (H5Pinsert(fapl_id, SILO_CBYTES_PROPNAME, sizeof(hsize_t), &default_cache_bytes, 0, 0, 0, 0, 0) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTINSERT, "can't insert " SILO_CBYTES_PROPNAME, -1, -1)
+    if (H5Pinsert(fapl_id, SILO_SHARED_PROPNAME, sizeof(int), &default_shared_cache, 0, 0, 0, 0, 0) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTINSERT, "can't insert " SILO_SHARED_PROPNAME, -1, -1)
+    if (H5Pinsert(fapl_id, SILO_NWRITERS_PROPNAME, sizeof(int), &default_nwriters, 0, 0, 0, 0, 0) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTINSERT, "can't insert " SILO_NWRITERS_PROPNAME, -1, -1)
+    if (H5Pinsert(fapl_id, SILO_WRITER_PROPNAME, sizeof(int), &default_writer, 0, 0, 0, 0, 0) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTINSERT, "can't insert " SILO_WRITER_PROPNAME, -1, -1)
 
     if (H5Pset(fapl_id, SILO_BLKSZ_PROPNAME, &default_block_size) < 0)
         H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_BLKSZ_PROPNAME, -1, -1)
@@ -1253,6 +2747,18 @@ H5Pset_fapl_silo(hid_t fapl_id)
         H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_LOGSTS_PROPNAME, -1, -1)
     if (H5Pset(fapl_id, SILO_USEDIR_PROPNAME, &default_use_direct) < 0)
         H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_USEDIR_PROPNAME, -1, -1)
+    if (H5Pset(fapl_id, SILO_ASYNC_PROPNAME, &default_async_flush) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_ASYNC_PROPNAME, -1, -1)
+    if (H5Pset(fapl_id, SILO_METEND_PROPNAME, &default_meta_at_end) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_METEND_PROPNAME, -1, -1)
+    if (H5Pset(fapl_id, SILO_CBYTES_PROPNAME, &default_cache_bytes) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_CBYTES_PROPNAME, -1, -1)
+    if (H5Pset(fapl_id, SILO_SHARED_PROPNAME, &default_shared_cache) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_SHARED_PROPNAME, -1, -1)
+    if (H5Pset(fapl_id, SILO_NWRITERS_PROPNAME, &default_nwriters) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_NWRITERS_PROPNAME, -1, -1)
+    if (H5Pset(fapl_id, SILO_WRITER_PROPNAME, &default_writer) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_WRITER_PROPNAME, -1, -1)
 
     return H5Pset_driver(fapl_id, H5FD_SILO, NULL);
 }
@@ -1310,6 +2816,138 @@ H5Pset_silo_use_direct(hid_t fapl_id, int used)
     return ret_value;
 }
 
+herr_t
+H5Pset_silo_async_flush(hid_t fapl_id, int async)
+{
+    static const char *func="H5Pset_silo_async_flush";
+    herr_t ret_value = 0;
+
+    /* Clear the error stack */
+    H5Eclear2(H5E_DEFAULT);
+
+    if(0 == H5Pisa_class(fapl_id, H5P_FILE_ACCESS))
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_BADTYPE, "not a file access property list", -1, -1)
+    if (H5Pset(fapl_id, SILO_ASYNC_PROPNAME, &async) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_ASYNC_PROPNAME, -1, -1)
+
+    return ret_value;
+}
+
+herr_t
+H5Pset_silo_meta_at_end(hid_t fapl_id, int meta_at_end)
+{
+    static const char *func="H5Pset_silo_meta_at_end";
+    herr_t ret_value = 0;
+
+    /* Clear the error stack */
+    H5Eclear2(H5E_DEFAULT);
+
+    if(0 == H5Pisa_class(fapl_id, H5P_FILE_ACCESS))
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_BADTYPE, "not a file access property list", -1, -1)
+    if (H5Pset(fapl_id, SILO_METEND_PROPNAME, &meta_at_end) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_METEND_PROPNAME, -1, -1)
+
+    return ret_value;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_silo_cache_budget
+ *
+ * Purpose:	Limit the memory the silo VFD holds in blocks to NBYTES
+ *		rather than a fixed block count. If SHARED is non-zero, the
+ *		file draws its blocks from one pool shared by all open
+ *		files that also set SHARED and a non-zero NBYTES becomes the
+ *		budget of that pool. A zero NBYTES keeps the budget implied
+ *		by the block count (or, if SHARED, the pool's current one).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_silo_cache_budget(hid_t fapl_id, hsize_t nbytes, int shared)
+{
+    static const char *func="H5Pset_silo_cache_budget";
+    herr_t ret_value = 0;
+
+    /* Clear the error stack */
+    H5Eclear2(H5E_DEFAULT);
+
+    if(0 == H5Pisa_class(fapl_id, H5P_FILE_ACCESS))
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_BADTYPE, "not a file access property list", -1, -1)
+    if (H5Pset(fapl_id, SILO_CBYTES_PROPNAME, &nbytes) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_CBYTES_PROPNAME, -1, -1)
+    if (H5Pset(fapl_id, SILO_SHARED_PROPNAME, &shared) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_SHARED_PROPNAME, -1, -1)
+
+    return ret_value;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_silo_multi_writer
+ *
+ * Purpose:	Make the file one of NWRITERS independent HDF5 files
+ *		sharing a single physical file, this being the one numbered
+ *		WRITER. Each writer owns a disjoint set of the physical
+ *		file's blocks. Readers select a writer the same way;
+ *		NWRITERS may be zero then. A negative WRITER means an
+ *		ordinary file.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_silo_multi_writer(hid_t fapl_id, int nwriters, int writer)
+{
+    static const char *func="H5Pset_silo_multi_writer";
+    herr_t ret_value = 0;
+
+    /* Clear the error stack */
+    H5Eclear2(H5E_DEFAULT);
+
+    if(0 == H5Pisa_class(fapl_id, H5P_FILE_ACCESS))
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_BADTYPE, "not a file access property list", -1, -1)
+    if (writer >= 0 && nwriters > 0 && writer >= nwriters)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_ARGS, H5E_BADVALUE, "writer >= nwriters", -1, -1)
+    if (H5Pset(fapl_id, SILO_NWRITERS_PROPNAME, &nwriters) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_NWRITERS_PROPNAME, -1, -1)
+    if (H5Pset(fapl_id, SILO_WRITER_PROPNAME, &writer) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTSET, "can't set " SILO_WRITER_PROPNAME, -1, -1)
+
+    return ret_value;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_silo_set_shared_cache_budget
+ *
+ * Purpose:	Change the budget of the block pool shared by open files
+ *		now. Shrinking it evicts blocks, writing those that are
+ *		dirty, so this is also a way to give back the memory held by
+ *		the cache. Files opened later with a shared cache and a
+ *		non-zero budget of their own change it again.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_silo_set_shared_cache_budget(hsize_t nbytes)
+{
+    static const char *func="H5FD_silo_set_shared_cache_budget";
+    herr_t ret_value = 0, status;
+
+    /* Clear the error stack */
+    H5Eclear2(H5E_DEFAULT);
+
+    if (nbytes == 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_ARGS, H5E_BADVALUE, "zero cache budget", -1, -1)
+    POOL_LOCK();
+    status = set_pool_budget(nbytes);
+    POOL_UNLOCK();
+    if (status < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't write evicted blocks", -1, -1)
+
+    return ret_value;
+}
+
 /*-------------------------------------------------------------------------
  * Function:	H5FD_silo_sb_size
  *
@@ -1363,8 +3001,9 @@ H5FD_silo_sb_encode(H5FD_t *_file, char *name/*out*/,
 
     H5Eclear2(H5E_DEFAULT);
 
-    /* Name and version number */
-    strncpy(name, "LLNLsilo", (size_t)8);
+    /* Name and version number; older readers must not mistake a
+       meta_at_end file for an ordinary one */
+    strncpy(name, file->meta_at_end ? META_AT_END_MAGIC : "LLNLsilo", (size_t)8);
     name[8] = '\0';
 
     /* Encode block size into sb */
@@ -1401,11 +3040,17 @@ H5FD_silo_sb_decode(H5FD_t *_file, const char *name, const unsigned char *buf)
     H5Eclear2(H5E_DEFAULT);
 
     /* Make sure the name/version number is correct */
-    if (strcmp(name, "LLNLsilo"))
+    if (strcmp(name, "LLNLsilo") && strcmp(name, META_AT_END_MAGIC))
     {
         H5Epush_ret(func, H5E_ERR_CLS, H5E_FILE, H5E_BADVALUE, "invalid silo superblock", -1) ;
     }
 
+    /* A meta_at_end file without its footer was never closed */
+    if (!strcmp(name, META_AT_END_MAGIC) && !file->meta_at_end)
+    {
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_FILE, H5E_TRUNCATED, "silo file with metadata at end was not closed", -1) ;
+    }
+
     buf += 8;
     /* Decode block size */
     assert(sizeof(hsize_t)<=8);
@@ -1467,6 +3112,13 @@ H5FD_silo_open( const char *name, unsigned flags, hid_t fapl_id,
     hsize_t silo_block_size = H5FD_SILO_DEFAULT_BLOCK_SIZE;
     int     silo_log_stats = H5FD_SILO_DEFAULT_LOG_STATS;
     int     silo_use_direct = H5FD_SILO_DEFAULT_USE_DIRECT;
+    int     silo_async_flush = H5FD_SILO_DEFAULT_ASYNC_FLUSH;
+    int     silo_meta_at_end = H5FD_SILO_DEFAULT_META_AT_END;
+    hsize_t silo_cache_bytes = H5FD_SILO_DEFAULT_CACHE_BYTES;
+    hsize_t pool_budget = 0;
+    int     silo_shared_cache = H5FD_SILO_DEFAULT_SHARED_CACHE;
+    int     silo_nwriters = H5FD_SILO_DEFAULT_NWRITERS;
+    int     silo_writer = H5FD_SILO_DEFAULT_WRITER;
     H5FD_t *ret_value = 0;
     mode_t mode;
 
@@ -1497,15 +3149,30 @@ H5FD_silo_open( const char *name, unsigned flags, hid_t fapl_id,
         H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTGET, "can't get " SILO_LOGSTS_PROPNAME, 0, -1)
     if (H5Pget(fapl_id, SILO_USEDIR_PROPNAME, &silo_use_direct) < 0)
         H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTGET, "can't get " SILO_USEDIR_PROPNAME, 0, -1)
+    if (H5Pget(fapl_id, SILO_ASYNC_PROPNAME, &silo_async_flush) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTGET, "can't get " SILO_ASYNC_PROPNAME, 0, -1)
+    if (H5Pget(fapl_id, SILO_METEND_PROPNAME, &silo_meta_at_end) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTGET, "can't get " SILO_METEND_PROPNAME, 0, -1)
+    if (H5Pget(fapl_id, SILO_CBYTES_PROPNAME, &silo_cache_bytes) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTGET, "can't get " SILO_CBYTES_PROPNAME, 0, -1)
+    if (H5Pget(fapl_id, SILO_SHARED_PROPNAME, &silo_shared_cache) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTGET, "can't get " SILO_SHARED_PROPNAME, 0, -1)
+    if (H5Pget(fapl_id, SILO_NWRITERS_PROPNAME, &silo_nwriters) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTGET, "can't get " SILO_NWRITERS_PROPNAME, 0, -1)
+    if (H5Pget(fapl_id, SILO_WRITER_PROPNAME, &silo_writer) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_PLIST, H5E_CANTGET, "can't get " SILO_WRITER_PROPNAME, 0, -1)
+
+#ifndef SILO_VFD_MULTI_WRITER
+    if (silo_writer >= 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_ARGS, H5E_UNSUPPORTED, "multi-writer mode not available on this platform", NULL, -1)
+#endif
 
-    /* Build the open flags */
+    /* Build the open flags; writers sharing a file must not truncate or
+       refuse it just because another writer got there first */
     o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
-    if (H5F_ACC_TRUNC & flags) o_flags |= O_TRUNC;
+    if ((H5F_ACC_TRUNC & flags) && silo_writer < 0) o_flags |= O_TRUNC;
     if (H5F_ACC_CREAT & flags) o_flags |= O_CREAT;
-    if (H5F_ACC_EXCL & flags) o_flags |= O_EXCL;
-#ifdef O_DIRECT
-    if (silo_use_direct) o_flags |= O_DIRECT;
-#endif
+    if ((H5F_ACC_EXCL & flags) && silo_writer < 0) o_flags |= O_EXCL;
 #ifdef _WIN32
     mode = _S_IWRITE | _S_IREAD;
 #else
@@ -1531,21 +3198,44 @@ H5FD_silo_open( const char *name, unsigned flags, hid_t fapl_id,
         close(fd);
         H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_NOSPACE, "calloc failed", NULL, errno)
     }
-    if(NULL == (file->block_list = (silo_vfd_block_t *)calloc((size_t)silo_block_count, sizeof(silo_vfd_block_t))))
+
+    /* A byte budget, or a shared one, replaces the fixed block count. The
+       pool itself changes only once the file joins it, below. */
+    if (silo_shared_cache)
+    {
+        POOL_LOCK();
+        if (silo_cache_bytes)
+            pool_budget = silo_cache_bytes;
+        else if (silo_vfd_pool.budget)
+            pool_budget = silo_vfd_pool.budget;
+        else
+            pool_budget = silo_block_size * silo_block_count;
+        POOL_UNLOCK();
+        file->max_blocks = blocks_in_budget(pool_budget, silo_block_size);
+    }
+    else if (silo_cache_bytes)
+        file->max_blocks = blocks_in_budget(silo_cache_bytes, silo_block_size);
+    else
+        file->max_blocks = silo_block_count;
+
+    file->list_size = MIN(file->max_blocks, 1024);
+    if(NULL == (file->block_list = (silo_vfd_block_t *)calloc((size_t)file->list_size, sizeof(silo_vfd_block_t))))
     {
         close(fd);
         free(file);
         H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_NOSPACE, "calloc failed", NULL, errno)
     }
+    file->two_q = silo_shared_cache || silo_cache_bytes;
+    ghost_resize(file);
 
     file->fd = fd;
+    file->mw_writer = -1;
     file->file_eof = (haddr_t)sb.st_size;
     file->eof = (haddr_t)sb.st_size;
     file->pos = HADDR_UNDEF;
     file->op = OP_UNKNOWN;
     file->write_access = write_access;
     file->block_size = silo_block_size;
-    file->max_blocks = silo_block_count;
     file->log_stats = silo_log_stats;
     if (silo_log_stats)
     {
@@ -1553,6 +3243,7 @@ H5FD_silo_open( const char *name, unsigned flags, hid_t fapl_id,
         if (NULL == (file->log_name = (char*) malloc(strlen(name)+strlen(ext)+1)))
         {
             close(file->fd);
+            free(file->ghost);
             free(file->block_list);
             free(file);
             H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_NOSPACE, "malloc failed", NULL, errno)
@@ -1560,6 +3251,93 @@ H5FD_silo_open( const char *name, unsigned flags, hid_t fapl_id,
         sprintf(file->log_name, "%s%s", name, ext);
     }
 
+    /* New files written with meta_at_end get a raw data address range
+       of their own, starting past room for the superblock copy. Existing
+       files are in that mode if they end with its footer. Neither applies
+       to multi-writer files, which only open through a writer. */
+    if (silo_writer >= 0 || is_multi_writer_file(file, (haddr_t) sb.st_size))
+    {
+#ifdef SILO_VFD_MULTI_WRITER
+        if (silo_writer < 0 || mw_open(file, flags, silo_nwriters, silo_writer) < 0)
+#endif
+        {
+            close(file->fd);
+            free(file->mw_segs);
+            free(file->log_name);
+            free(file->ghost);
+            free(file->block_list);
+            free(file);
+            if (silo_writer < 0)
+                H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_FILE, H5E_CANTOPENFILE, "multi-writer silo file; select a writer with DBOPT_H5_SILO_WRITER", NULL, -1)
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_FILE, H5E_CANTOPENFILE, "can't open multi-writer silo file", NULL, -1)
+        }
+    }
+    else if (silo_meta_at_end && write_access && sb.st_size == 0)
+    {
+        file->meta_at_end = 1;
+        file->raw_base = META_AT_END_RAW_BASE;
+        file->raw_offset = (META_AT_END_HEAD_SIZE + silo_block_size - 1) / silo_block_size * silo_block_size;
+        file->eoa = file->raw_offset;
+    }
+    else if (load_meta_at_end(file, (haddr_t) sb.st_size) < 0)
+    {
+        close(file->fd);
+        free(file->meta_buf);
+        free(file->log_name);
+        free(file->ghost);
+        free(file->block_list);
+        free(file);
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_FILE, H5E_CANTOPENFILE, "can't read silo metadata at end of file", NULL, -1)
+    }
+    else if (file->meta_at_end)
+    {
+        /* old metadata gets overwritten by raw data appended at eoa */
+        file->eof = file->eoa;
+    }
+
+#ifdef SILO_VFD_DIRECT
+    /* Whole blocks move through a second, O_DIRECT descriptor when block
+       size permits. Anything unaligned, and everything if the filesystem
+       refuses O_DIRECT, goes through the ordinary descriptor. */
+    if (silo_use_direct)
+    {
+        long pagesize = sysconf(_SC_PAGESIZE);
+        file->align = pagesize > 0 ? (size_t) pagesize : 4096;
+        if (silo_block_size % file->align == 0 &&
+            (file->dfd = HDopen(name, (o_flags & ~(O_CREAT|O_TRUNC|O_EXCL)) | O_DIRECT, mode)) >= 0)
+            file->use_direct = 1;
+    }
+#endif
+
+    OPEN_FILES_LOCK();
+    file->open_next = silo_vfd_open_files;
+    silo_vfd_open_files = file;
+    OPEN_FILES_UNLOCK();
+
+    /* join the shared pool; a new budget applies to every file in it */
+    if (silo_shared_cache)
+    {
+        POOL_LOCK();
+        file->shared_cache = 1;
+        file->pool_next = silo_vfd_pool.files;
+        silo_vfd_pool.files = file;
+        if (!silo_cache_bytes && silo_vfd_pool.budget)
+            pool_budget = silo_vfd_pool.budget;
+        /* a block that can't be written stays dirty in its own file,
+           which reports the error when it next evicts or closes */
+        (void) set_pool_budget(pool_budget);
+        POOL_UNLOCK();
+    }
+
+#ifdef SILO_VFD_ASYNC_FLUSH
+    /* start the background flush thread; only writers need one */
+    if (silo_async_flush && write_access)
+    {
+        file->async_flush = 1;
+        start_flush_thread(file);
+    }
+#endif
+
     /* The unique key */
     {
 #ifdef _WIN32
@@ -1607,38 +3385,88 @@ H5FD_silo_close(H5FD_t *_file)
     H5FD_silo_t	*file = (H5FD_silo_t*)_file;
     static const char *func="H5FD_silo_close";  /* Function Name for error reporting */
     herr_t ret_value = 0;
+    int i, data_failed = 0, meta_failed = 0, mw_failed = 0;
 
     /* Clear the error stack */
     H5Eclear2(H5E_DEFAULT);
 
+    OPEN_FILES_LOCK();
+    {
+        H5FD_silo_t **f = &silo_vfd_open_files;
+        while (*f && *f != file)
+            f = &((*f)->open_next);
+        if (*f)
+            *f = file->open_next;
+    }
+    OPEN_FILES_UNLOCK();
+
+#ifdef SILO_VFD_ASYNC_FLUSH
+    /* wait for the flush thread to finish queued writes */
+    if (file->async_flush && (errno = stop_flush_thread(file)) != 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "background write failed", -1, errno)
+#endif
+
+    /* other pool members may evict our blocks until we leave the pool */
+    if (file->shared_cache)
+        POOL_LOCK();
+
     /* write any dirty blocks to file */
     if (file->write_access)
     {
-        int i;
+        int n;
 
-        /* sort blocks by increasing block id */
-        silo_vfd_pair_t *sorted_pairs = (silo_vfd_pair_t*) malloc(file->num_blocks*sizeof(silo_vfd_pair_t));
-        for (i = 0; i < file->num_blocks; i++)
+        /* block list is kept sorted by id; write runs of consecutive dirty blocks */
+        for (i = 0; i < file->num_blocks; i += n)
         {
-            sorted_pairs[i].i = i;
-            sorted_pairs[i].id = file->block_list[i].id; 
+            silo_vfd_block_t *bl = file->block_list;
+            n = 1;
+            if (bl[i].dirty)
+            {
+                while (i + n < file->num_blocks && n < MAX_BLOCKS_PER_IO &&
+                       bl[i+n].dirty && bl[i+n].id == bl[i+n-1].id + 1)
+                    n++;
+                if (file_write_blocks(file, i, n) < 0)
+                    data_failed = 1;
+            }
         }
-        qsort(sorted_pairs, file->num_blocks, sizeof(silo_vfd_pair_t), compare_silo_vfd_pairs);
 
-        /* write the blocks, freeing as we go along */
-        for (i = 0; i < file->num_blocks; i++)
-        {
-            silo_vfd_block_t *b = &(file->block_list[sorted_pairs[i].i]);
-            if (!(b->buf)) continue;
-            if (b->dirty) file_write_block(file, sorted_pairs[i].i);
-            free(b->buf);
-        }
-        free(sorted_pairs);
+        /* metadata goes in only after all the raw data */
+        if (file->meta_at_end)
+            meta_failed = write_meta_at_end(file) < 0;
+#ifdef SILO_VFD_MULTI_WRITER
+        if (file->mw_writer >= 0 && file->mw_dirty)
+            mw_failed = mw_close(file) < 0;
+#endif
+    }
+    for (i = 0; i < file->num_blocks; i++)
+        free(file->block_list[i].buf);
+    free(file->meta_buf);
+    free(file->mw_segs);
+    free(file->ghost);
+
+    /* leave the shared pool; its budget goes with its last file */
+    if (file->shared_cache)
+    {
+        H5FD_silo_t **f = &silo_vfd_pool.files;
+        while (*f != file)
+            f = &((*f)->pool_next);
+        *f = file->pool_next;
+        if (!silo_vfd_pool.files)
+            silo_vfd_pool.budget = 0;
+        POOL_UNLOCK();
     }
 
     errno = 0;
+    if (file->use_direct)
+        close(file->dfd);
     if (close(file->fd) < 0)
         H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_CLOSEERROR, "close failed", -1, errno)
+    if (data_failed)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't write cached blocks", -1, -1)
+    if (meta_failed)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't write metadata at end of file", -1, -1)
+    if (mw_failed)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't write multi-writer index", -1, -1)
 
     if (file->log_stats)
     {
@@ -1648,7 +3476,14 @@ H5FD_silo_close(H5FD_t *_file)
         FILE* logf = fopen(file->log_name, "w");
         fprintf(logf, "======== Interactions between the VFD and the filesystem ========\n");
         fprintf(logf, "block size = %llu\n", (long long unsigned) file->block_size);
-        fprintf(logf, "block count = %d\n", file->max_blocks);
+        fprintf(logf, "block count = %d%s\n", file->max_blocks, file->shared_cache ? " (shared cache)" : "");
+        fprintf(logf, "direct I/O = %s\n", file->use_direct ? "on" : "off");
+        fprintf(logf, "metadata at end = %s\n", file->meta_at_end ? "on" : "off");
+        if (file->meta_at_end)
+            fprintf(logf, "metadata bytes = %llu\n", (long long unsigned) file->meta_eoa);
+        if (file->mw_writer >= 0)
+            fprintf(logf, "multi-writer = writer %d of %d (%llu segments)\n", file->mw_writer, file->mw_nwriters,
+                (long long unsigned) file->mw_nsegs);
         fprintf(logf, "\n");
         fprintf(logf, "max block id = %llu\n", (long long unsigned) file->stats.max_block_id);
         fprintf(logf, "max blocks in mem = %llu\n", (long long unsigned) file->stats.max_blocks_in_mem);
@@ -1657,12 +3492,30 @@ H5FD_silo_close(H5FD_t *_file)
         fprintf(logf, "\n");
         fprintf(logf, "number of multi-block writes = %llu\n", (long long unsigned) file->stats.num_multiblock_writes);
         fprintf(logf, "number of multi-block reads = %llu\n", (long long unsigned) file->stats.num_multiblock_reads);
+        fprintf(logf, "number of coalesced block writes = %llu (%llu blocks)\n", (long long unsigned) file->stats.num_coalesced_writes,
+            (long long unsigned) file->stats.num_coalesced_write_blocks);
+        fprintf(logf, "number of coalesced block reads = %llu (%llu blocks)\n", (long long unsigned) file->stats.num_coalesced_reads,
+            (long long unsigned) file->stats.num_coalesced_read_blocks);
+        if (file->use_direct)
+            fprintf(logf, "number of direct I/O calls = %llu (%llu unaligned through page cache)\n",
+                (long long unsigned) file->stats.num_direct_io, (long long unsigned) file->stats.num_unaligned_io);
+        fprintf(logf, "number of background block writes = %llu (%llu blocks, %llu waits)\n", (long long unsigned) file->stats.num_async_writes,
+            (long long unsigned) file->stats.num_async_write_blocks, (long long unsigned) file->stats.num_async_waits);
+        fprintf(logf, "\n");
+        fprintf(logf, "number of block read hits = %llu\n", (long long unsigned) file->stats.num_block_hits);
+        fprintf(logf, "number of block read misses = %llu\n", (long long unsigned) file->stats.num_block_misses);
+        fprintf(logf, "number of block evictions = %llu\n", (long long unsigned) file->stats.num_block_evictions);
+        fprintf(logf, "number of blocks read ahead = %llu (%llu used, %llu evicted unused)\n", (long long unsigned) file->stats.num_prefetched_blocks,
+            (long long unsigned) file->stats.num_prefetch_hits, (long long unsigned) file->stats.num_prefetch_wasted);
+        fprintf(logf, "number of read ahead hints = %llu\n", (long long unsigned) file->stats.num_readahead_hints);
+        fprintf(logf, "number of blocks missed again soon after eviction = %llu\n", (long long unsigned) file->stats.num_ghost_hits);
         fprintf(logf, "\n");
         fprintf(logf, "number of blocks majority md = %llu\n", (long long unsigned) file->stats.num_blocks_majority_md);
         fprintf(logf, "number of blocks majority raw = %llu\n", (long long unsigned) file->stats.num_blocks_majority_raw);
         fprintf(logf, "\n");
         fprintf(logf, "number of writes = %llu\n", (long long unsigned) file->stats.total_write_count);
         fprintf(logf, "number of bytes written = %llu\n", (long long unsigned) file->stats.total_write_bytes);
+        fprintf(logf, "time in writes = %g seconds\n", file->stats.total_time_in_writes);
         fprintf(logf, "\n");
         fprintf(logf, "number of times a raw block was written = %llu\n", (long long unsigned) file->stats.total_block_raw_writes);
         fprintf(logf, "number of times a raw block was written more than once = %llu\n", (long long unsigned) file->stats.total_block_raw_re_writes);
@@ -1672,6 +3525,7 @@ H5FD_silo_close(H5FD_t *_file)
         fprintf(logf, "\n");
         fprintf(logf, "number of reads = %llu\n", (long long unsigned) file->stats.total_read_count);
         fprintf(logf, "number of bytes read = %llu\n", (long long unsigned) file->stats.total_read_bytes);
+        fprintf(logf, "time in reads = %g seconds\n", file->stats.total_time_in_reads);
         fprintf(logf, "\n");
         fprintf(logf, "number of times a block was read = %llu\n", (long long unsigned) file->stats.total_block_reads);
         fprintf(logf, "number of times a block was read more than once = %llu\n", (long long unsigned) file->stats.total_block_re_reads);
@@ -1859,6 +3713,10 @@ H5FD_silo_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
 
 #endif
 
+    /* writers sharing a multi-writer file have files of their own */
+    if (f1->mw_writer < f2->mw_writer) return -1;
+    if (f1->mw_writer > f2->mw_writer) return 1;
+
     return 0;
 
 }
@@ -1898,6 +3756,33 @@ H5FD_silo_query(const H5FD_t *_f, unsigned long *flags /* out */)
     return(0);
 }
 
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_silo_get_type_map
+ *
+ * Purpose:	Tells the library how file space for each memory type is
+ *		managed. In meta_at_end mode, raw data and metadata are
+ *		allocated from separate address ranges (see
+ *		META_AT_END_RAW_BASE) so their free space must be kept
+ *		apart too.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_silo_get_type_map(const H5FD_t *_file, H5FD_mem_t *type_map)
+{
+    const H5FD_silo_t	*file = (const H5FD_silo_t *)_file;
+    static const H5FD_mem_t single[H5FD_MEM_NTYPES] = H5FD_FLMAP_SINGLE;
+    static const H5FD_mem_t dichotomy[H5FD_MEM_NTYPES] = H5FD_FLMAP_DICHOTOMY;
+
+    /* Clear the error stack */
+    H5Eclear2(H5E_DEFAULT);
+
+    memcpy(type_map, file->meta_at_end ? dichotomy : single, sizeof(single));
+
+    return 0;
+}
+
 /*-------------------------------------------------------------------------
  * Function:	H5FD_silo_get_eoa
  *
@@ -1929,10 +3814,11 @@ H5FD_silo_get_eoa(const H5FD_t *_file, H5FD_mem_t /*unused*/ type)
     /* Clear the error stack */
     H5Eclear2(H5E_DEFAULT);
 
-    /* Shut compiler up */
-    type = type;
+    /* metadata and raw data have their own address ranges in meta_at_end mode */
+    if (file->meta_at_end && !IS_RAW_TYPE(type))
+        return(file->meta_eoa);
 
-    return(file->eoa);
+    return(file->eoa - file->raw_offset + file->raw_base);
 }
 
 /*-------------------------------------------------------------------------
@@ -1961,16 +3847,32 @@ static herr_t
 H5FD_silo_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
 {
     H5FD_silo_t	*file = (H5FD_silo_t*)_file;
+    static const char *func = "H5FD_silo_set_eoa";
+    herr_t ret_value = 0;
 
     /* Clear the error stack */
     H5Eclear2(H5E_DEFAULT);
 
-    /* Shut compiler up */
-    type = type;
+    if (file->meta_at_end && !IS_RAW_TYPE(type))
+    {
+        if (addr > file->raw_base)
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_ARGS, H5E_OVERFLOW, "metadata address space exhausted", -1, -1)
+        file->meta_eoa = addr;
+    }
+    else
+    {
+        if (addr < file->raw_base)
+            H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_ARGS, H5E_BADRANGE, "raw data eoa below raw data base", -1, -1)
+        file->eoa = addr - file->raw_base + file->raw_offset;
+    }
 
-    file->eoa = addr;
+#ifdef SILO_VFD_MULTI_WRITER
+    /* claim segments as the file grows so blocks always have a home */
+    if (file->mw_writer >= 0 && file->write_access && mw_grow(file, file->eoa) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_NOSPACE, "can't claim multi-writer segments", -1, -1)
+#endif
 
-    return 0;
+    return ret_value;
 }
 
 /*-------------------------------------------------------------------------
@@ -2006,9 +3908,25 @@ H5FD_silo_get_eof(const H5FD_t *_file)
 #endif
     const H5FD_silo_t	*file = (const H5FD_silo_t *)_file;
 
+#if HDF5_VERSION_GE(1,10,4)
+    /* in meta_at_end mode, metadata ends where the in-memory copy does */
+    if (file->meta_at_end && type != H5FD_MEM_DEFAULT && !IS_RAW_TYPE(type))
+        return(MAX((haddr_t) file->meta_len, file->meta_eoa));
+#endif
+
+    if (file->meta_at_end)
+        return(file->eoa - file->raw_offset + file->raw_base);
+
     return(MAX(file->eof, file->eoa));
 }
 
+/* The handle H5FD_silo_get_handle returns for a file */
+static void *
+silo_vfd_handle(H5FD_silo_t *file)
+{
+    return &(file->fd);
+}
+
 /*-------------------------------------------------------------------------
  * Function:       H5FD_silo_get_handle
  *
@@ -2036,11 +3954,87 @@ H5FD_silo_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle)
     H5Eclear2(H5E_DEFAULT);
 
     if (file_handle)
-        *file_handle = &(file->fd);
+        *file_handle = silo_vfd_handle(file);
 
     return(0);
 }
 
+/*-------------------------------------------------------------------------
+ * Function:	H5Fget_silo_io_stats
+ *
+ * Purpose:	Copies the I/O counters accumulated so far for an open
+ *		file using the silo VFD into STATS. The counters cover
+ *		everything since the file was opened, including blocks
+ *		still being written by the background flush thread.
+ *
+ * Return:	Non-negative on success/Negative on failure (including
+ *		when FID is not using the silo VFD)
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_silo_io_stats(hid_t fid, H5FD_silo_io_stats_t *stats)
+{
+    static const char *func="H5Fget_silo_io_stats";
+    H5FD_silo_t *file;
+    void *handle = 0;
+    hid_t fapl_id, driver_id;
+    herr_t ret_value = 0;
+
+    /* Clear the error stack */
+    H5Eclear2(H5E_DEFAULT);
+
+    if (!stats)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_ARGS, H5E_BADVALUE, "null stats pointer", -1, -1)
+    if ((fapl_id = H5Fget_access_plist(fid)) < 0)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_ARGS, H5E_BADTYPE, "not a file", -1, -1)
+    driver_id = H5Pget_driver(fapl_id);
+    H5Pclose(fapl_id);
+    if (driver_id != H5FD_SILO_g)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_VFL, H5E_BADVALUE, "file not using silo VFD", -1, -1)
+    if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &handle) < 0 || !handle)
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_VFL, H5E_CANTGET, "can't get silo VFD handle", -1, -1)
+
+    /* the list lock keeps the file from being closed while we copy */
+    OPEN_FILES_LOCK();
+    for (file = silo_vfd_open_files; file; file = file->open_next)
+    {
+        if (silo_vfd_handle(file) == handle)
+            break;
+    }
+    if (!file)
+    {
+        OPEN_FILES_UNLOCK();
+        H5E_PUSH_HELPER(func, H5E_ERR_CLS, H5E_VFL, H5E_NOTFOUND, "silo VFD file not found", -1, -1)
+    }
+
+    FLUSH_LOCK(file);
+    stats->block_size         = file->block_size;
+    stats->block_count        = file->max_blocks;
+    stats->bytes_read         = file->stats.total_read_bytes;
+    stats->bytes_written      = file->stats.total_write_bytes;
+    stats->read_calls         = file->stats.total_read_count;
+    stats->write_calls        = file->stats.total_write_count;
+    stats->seeks              = file->stats.total_seeks;
+    stats->read_time          = file->stats.total_time_in_reads;
+    stats->write_time         = file->stats.total_time_in_writes;
+    stats->block_hits         = file->stats.num_block_hits;
+    stats->block_misses       = file->stats.num_block_misses;
+    stats->block_evictions    = file->stats.num_block_evictions;
+    stats->blocks_read_ahead  = file->stats.num_prefetched_blocks;
+    stats->raw_reads          = file->stats.total_vfd_raw_read_count;
+    stats->raw_bytes_read     = file->stats.total_vfd_raw_read_bytes;
+    stats->raw_writes         = file->stats.total_vfd_raw_write_count;
+    stats->raw_bytes_written  = file->stats.total_vfd_raw_write_bytes;
+    stats->meta_reads         = file->stats.total_vfd_md_read_count;
+    stats->meta_bytes_read    = file->stats.total_vfd_md_read_bytes;
+    stats->meta_writes        = file->stats.total_vfd_md_write_count;
+    stats->meta_bytes_written = file->stats.total_vfd_md_write_bytes;
+    FLUSH_UNLOCK(file);
+    OPEN_FILES_UNLOCK();
+
+    return ret_value;
+}
+
 /*-------------------------------------------------------------------------
  * Function:	H5F_silo_read
  *
@@ -2066,7 +4060,7 @@ H5FD_silo_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD_silo_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+silo_read_cached(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
     void *buf/*out*/)
 {
     H5FD_silo_t		*file = (H5FD_silo_t*)_file;
@@ -2092,6 +4086,21 @@ H5FD_silo_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size
         H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_OVERFLOW, "file address overflowed", -1, -1)
     if (REGION_OVERFLOW(addr, size))
         H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_OVERFLOW, "file address overflowed", -1, -1)
+
+    if (file->meta_at_end)
+    {
+        if (addr < file->raw_base)
+        {
+            if (addr+size > file->raw_base)
+                H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_BADRANGE, "read spans metadata and raw data", -1, -1)
+            meta_read(file, addr, size, buf);
+            file->stats.total_vfd_md_read_count++;
+            file->stats.total_vfd_md_read_bytes += size;
+            return 0;
+        }
+        addr = addr - file->raw_base + file->raw_offset;
+    }
+
     if ((addr+size)>file->eoa)
         H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_OVERFLOW, "file address overflowed", -1, -1)
 
@@ -2100,10 +4109,12 @@ H5FD_silo_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size
 
     rb = relevant_blocks(file->block_size, addr, size);
     blidx = -1; 
-    bl = file->block_list;
     bufoff = 0;
     for (id = rb.id0; id <= rb.id1; id++)
     {
+        /* the list moves when it grows */
+        bl = file->block_list;
+
         /* look for the block in the list */
         if (blidx < 0 || blidx >= file->num_blocks-1)
             blidx = find_block_by_id(file, id, EXACT); 
@@ -2114,12 +4125,20 @@ H5FD_silo_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size
 
         if (blidx < 0)
         {
-            if (file->num_blocks == file->max_blocks)
+            file->stats.num_block_misses++;
+            blidx = read_ahead_by_id(file, id, rb.id1);
+            if (blidx < 0)
+                H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't write evicted block", -1, -1)
+        }
+        else
+        {
+            file->stats.num_block_hits++;
+            if (bl[blidx].prefetched)
             {
-                int tmpblidx = find_block_to_preempt(file);
-                free_block_by_index(file, tmpblidx);
+                bl[blidx].prefetched = 0;
+                file->num_prefetched--;
+                file->stats.num_prefetch_hits++;
             }
-            blidx = alloc_block_by_id(file, id);
         }
 
         /* put the data in the block */
@@ -2147,6 +4166,17 @@ H5FD_silo_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size
 	}
     }
 
+    if (type == H5FD_MEM_DRAW)
+    {
+        file->stats.total_vfd_raw_read_count++;
+        file->stats.total_vfd_raw_read_bytes += size;
+    }
+    else
+    {
+        file->stats.total_vfd_md_read_count++;
+        file->stats.total_vfd_md_read_bytes += size;
+    }
+
     if (file->log_stats)
     {
         int n;
@@ -2154,15 +4184,11 @@ H5FD_silo_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size
         for (n = 0; tmpsize; n++, tmpsize=(tmpsize>>1));
         if (type == H5FD_MEM_DRAW)
         {
-            file->stats.total_vfd_raw_read_count++;
-            file->stats.total_vfd_raw_read_bytes += size;
             file->stats.vfd_raw_read_count_hist[n]++;
             file->stats.vfd_raw_read_bytes_hist[n] += size;
         }
         else
         {
-            file->stats.total_vfd_md_read_count++;
-            file->stats.total_vfd_md_read_bytes += size;
             file->stats.vfd_md_read_count_hist[n]++;
             file->stats.vfd_md_read_bytes_hist[n] += size;
         }
@@ -2173,6 +4199,22 @@ H5FD_silo_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size
     return(0);
 }
 
+/* Files sharing the cache read and write under the pool lock */
+static herr_t
+H5FD_silo_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+    size_t size, void *buf)
+{
+    H5FD_silo_t *file = (H5FD_silo_t*)_file;
+    herr_t ret_value;
+
+    if (!file->shared_cache)
+        return silo_read_cached(_file, type, dxpl_id, addr, size, buf);
+    POOL_LOCK();
+    ret_value = silo_read_cached(_file, type, dxpl_id, addr, size, buf);
+    POOL_UNLOCK();
+    return ret_value;
+}
+
 /*-------------------------------------------------------------------------
  * Function:	H5F_silo_write
  *
@@ -2197,7 +4239,7 @@ H5FD_silo_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD_silo_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+silo_write_cached(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
 		size_t size, const void *buf)
 {
     H5FD_silo_t		*file = (H5FD_silo_t*)_file;
@@ -2223,18 +4265,38 @@ H5FD_silo_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
         H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_OVERFLOW, "file address overflowed", -1, -1)
     if (REGION_OVERFLOW(addr, size))
         H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_OVERFLOW, "file address overflowed", -1, -1)
+
+    if (file->meta_at_end)
+    {
+        if (addr < file->raw_base)
+        {
+            if (addr+size > file->raw_base)
+                H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_BADRANGE, "write spans metadata and raw data", -1, -1)
+            if (meta_write(file, addr, size, buf) < 0)
+                H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't buffer metadata", -1, -1)
+            file->stats.total_vfd_md_write_count++;
+            file->stats.total_vfd_md_write_bytes += size;
+            return 0;
+        }
+        addr = addr - file->raw_base + file->raw_offset;
+    }
+
     if (addr+size>file->eoa)
         H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_OVERFLOW, "file address overflowed", -1, -1)
 
     if (size == 0)
         return 0;
 
+    file->mw_dirty = 1;
+
     rb = relevant_blocks(file->block_size, addr, size);
     blidx = -1; 
-    bl = file->block_list;
     bufoff = 0;
     for (id = rb.id0; id <= rb.id1; id++)
     {
+        /* the list moves when it grows */
+        bl = file->block_list;
+
         /* look for the block in the list */
         if (blidx < 0 || blidx >= file->num_blocks-1)
             blidx = find_block_by_id(file, id, EXACT); 
@@ -2245,12 +4307,17 @@ H5FD_silo_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
 
         if (blidx < 0)
         {
-            if (file->num_blocks == file->max_blocks)
-            {
-                int tmpblidx = find_block_to_preempt(file);
-                free_block_by_index(file, tmpblidx);
-            }
-            blidx = alloc_block_by_id(file, id);
+            /* blocks this write fills completely need not be read first */
+            hsize_t skip0 = rb.id0 + (rb.off0 != 0);
+            hsize_t skip1 = rb.id1 + (rb.off1 == (int) file->block_size - 1);
+            blidx = fetch_blocks_by_id(file, id, rb.id1, skip0, skip1);
+            if (blidx < 0)
+                H5E_PUSH_HELPER (func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't write evicted block", -1, -1)
+        }
+        if (file->block_list[blidx].prefetched)
+        {
+            file->block_list[blidx].prefetched = 0;
+            file->num_prefetched--;
         }
 
         /* put the data in the block */
@@ -2278,6 +4345,17 @@ H5FD_silo_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
 	}
     }
 
+    if (type == H5FD_MEM_DRAW)
+    {
+        file->stats.total_vfd_raw_write_count++;
+        file->stats.total_vfd_raw_write_bytes += size;
+    }
+    else
+    {
+        file->stats.total_vfd_md_write_count++;
+        file->stats.total_vfd_md_write_bytes += size;
+    }
+
     if (file->log_stats)
     {
         int n;
@@ -2285,15 +4363,11 @@ H5FD_silo_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
         for (n = 0; tmpsize; n++, tmpsize=(tmpsize>>1));
         if (type == H5FD_MEM_DRAW)
         {
-            file->stats.total_vfd_raw_write_count++;
-            file->stats.total_vfd_raw_write_bytes += size;
             file->stats.vfd_raw_write_count_hist[n]++;
             file->stats.vfd_raw_write_bytes_hist[n] += size;
         }
         else
         {
-            file->stats.total_vfd_md_write_count++;
-            file->stats.total_vfd_md_write_bytes += size;
             file->stats.vfd_md_write_count_hist[n]++;
             file->stats.vfd_md_write_bytes_hist[n] += size;
         }
@@ -2304,6 +4378,22 @@ H5FD_silo_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     return(0);
 }
 
+/* Like H5FD_silo_read, under the pool lock for shared cache files */
+static herr_t
+H5FD_silo_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+    size_t size, const void *buf)
+{
+    H5FD_silo_t *file = (H5FD_silo_t*)_file;
+    herr_t ret_value;
+
+    if (!file->shared_cache)
+        return silo_write_cached(_file, type, dxpl_id, addr, size, buf);
+    POOL_LOCK();
+    ret_value = silo_write_cached(_file, type, dxpl_id, addr, size, buf);
+    POOL_UNLOCK();
+    return ret_value;
+}
+
 /*-------------------------------------------------------------------------
  * Function:	H5F_silo_truncate
  *
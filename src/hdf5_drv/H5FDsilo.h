@@ -94,6 +94,43 @@ be used for advertising or product endorsement purposes.
 #endif
 #define H5FD_SILO_DEFAULT_LOG_STATS 0
 #define H5FD_SILO_DEFAULT_USE_DIRECT 0
+#define H5FD_SILO_DEFAULT_ASYNC_FLUSH 0
+#define H5FD_SILO_DEFAULT_META_AT_END 0
+#define H5FD_SILO_DEFAULT_CACHE_BYTES 0
+#define H5FD_SILO_DEFAULT_SHARED_CACHE 0
+#define H5FD_SILO_DEFAULT_NWRITERS 0
+#define H5FD_SILO_DEFAULT_WRITER -1
+
+/* Snapshot of a silo VFD file's I/O counters; see H5Fget_silo_io_stats */
+typedef struct H5FD_silo_io_stats_t {
+    hsize_t block_size;
+    int     block_count;
+
+    /* traffic between the VFD and the filesystem */
+    hsize_t bytes_read;
+    hsize_t bytes_written;
+    hsize_t read_calls;
+    hsize_t write_calls;
+    hsize_t seeks;
+    double  read_time;          /* seconds spent in read system calls */
+    double  write_time;         /* seconds spent in write system calls */
+
+    /* block cache behavior */
+    hsize_t block_hits;
+    hsize_t block_misses;
+    hsize_t block_evictions;
+    hsize_t blocks_read_ahead;
+
+    /* requests from the HDF5 library, raw data vs. metadata */
+    hsize_t raw_reads;
+    hsize_t raw_bytes_read;
+    hsize_t raw_writes;
+    hsize_t raw_bytes_written;
+    hsize_t meta_reads;
+    hsize_t meta_bytes_read;
+    hsize_t meta_writes;
+    hsize_t meta_bytes_written;
+} H5FD_silo_io_stats_t;
 
 #ifdef __cplusplus
 extern "C" {
@@ -105,6 +142,12 @@ herr_t H5Pset_fapl_silo(hid_t fapl_id);
 herr_t H5Pset_silo_block_size_and_count(hid_t fapl_id, hsize_t block_size, int max_blocks_in_mem);
 herr_t H5Pset_silo_log_stats(hid_t fapl_id, int log);
 herr_t H5Pset_silo_use_direct(hid_t fapl_id, int used);
+herr_t H5Pset_silo_async_flush(hid_t fapl_id, int async);
+herr_t H5Pset_silo_meta_at_end(hid_t fapl_id, int meta_at_end);
+herr_t H5Pset_silo_cache_budget(hid_t fapl_id, hsize_t nbytes, int shared);
+herr_t H5Pset_silo_multi_writer(hid_t fapl_id, int nwriters, int writer);
+herr_t H5FD_silo_set_shared_cache_budget(hsize_t nbytes);
+herr_t H5Fget_silo_io_stats(hid_t fid, H5FD_silo_io_stats_t *stats);
 
 #ifdef __cplusplus
 }
@@ -1,3 +1,4 @@
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -30,6 +31,7 @@ and calls to bitstream methods with 'B ' as in
 #endif
 
 #ifdef AS_SILO_BUILTIN /* [ */
+#include "config.h" /* for HAVE_PTHREAD */
 #include "hdf5.h"
 #define USE_C_STRUCTSPACE
 #include "zfp.h"
@@ -76,6 +78,21 @@ do                                                    \
 
 static int h5z_zfp_was_registered = 0;
 
+/* Execution policy for compression, see H5Z_zfp_set_execution(), and bit
+   planes to decode, see H5Z_zfp_set_read_precision(). Each is set just
+   before a write or read, so they are per-thread when Silo may be called
+   from several threads and when chunks are compressed on threads. */
+#if defined(HAVE_PTHREAD) && defined(_MSC_VER)
+#define H5Z_ZFP_THREAD_LOCAL __declspec(thread)
+#elif defined(HAVE_PTHREAD)
+#define H5Z_ZFP_THREAD_LOCAL __thread
+#else
+#define H5Z_ZFP_THREAD_LOCAL
+#endif
+static H5Z_ZFP_THREAD_LOCAL zfp_exec_policy h5z_zfp_exec_policy = zfp_exec_serial;
+static H5Z_ZFP_THREAD_LOCAL unsigned int h5z_zfp_omp_threads = 0;
+static H5Z_ZFP_THREAD_LOCAL unsigned int h5z_zfp_read_prec = 0;
+
 static size_t    H5Z_filter_zfp(unsigned int flags, size_t cd_nelmts,
                                 const unsigned int cd_values[],
                                 size_t nbytes, size_t *buf_size, void **buf);
@@ -130,6 +147,48 @@ static void H5Z_zfp_final(void)
     H5Z_zfp_finalize();
 }
 
+/* Choose serial or OpenMP execution for subsequent compression by this
+   filter on this thread. nthreads of zero means OpenMP's default thread
+   count.
+   Decompression is always serial; ZFP has no parallel decoder for CPUs.
+   Returns 1 on success and 0, leaving execution serial, when the ZFP
+   library was not built with OpenMP. */
+int H5Z_zfp_set_execution(int use_omp, unsigned int nthreads)
+{
+    zfp_stream *zstr;
+    int ok = 1;
+
+    h5z_zfp_exec_policy = zfp_exec_serial;
+    h5z_zfp_omp_threads = 0;
+    if (!use_omp)
+        return 1;
+
+    /* Ask ZFP whether it supports OpenMP rather than guessing from here */
+    if (0 == (zstr = Z zfp_stream_open(0)))
+        return 0;
+    ok = Z zfp_stream_set_execution(zstr, zfp_exec_omp);
+    Z zfp_stream_close(zstr);
+
+    if (ok)
+    {
+        h5z_zfp_exec_policy = zfp_exec_omp;
+        h5z_zfp_omp_threads = nthreads;
+    }
+    return ok;
+}
+
+/* Decode only the leading prec bit planes of each block on subsequent
+   reads by this filter (on this thread), or all of them if prec is zero.
+   This is honored only for data whose blocks all have the same size, as
+   in fixed-rate mode; others always decode in full. Returns the previous
+   setting. */
+unsigned int H5Z_zfp_set_read_precision(unsigned int prec)
+{
+    unsigned int old = h5z_zfp_read_prec;
+    h5z_zfp_read_prec = prec;
+    return old;
+}
+
 static htri_t
 H5Z_zfp_can_apply(hid_t dcpl_id, hid_t type_id, hid_t chunk_space_id)
 {   
@@ -491,6 +550,204 @@ done:
     return retval;
 }
 
+/* Number of bits each zfp block of a chunk compressed with these
+   cd_values occupies, when that is the same for every block as in
+   fixed-rate mode, so blocks can be located without decoding the blocks
+   ahead of them. Returns 0 for the variable-size modes and for data
+   written with the other byte order. */
+int H5Z_zfp_block_bits(size_t cd_nelmts, unsigned int const cd_values[])
+{
+    H5T_order_t swap = H5T_ORDER_NONE;
+    uint64 zfp_mode, zfp_meta;
+    zfp_stream *zstr;
+    int bits = 0;
+
+    if (cd_nelmts < 2 ||
+        0 == get_zfp_info_from_cd_values(cd_nelmts-1, &cd_values[1], &zfp_mode, &zfp_meta, &swap) ||
+        swap != H5T_ORDER_NONE)
+        return 0;
+
+    if (0 == (zstr = Z zfp_stream_open(0)))
+        return 0;
+    Z zfp_stream_set_mode(zstr, zfp_mode);
+    if (zstr->minbits == zstr->maxbits)
+        bits = (int) zstr->maxbits;
+    Z zfp_stream_close(zstr);
+
+    return bits;
+}
+
+#define H5Z_ZFP_DECODE_BLOCK(T)                                     \
+    switch (nd)                                                     \
+    {                                                               \
+        case 1: Z zfp_decode_block_ ## T ## _1(zstr, (T*) block); break; \
+        case 2: Z zfp_decode_block_ ## T ## _2(zstr, (T*) block); break; \
+        case 3: Z zfp_decode_block_ ## T ## _3(zstr, (T*) block); break; \
+        case 4: Z zfp_decode_block_ ## T ## _4(zstr, (T*) block); break; \
+    }
+
+/* Seek to and decode each zfp block of a chunk that intersects a box and
+   store the box's values densely in dst. lo and count give the box's
+   corner and size in zfp's order, x (the fastest varying HDF5 dimension)
+   first, over the chunk's ndims non-unity dimensions; ndims < 0 means
+   the whole chunk. prec > 0 decodes only that many leading bit planes of
+   each block. Returns 1 on success, 0 if the chunk's blocks vary in size
+   and -1 on error. */
+static int
+h5z_zfp_decode_blocks(uint64 zfp_mode, uint64 zfp_meta, void *cbuf, size_t cbytes,
+    int ndims, size_t const lo[], size_t const count[], void *dst, unsigned int prec)
+{
+    static char const *_funcname_ = "h5z_zfp_decode_blocks";
+    size_t whole_lo[4] = {0,0,0,0};
+    bitstream *bstr = 0;
+    zfp_stream *zstr = 0;
+    zfp_field *zfld = 0;
+    double block[4*4*4*4];
+    size_t fdims[4] = {1,1,1,1}, nb[4] = {1,1,1,1};
+    size_t blo[4] = {0,0,0,0}, bhi[4] = {0,0,0,0}, bx[4], bits;
+    size_t dsize;
+    zfp_type type;
+    int i, nd, retval = -1;
+
+    if (0 == (zfld = Z zfp_field_alloc()))
+        H5Z_ZFP_PUSH_AND_GOTO(H5E_RESOURCE, H5E_NOSPACE, -1, "field alloc failed");
+    Z zfp_field_set_metadata(zfld, zfp_meta);
+    nd = (int) Z zfp_field_dimensionality(zfld);
+    type = Z zfp_field_type(zfld);
+    fdims[0] = zfld->nx;
+    if (nd > 1) fdims[1] = zfld->ny;
+    if (nd > 2) fdims[2] = zfld->nz;
+    if (nd > 3) fdims[3] = zfld->nw;
+    switch (type)
+    {
+        case zfp_type_int32:  dsize = sizeof(int32);  break;
+        case zfp_type_int64:  dsize = sizeof(int64);  break;
+        case zfp_type_float:  dsize = sizeof(float);  break;
+        case zfp_type_double: dsize = sizeof(double); break;
+        default: H5Z_ZFP_PUSH_AND_GOTO(H5E_PLINE, H5E_BADTYPE, -1, "invalid datatype");
+    }
+    if (ndims < 0)
+    {
+        ndims = nd;
+        lo = whole_lo;
+        count = fdims;
+    }
+    if (nd != ndims)
+        H5Z_ZFP_PUSH_AND_GOTO(H5E_ARGS, H5E_BADVALUE, -1, "box rank differs from chunk's");
+
+    /* Blocks overlapping the box, in each dimension */
+    for (i = 0; i < nd; i++)
+    {
+        if (count[i] == 0 || lo[i] + count[i] > fdims[i])
+            H5Z_ZFP_PUSH_AND_GOTO(H5E_ARGS, H5E_BADVALUE, -1, "box exceeds chunk");
+        nb[i] = (fdims[i] + 3) / 4;
+        blo[i] = lo[i] / 4;
+        bhi[i] = (lo[i] + count[i] - 1) / 4;
+    }
+
+    if (0 == (bstr = B stream_open(cbuf, cbytes)))
+        H5Z_ZFP_PUSH_AND_GOTO(H5E_RESOURCE, H5E_NOSPACE, -1, "bitstream open failed");
+    if (0 == (zstr = Z zfp_stream_open(bstr)))
+        H5Z_ZFP_PUSH_AND_GOTO(H5E_RESOURCE, H5E_NOSPACE, -1, "zfp stream open failed");
+    Z zfp_stream_set_mode(zstr, zfp_mode);
+    if (zstr->minbits != zstr->maxbits)
+    {
+        retval = 0;
+        goto done;
+    }
+    bits = zstr->maxbits;
+
+    /* Blocks are found by position, so a block may be cut short */
+    if (prec > 0 && prec < zstr->maxprec)
+        Z zfp_stream_set_params(zstr, 0, zstr->maxbits, prec, zstr->minexp);
+    if (nb[0] * nb[1] * nb[2] * nb[3] * bits > cbytes * CHAR_BIT)
+        H5Z_ZFP_PUSH_AND_GOTO(H5E_PLINE, H5E_BADVALUE, -1, "chunk too small for its blocks");
+
+    for (bx[3] = blo[3]; bx[3] <= bhi[3]; bx[3]++)
+    for (bx[2] = blo[2]; bx[2] <= bhi[2]; bx[2]++)
+    for (bx[1] = blo[1]; bx[1] <= bhi[1]; bx[1]++)
+    for (bx[0] = blo[0]; bx[0] <= bhi[0]; bx[0]++)
+    {
+        size_t b = ((bx[3] * nb[2] + bx[2]) * nb[1] + bx[1]) * nb[0] + bx[0];
+        size_t x[4], xlo[4], xhi[4];
+
+        /* Every block is bits long, so block b starts at b * bits */
+        B stream_rseek(bstr, b * bits);
+        switch (type)
+        {
+            case zfp_type_int32:  H5Z_ZFP_DECODE_BLOCK(int32);  break;
+            case zfp_type_int64:  H5Z_ZFP_DECODE_BLOCK(int64);  break;
+            case zfp_type_float:  H5Z_ZFP_DECODE_BLOCK(float);  break;
+            case zfp_type_double: H5Z_ZFP_DECODE_BLOCK(double); break;
+            default: break;
+        }
+
+        /* Copy the part of the block inside the box */
+        for (i = 0; i < 4; i++)
+        {
+            if (i < nd)
+            {
+                xlo[i] = 4 * bx[i] > lo[i] ? 4 * bx[i] : lo[i];
+                xhi[i] = 4 * bx[i] + 4 < lo[i] + count[i] ? 4 * bx[i] + 4 : lo[i] + count[i];
+            }
+            else
+            {
+                xlo[i] = 0;
+                xhi[i] = 1;
+            }
+        }
+        for (x[3] = xlo[3]; x[3] < xhi[3]; x[3]++)
+        for (x[2] = xlo[2]; x[2] < xhi[2]; x[2]++)
+        for (x[1] = xlo[1]; x[1] < xhi[1]; x[1]++)
+        {
+            size_t src = (((nd > 3 ? x[3] - 4 * bx[3] : 0) * 4 +
+                           (nd > 2 ? x[2] - 4 * bx[2] : 0)) * 4 +
+                           (nd > 1 ? x[1] - 4 * bx[1] : 0)) * 4 + (xlo[0] - 4 * bx[0]);
+            size_t off = (((nd > 3 ? x[3] - lo[3] : 0) * (nd > 2 ? count[2] : 1) +
+                           (nd > 2 ? x[2] - lo[2] : 0)) * (nd > 1 ? count[1] : 1) +
+                           (nd > 1 ? x[1] - lo[1] : 0)) * count[0] + (xlo[0] - lo[0]);
+            memcpy((char *) dst + off * dsize, (char *) block + src * dsize,
+                (xhi[0] - xlo[0]) * dsize);
+        }
+    }
+    retval = 1;
+
+done:
+    if (zfld) Z zfp_field_free(zfld);
+    if (zstr) Z zfp_stream_close(zstr);
+    if (bstr) B stream_close(bstr);
+    return retval;
+}
+
+/* Decode, from one chunk of cbytes compressed by this filter, only the
+   zfp blocks that intersect a box of the chunk and store the box's values
+   densely in dst, see h5z_zfp_decode_blocks(). Returns 1 on success, 0
+   if the chunk's blocks vary in size (see H5Z_zfp_block_bits) and -1 on
+   error. */
+int H5Z_zfp_decode_box(size_t cd_nelmts, unsigned int const cd_values[],
+    void *cbuf, size_t cbytes, int ndims, size_t const lo[], size_t const count[],
+    void *dst)
+{
+    static char const *_funcname_ = "H5Z_zfp_decode_box";
+    H5T_order_t swap = H5T_ORDER_NONE;
+    uint64 zfp_mode, zfp_meta;
+    int retval = -1;
+
+    if (cd_nelmts < 2 ||
+        0 == get_zfp_info_from_cd_values(cd_nelmts-1, &cd_values[1], &zfp_mode, &zfp_meta, &swap))
+        H5Z_ZFP_PUSH_AND_GOTO(H5E_PLINE, H5E_CANTGET, -1, "can't get ZFP mode/meta");
+    if (swap != H5T_ORDER_NONE)
+        return 0;
+
+    retval = h5z_zfp_decode_blocks(zfp_mode, zfp_meta, cbuf, cbytes, ndims, lo, count,
+                 dst, h5z_zfp_read_prec);
+
+done:
+    return retval;
+}
+
+#undef H5Z_ZFP_DECODE_BLOCK
+
 static size_t
 H5Z_filter_zfp(unsigned int flags, size_t cd_nelmts,
     const unsigned int cd_values[], size_t nbytes,
@@ -543,6 +800,13 @@ H5Z_filter_zfp(unsigned int flags, size_t cd_nelmts,
 
         Z zfp_field_set_pointer(zfld, newbuf);
 
+        /* Reduced precision reads decode block by block, when possible */
+        status = 0;
+        if (h5z_zfp_read_prec > 0 && swap == H5T_ORDER_NONE &&
+            (status = h5z_zfp_decode_blocks(zfp_mode, zfp_meta, *buf, *buf_size,
+                          -1, 0, 0, newbuf, h5z_zfp_read_prec)) < 0)
+            H5Z_ZFP_PUSH_AND_GOTO(H5E_PLINE, H5E_CANTFILTER, 0, "decompression failed");
+
         /* Setup the ZFP stream object */
         if (0 == (bstr = B stream_open(*buf, *buf_size)))
             H5Z_ZFP_PUSH_AND_GOTO(H5E_RESOURCE, H5E_NOSPACE, 0, "bitstream open failed");
@@ -553,7 +817,8 @@ H5Z_filter_zfp(unsigned int flags, size_t cd_nelmts,
         Z zfp_stream_set_mode(zstr, zfp_mode);
 
         /* Do the ZFP decompression operation */
-        status = Z zfp_decompress(zstr, zfld);
+        if (status == 0)
+            status = Z zfp_decompress(zstr, zfld);
 
         /* clean up */
         Z zfp_field_free(zfld); zfld = 0;
@@ -613,6 +878,11 @@ H5Z_filter_zfp(unsigned int flags, size_t cd_nelmts,
 
         Z zfp_stream_set_bit_stream(zstr, bstr);
 
+        /* The parallel encoder writes the same stream as the serial one */
+        if (h5z_zfp_exec_policy == zfp_exec_omp &&
+            Z zfp_stream_set_execution(zstr, zfp_exec_omp))
+            Z zfp_stream_set_omp_threads(zstr, h5z_zfp_omp_threads);
+
         /* Do the compression */
         zsize = Z zfp_compress(zstr, zfld);
 
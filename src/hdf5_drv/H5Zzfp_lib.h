@@ -9,6 +9,12 @@ extern "C" {
 
 extern int H5Z_zfp_initialize(void);
 extern int H5Z_zfp_finalize(void);
+extern int H5Z_zfp_set_execution(int use_omp, unsigned int nthreads);
+extern unsigned int H5Z_zfp_set_read_precision(unsigned int prec);
+extern int H5Z_zfp_block_bits(size_t cd_nelmts, unsigned int const cd_values[]);
+extern int H5Z_zfp_decode_box(size_t cd_nelmts, unsigned int const cd_values[],
+    void *cbuf, size_t cbytes, int ndims, size_t const lo[], size_t const count[],
+    void *dst);
 
 #ifdef __cplusplus
 }
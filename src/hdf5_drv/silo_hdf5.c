@@ -58,6 +58,7 @@ be used for advertising or product endorsement purposes.
 #if HAVE_STRING_H
 #include <string.h>
 #endif
+#include <limits.h>
 #if HAVE_STDLIB_H
 #include <stdlib.h> /*missing from silo header files*/
 #endif
@@ -194,6 +195,21 @@ static const unsigned SILO_HZIP_PERMUTATION[4] = {0,0,((unsigned) (0x00002130)),
 #ifdef HAVE_ZFP
 #include "H5Zzfp.h"
 extern void zfp_init_zfp();
+extern const H5Z_class2_t H5Z_ZFP[1];
+#endif
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+#if HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else
+#include <time.h>
+#endif
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 #endif
 
 /* Defining these to check overhead of PROTECT */
@@ -208,10 +224,17 @@ extern void zfp_init_zfp();
 #define COMPRESSION_ERRMODE_FAIL     1
 #define ALLOW_MESH_COMPRESSION 0x00000001
 
+/* Chunk size when NTHREADS is given without CHUNKSIZE, and chunks per
+   thread in each half of the window of chunks being compressed or
+   written */
+#define DB_HDF5_MT_CHUNK_BYTES  (1<<20)
+#define DB_HDF5_MT_CHUNKS_PER_THREAD 4
+
 #define FALSE           0
 #define TRUE            1
 
 #define LINKGRP         "/.silo/"       /*name of link group            */
+#define DB_HDF5_COMPNAME_LEN 24        /*"#%06lld" link group names    */
 #define MAX_VARS        16              /*max vars per DB*var object    */
 #define OPTDUP(S)       ((S)&&*(S)?strdup(S):NULL)
 #define BASEDUP(S)       ((S)&&*(S)?db_FullName2BaseName(S):NULL)
@@ -274,7 +297,7 @@ static int const        skipFirstSemicolon = 0;
 static int              force_single_g;
 
 /* used to control behavior of GetZonelist */
-static char const      *calledFromGetUcdmesh = 0;
+static SILO_THREAD_LOCAL char const *calledFromGetUcdmesh = 0;
 
 /* Struct used when building the CWD name */
 typedef struct silo_hdf5_comp_t {
@@ -841,10 +864,11 @@ static hid_t    T_float = -1;
 static hid_t    T_double = -1;
 static hid_t    T_str256 = -1;
 static hid_t    SCALAR = -1;
-static hid_t    P_crprops = -1;
+static SILO_THREAD_LOCAL hid_t P_crprops = -1;
 static hid_t    P_ckcrprops = -1;
-static hid_t    P_rdprops = -1;
+static SILO_THREAD_LOCAL hid_t P_rdprops = -1;
 static hid_t    P_ckrdprops = -1;
+static hid_t    P_wrdaprops = -1;
 
 #define OPT(V)          ((V)?(V):"")
 #define OFFSET(P,F)     ((char*)&((P).F)-(char*)&(P))
@@ -1019,7 +1043,7 @@ typedef struct db_hdf5_fpzip_params_t {
     int                 ndims;
     int                 dims[10];
 } db_hdf5_fpzip_params_t;
-static db_hdf5_fpzip_params_t db_hdf5_fpzip_params;
+static SILO_THREAD_LOCAL db_hdf5_fpzip_params_t db_hdf5_fpzip_params;
 
 static htri_t 
 db_hdf5_fpzip_can_apply(hid_t dcpl_id, hid_t type_id, hid_t space_id)
@@ -1168,7 +1192,7 @@ typedef struct _zlInfo {
     char *zlname;
     DBzonelist *zl;
 } zlInfo_t;
-static zlInfo_t keptNodelistInfos[MAX_NODELIST_INFOS];
+static SILO_THREAD_LOCAL zlInfo_t keptNodelistInfos[MAX_NODELIST_INFOS];
 
 /*
    We can lookup a nodelist either by its name or the name of the mesh that
@@ -1404,7 +1428,7 @@ typedef struct db_hdf5_hzip_params_t {
     int                 dims[10];
     HZtype              hztype;
 } db_hdf5_hzip_params_t;
-static db_hdf5_hzip_params_t db_hdf5_hzip_params;
+static SILO_THREAD_LOCAL db_hdf5_hzip_params_t db_hdf5_hzip_params;
 
 static void
 db_hdf5_hzip_clear_params()
@@ -1700,8 +1724,8 @@ static H5Z_class_t db_hdf5_hzip_class;
 INTERNAL char const *
 friendly_name(DBfile *_dbfile, char const *base_name, char const *fmtstr, void const *val)
 {
-    static char retval[1024];
-    static char totfmtstr[1024];
+    static SILO_THREAD_LOCAL char retval[1024];
+    static SILO_THREAD_LOCAL char totfmtstr[1024];
     char typechar;
     int i, flen;
 
@@ -1965,11 +1989,11 @@ db_hdf5_put_cmemb(hid_t compound_type, char const *name, size_t offset,
  *
  *-------------------------------------------------------------------------
  */
-static int T_str_stype_set = 0;
+static SILO_THREAD_LOCAL int T_str_stype_set = 0;
 PRIVATE hid_t
 T_str(char *s)
 {
-    static hid_t        stype = -1;
+    static SILO_THREAD_LOCAL hid_t stype = -1;
 
     if (!s || !*s) return -1;
     if (T_str_stype_set && stype>=0) H5Tclose(stype);
@@ -2107,6 +2131,11 @@ db_hdf5_init(void)
     P_ckrdprops = H5Pcreate(H5P_DATASET_XFER);   /* never freed */
     H5Pset_edc_check(P_ckrdprops, H5Z_DISABLE_EDC);
 
+    /* Filtered datasets are written whole, so skip the chunk cache and
+       compress within H5Dwrite, where the encode can be timed */
+    P_wrdaprops = H5Pcreate(H5P_DATASET_ACCESS); /* never freed */
+    H5Pset_chunk_cache(P_wrdaprops, 0, 0, 1.0);
+
 #ifdef HAVE_FPZIP /* { */
     db_hdf5_fpzip_params.loss = 0;
 #if HDF5_VERSION_GE(1,8,0) && !defined(H5_USE_16_API)
@@ -2781,6 +2810,8 @@ db_hdf5_InitCallbacks(DBfile_hdf5 *dbfile, int target)
     dbfile->pub.close = db_hdf5_Close;
     dbfile->pub.module = db_hdf5_Filters;
     dbfile->pub.flush = db_hdf5_Flush;
+    dbfile->pub.g_iostats = db_hdf5_GetIOStats;
+    dbfile->pub.g_compstats = db_hdf5_GetCompressionStats;
 
     /* Directory operations */
     dbfile->pub.cd = db_hdf5_SetDir;
@@ -3274,6 +3305,234 @@ hdf2hdf_type(hid_t ftype)
     return mtype;
 }
 
+/* The DBOPT_COMPRESSION of the object whose arrays are being written, if
+   any; an empty string turns compression off for that object */
+static char const *db_hdf5_obj_cstr = 0;
+
+/* Filters in P_ckcrprops were last set for this compression string */
+static char db_hdf5_filters_cstr[256];
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_get_compression
+ *
+ * Purpose:     The compression string in effect for the arrays being
+ *              written: the current object's DBOPT_COMPRESSION or else
+ *              the file's string.
+ *
+ * Return:      The compression string or NULL if compression is off.
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE char const *
+db_hdf5_get_compression(DBfile *dbfile)
+{
+    if (db_hdf5_obj_cstr)
+        return *db_hdf5_obj_cstr ? db_hdf5_obj_cstr : 0;
+    return DBGetCompressionFile(dbfile);
+}
+
+/* Driver level parameters of a compression string, parsed once by
+   db_hdf5_parse_compression */
+typedef struct db_hdf5_cparams_t {
+    char     method[16];    /* METHOD, e.g. "GZIP", or empty */
+    double   chunksize;     /* CHUNKSIZE in bytes, 0 if not given */
+    int      nthreads;      /* NTHREADS, -1 if not given */
+    int      exec;          /* EXEC, one of the DB_HDF5_EXEC_ values */
+    unsigned omp_threads;   /* OMP_THREADS, 0 if not given */
+} db_hdf5_cparams_t;
+
+#define DB_HDF5_EXEC_NONE   -1
+#define DB_HDF5_EXEC_SERIAL  0
+#define DB_HDF5_EXEC_OMP     1
+#define DB_HDF5_EXEC_BAD     2
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_cparam
+ *
+ * Purpose:     Look up a parameter of a compression string. The string is
+ *              a list of whitespace separated words, each a KEY=VALUE
+ *              pair or a bare flag such as REVERSIBLE. Only whole keys
+ *              match, never text within another word.
+ *
+ * Return:      The value, copied to val, or NULL if the key is absent.
+ *              A bare flag has an empty value.
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE char const *
+db_hdf5_cparam(char const *cstr, char const *key, char *val, size_t n)
+{
+    size_t klen = strlen(key);
+
+    while (cstr && *cstr)
+    {
+        size_t len;
+
+        cstr += strspn(cstr, " \t\n");
+        len = strcspn(cstr, " \t\n");
+        if (len >= klen && !strncmp(cstr, key, klen) &&
+            (len == klen || cstr[klen] == '='))
+        {
+            size_t vlen = len > klen ? len - klen - 1 : 0;
+            if (vlen >= n) vlen = n - 1;
+            strncpy(val, cstr + len - vlen, vlen);
+            val[vlen] = '\0';
+            return val;
+        }
+        cstr += len;
+    }
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_parse_compression
+ *
+ * Purpose:     Parse the method and the parameters that govern chunking
+ *              and threading (CHUNKSIZE, NTHREADS, EXEC and OMP_THREADS)
+ *              from a compression string. CHUNKSIZE may carry a K, M or G
+ *              suffix.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+db_hdf5_parse_compression(char const *cstr, db_hdf5_cparams_t *cp)
+{
+    char val[64], *check;
+
+    memset(cp, 0, sizeof(*cp));
+    cp->nthreads = -1;
+    cp->exec = DB_HDF5_EXEC_NONE;
+
+    if (db_hdf5_cparam(cstr, "METHOD", val, sizeof(val)))
+        snprintf(cp->method, sizeof(cp->method), "%s", val);
+    if (db_hdf5_cparam(cstr, "CHUNKSIZE", val, sizeof(val)))
+    {
+        cp->chunksize = strtod(val, &check);
+        if      (*check == 'K' || *check == 'k') cp->chunksize *= 1024;
+        else if (*check == 'M' || *check == 'm') cp->chunksize *= 1024*1024;
+        else if (*check == 'G' || *check == 'g') cp->chunksize *= 1024*1024*1024;
+    }
+    if (db_hdf5_cparam(cstr, "NTHREADS", val, sizeof(val)))
+        cp->nthreads = (int) strtol(val, 0, 10);
+    if (db_hdf5_cparam(cstr, "EXEC", val, sizeof(val)))
+    {
+        if      (!strcmp(val, "OMP"))    cp->exec = DB_HDF5_EXEC_OMP;
+        else if (!strcmp(val, "SERIAL")) cp->exec = DB_HDF5_EXEC_SERIAL;
+        else                             cp->exec = DB_HDF5_EXEC_BAD;
+    }
+    if (db_hdf5_cparam(cstr, "OMP_THREADS", val, sizeof(val)))
+        cp->omp_threads = (unsigned) strtoul(val, 0, 10);
+}
+
+/* Whether a compression string selects the given method */
+PRIVATE int
+db_hdf5_compression_method_is(char const *cstr, char const *method)
+{
+    db_hdf5_cparams_t cp;
+
+    if (!cstr)
+        return FALSE;
+    db_hdf5_parse_compression(cstr, &cp);
+    return !strcmp(cp.method, method);
+}
+
+/* Compression string for the dataset being created when the file's string
+   says METHOD=AUTO: the codec picked by db_hdf5_auto_compression, or
+   DB_HDF5_AUTO_DEFAULT when there was no data to sample */
+#define DB_HDF5_AUTO_DEFAULT "METHOD=GZIP LEVEL=1"
+static char const *db_hdf5_auto_cstr = 0;
+static char db_hdf5_auto_choice[256];
+static char db_hdf5_auto_report[256];
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_auto_params
+ *
+ * Purpose:     Build a concrete compression string from a METHOD=AUTO
+ *              string: the given method and its parameters followed by
+ *              the method independent settings (ERRMODE, MINRATIO,
+ *              CHUNKSIZE, NTHREADS) and ZFP's EXEC and OMP_THREADS from
+ *              the AUTO string.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+db_hdf5_auto_params(char const *cstr, char const *method, char *dst, size_t n)
+{
+    static char const *keep[] = {"ERRMODE", "MINRATIO", "CHUNKSIZE", "NTHREADS",
+                                 "EXEC", "OMP_THREADS"};
+    char val[64];
+    size_t i;
+
+    snprintf(dst, n, "%s", method);
+    for (i = 0; i < NELMTS(keep); i++)
+    {
+        size_t len = strlen(dst);
+        if (!db_hdf5_cparam(cstr, keep[i], val, sizeof(val))) continue;
+        if (len + strlen(keep[i]) + strlen(val) + 3 > n) break;
+        snprintf(dst + len, n - len, " %s=%s", keep[i], val);
+    }
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_compression_string
+ *
+ * Purpose:     The compression string that governs the dataset being
+ *              created. This is the file's string unless that selects
+ *              METHOD=AUTO, in which case it is the codec chosen for the
+ *              dataset.
+ *
+ * Return:      The compression string or NULL if there is none.
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE char const *
+db_hdf5_compression_string(DBfile *dbfile)
+{
+    char const *cstr = db_hdf5_get_compression(dbfile);
+
+    if (!db_hdf5_compression_method_is(cstr, "AUTO"))
+        return cstr;
+    if (db_hdf5_auto_cstr)
+        return db_hdf5_auto_cstr;
+    db_hdf5_auto_params(cstr, DB_HDF5_AUTO_DEFAULT, db_hdf5_auto_choice,
+        sizeof(db_hdf5_auto_choice));
+    return db_hdf5_auto_choice;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_clear_compression
+ *
+ * Purpose:     Remove the compression filters from the chunked dataset
+ *              creation properties, keeping any checksum filter.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+db_hdf5_clear_compression(void)
+{
+    int i, n = H5Pget_nfilters(P_ckcrprops), fletcher = FALSE;
+
+    for (i = 0; i < n; i++)
+    {
+#if defined H5_USE_16_API || (H5_VERS_MAJOR == 1 && H5_VERS_MINOR < 8)
+        if (H5Pget_filter(P_ckcrprops,(unsigned)i,0,0,0,0,0) == H5Z_FILTER_FLETCHER32)
+#else
+        if (H5Pget_filter(P_ckcrprops,(unsigned)i,0,0,0,0,0,NULL) == H5Z_FILTER_FLETCHER32)
+#endif
+            fletcher = TRUE;
+    }
+    if (n > 0)
+        H5Premove_filter(P_ckcrprops, H5Z_FILTER_ALL);
+    if (fletcher)
+        H5Pset_fletcher32(P_ckcrprops);
+}
+
 /*-------------------------------------------------------------------------
  * Function:    db_hdf5_set_compression
  *
@@ -3307,6 +3566,19 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
     int have_gzip, have_szip, have_fpzip, have_hzip, have_zfp, i;
     H5Z_filter_t filtn;
     unsigned int filter_config_flags, opt_flag;
+    db_hdf5_cparams_t cp;
+
+    db_hdf5_parse_compression(db_hdf5_compression_string(dbfile), &cp);
+
+    /* The codec may differ from dataset to dataset, under METHOD=AUTO or
+       an object's DBOPT_COMPRESSION, so start over when it changes */
+    if (strncmp(db_hdf5_compression_string(dbfile), db_hdf5_filters_cstr,
+                sizeof(db_hdf5_filters_cstr)))
+    {
+        db_hdf5_clear_compression();
+        snprintf(db_hdf5_filters_cstr, sizeof(db_hdf5_filters_cstr), "%s",
+            db_hdf5_compression_string(dbfile));
+    }
 
     /* Check what filters already exist */
     have_gzip = FALSE;
@@ -3344,7 +3616,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
 #warning WHAT ABOUT NULL RETURN FROM DBGETCOMPRESSION
 #endif
 /* Handle some global compression parameters */
-    if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+    if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
        "ERRMODE=")) != (char *)NULL) 
     {
         (void)strncpy(chararray, ptr+8, 4); 
@@ -3355,11 +3627,11 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
             SILO_Globals.compressionErrmode = COMPRESSION_ERRMODE_FAIL;
         else
         {
-            db_perror(DBGetCompressionFile(dbfile), E_COMPRESSION, me);
+            db_perror(db_hdf5_compression_string(dbfile), E_COMPRESSION, me);
             return (-1);
         }
     }
-    if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+    if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
        "MINRATIO=")) != (char *)NULL) 
     {
         float mcr;
@@ -3369,7 +3641,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
             SILO_Globals.compressionMinratio = mcr;
         else
         {
-            db_perror(DBGetCompressionFile(dbfile), E_COMPRESSION, me);
+            db_perror(db_hdf5_compression_string(dbfile), E_COMPRESSION, me);
             return (-1);
         }
     }
@@ -3377,7 +3649,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
 #warning FIX MISSING .compressionMinsize member
 #endif
 #if 0
-    if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+    if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
        "MINSIZE=")) != (char *)NULL) 
     {
         unsigned int minsize;
@@ -3387,7 +3659,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
             SILO_Globals.compressionMinsize = minsize;
         else
         {
-            db_perror(DBGetCompressionFile(dbfile), E_COMPRESSION, me);
+            db_perror(db_hdf5_compression_string(dbfile), E_COMPRESSION, me);
             return -1;
         }
     }
@@ -3400,12 +3672,11 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
                    H5Z_FLAG_OPTIONAL : H5Z_FLAG_MANDATORY;
 
     /* Select the compression algorthm */
-    if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
-       "METHOD=GZIP")) != (char *)NULL) 
+    if (!strcmp(cp.method, "GZIP"))
     {
        if (have_gzip == FALSE)
        {
-          if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+          if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
              "LEVEL=")) != (char *)NULL)
           {
              (void)strncpy(chararray, ptr+6, 1); 
@@ -3421,7 +3692,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
              }
              else
              {
-                db_perror(DBGetCompressionFile(dbfile), E_COMPRESSION, me);
+                db_perror(db_hdf5_compression_string(dbfile), E_COMPRESSION, me);
                 return (-1);
              }
           }
@@ -3437,29 +3708,28 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
        }  /* if (have_gzip == FALSE) */
     }
 #ifdef H5_HAVE_FILTER_SZIP
-    else if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile),
-       "METHOD=SZIP"))!=(char *)NULL)
+    else if (!strcmp(cp.method, "SZIP"))
     {
        if (have_szip == FALSE)
        {
           filtn = H5Z_FILTER_SZIP;
           if (H5Zget_filter_info(filtn, &filter_config_flags)<0)
           {
-             db_perror(DBGetCompressionFile(dbfile), E_COMPRESSION, me);
+             db_perror(db_hdf5_compression_string(dbfile), E_COMPRESSION, me);
              return (-1);
           }
           if ((filter_config_flags &
           (H5Z_FILTER_CONFIG_ENCODE_ENABLED|H5Z_FILTER_CONFIG_DECODE_ENABLED))==
           (H5Z_FILTER_CONFIG_ENCODE_ENABLED|H5Z_FILTER_CONFIG_DECODE_ENABLED))
           {
-             if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+             if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
                 "BLOCK=")) != (char *)NULL)
              {
                 (void)strncpy(chararray, ptr+6, 2); 
                 block = (int) strtol(chararray, &check, 10);
                 if ((chararray != check) && (block >= 0) && (block <=32))
                 { 
-                   if (strstr(DBGetCompressionFile(dbfile), 
+                   if (strstr(db_hdf5_compression_string(dbfile), 
                       "MASK=EC") != NULL)
                    {
                       if (H5Pset_shuffle(P_ckcrprops)<0 ||
@@ -3469,7 +3739,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
                          return (-1);
                       }
                    }
-                   else if(strstr(DBGetCompressionFile(dbfile),
+                   else if(strstr(db_hdf5_compression_string(dbfile),
                       "MASK=NN")!=NULL)
                    {
                       if (H5Pset_shuffle(P_ckcrprops)<0 ||
@@ -3491,7 +3761,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
                 }
                 else
                 {
-                   db_perror(DBGetCompressionFile(dbfile), E_COMPRESSION, me);
+                   db_perror(db_hdf5_compression_string(dbfile), E_COMPRESSION, me);
                    return (-1);
                 }
              }
@@ -3509,12 +3779,11 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
     }
 #endif
 #ifdef HAVE_HZIP
-    else if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
-       "METHOD=HZIP")) != (char *)NULL) 
+    else if (!strcmp(cp.method, "HZIP"))
     {
        if (have_hzip == FALSE && (flags & ALLOW_MESH_COMPRESSION))
        {
-           if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+           if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
               "CODEC=")) != (char *)NULL)
            {
               (void)strncpy(chararray, ptr+6, 4); 
@@ -3538,7 +3807,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
                   return (-1);
               }
            }
-           if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+           if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
               "BITS=")) != (char *)NULL)
            {
               (void)strncpy(chararray, ptr+5, 2); 
@@ -3569,12 +3838,11 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
     }
 #endif
 #ifdef HAVE_FPZIP
-    else if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
-       "METHOD=FPZIP")) != (char *)NULL) 
+    else if (!strcmp(cp.method, "FPZIP"))
     {
        if (have_fpzip == FALSE)
        {
-          if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+          if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
              "LOSS=")) != (char *)NULL)
           {
              (void)strncpy(chararray, ptr+5, 2); 
@@ -3585,7 +3853,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
              }
              else
              {
-                db_perror(DBGetCompressionFile(dbfile), E_COMPRESSION, me);
+                db_perror(db_hdf5_compression_string(dbfile), E_COMPRESSION, me);
                 return (-1);
              }
           }
@@ -3599,17 +3867,25 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
     }
 #endif
 #ifdef HAVE_ZFP
-    else if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
-       "METHOD=ZFP")) != (char *)NULL) 
+    else if (!strcmp(cp.method, "ZFP"))
     {
+       /* Execution policy is not a property of the dataset; it is
+          applied around each write by db_hdf5_set_zfp_execution */
+       if (cp.exec == DB_HDF5_EXEC_BAD)
+       {
+          db_perror(db_hdf5_compression_string(dbfile), E_COMPRESSION, me);
+          return -1;
+       }
+
        if (have_zfp == FALSE)
        {
           double tmpdbl = -1;
           uint tmpuint = 0;
           unsigned int cd_values[H5Z_ZFP_CD_NELMTS_MEM];
           int cd_nelmts = H5Z_ZFP_CD_NELMTS_MEM;
-          
-          if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+
+          errno = 0; /* checked after parsing below */
+          if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
              "RATE=")) != (char *)NULL)
           {
              strncpy(chararray, ptr+5, 8); 
@@ -3617,7 +3893,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
              if (chararray != check && errno == 0 && tmpdbl > 0)
                  H5Pset_zfp_rate_cdata(tmpdbl, cd_nelmts, cd_values);
           }
-          else if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+          else if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
              "PRECISION=")) != (char *)NULL)
           {
              strncpy(chararray, ptr+10, 2); 
@@ -3625,7 +3901,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
              if (chararray != check && errno == 0 && tmpuint > 0)
                  H5Pset_zfp_precision_cdata(tmpuint, cd_nelmts, cd_values);
           }
-          else if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+          else if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
              "ACCURACY=")) != (char *)NULL)
           {
              strncpy(chararray, ptr+9, 8); 
@@ -3633,7 +3909,7 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
              if (chararray != check && errno == 0 && tmpdbl > 0)
                  H5Pset_zfp_accuracy_cdata(tmpdbl, cd_nelmts, cd_values);
           }
-          else if ((ptr=(char *)strstr(DBGetCompressionFile(dbfile), 
+          else if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
              "EXPERT=")) != (char *)NULL)
           {
              int nvals, minexp; unsigned int minbits, maxbits, maxprec;
@@ -3642,14 +3918,14 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
              if (nvals == 4 && errno == 0)
                  H5Pset_zfp_expert_cdata(minbits, maxbits, maxprec, minexp, cd_nelmts, cd_values);
           }
-          else if ((ptr=(char *)strstr(SILO_Globals.compressionParams, 
+          else if ((ptr=(char *)strstr(db_hdf5_compression_string(dbfile), 
              "REVERSIBLE")) != (char *)NULL)
           {
               H5Pset_zfp_reversible_cdata(cd_nelmts, cd_values);
           }
           else
           {
-              db_perror(DBGetCompressionFile(dbfile), E_COMPRESSION, me);
+              db_perror(db_hdf5_compression_string(dbfile), E_COMPRESSION, me);
               return -1;
           }
 
@@ -3663,12 +3939,162 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
 #endif
     else
     {
-       db_perror(DBGetCompressionFile(dbfile), E_COMPRESSION, me);
+       db_perror(db_hdf5_compression_string(dbfile), E_COMPRESSION, me);
        return (-1);
     }
     return 0;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_compression_nthreads
+ *
+ * Purpose:     Number of threads to compress a dataset's chunks with, from
+ *              "NTHREADS=<n>" in the compression string. Zero means one
+ *              per online processor.
+ *
+ * Return:      The thread count, 1 if chunks are compressed by HDF5 alone.
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE int
+db_hdf5_compression_nthreads(DBfile *dbfile)
+{
+    db_hdf5_cparams_t cp;
+    int n;
+
+    db_hdf5_parse_compression(db_hdf5_compression_string(dbfile), &cp);
+    if ((n = cp.nthreads) < 0)
+        return 1;
+#if defined(HAVE_PTHREAD) && defined(_SC_NPROCESSORS_ONLN)
+    if (n == 0)
+        n = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return n > 1 ? n : 1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_set_zfp_execution
+ *
+ * Purpose:     Select the ZFP filter's execution policy ("EXEC=" in the
+ *              file's compression string) for this thread's writes, or
+ *              serial execution again once the write is done (on == 0).
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+db_hdf5_set_zfp_execution(DBfile *dbfile, int on)
+{
+#ifdef HAVE_ZFP
+    db_hdf5_cparams_t cp;
+
+    if (on)
+    {
+        db_hdf5_parse_compression(db_hdf5_compression_string(dbfile), &cp);
+        if (!strcmp(cp.method, "ZFP") && cp.exec == DB_HDF5_EXEC_OMP)
+        {
+            H5Z_zfp_set_execution(1, cp.omp_threads); /* falls back to serial */
+            return;
+        }
+    }
+    H5Z_zfp_set_execution(0, 0);
+#endif
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_set_read_precision
+ *
+ * Purpose:     Pass the file's read precision (DBSetReadPrecisionFile) to
+ *              the ZFP filter ahead of reading datasets.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+db_hdf5_set_read_precision(DBfile *dbfile)
+{
+#ifdef HAVE_ZFP
+    int prec = DBGetReadPrecisionFile(dbfile);
+    H5Z_zfp_set_read_precision(prec > 0 ? (unsigned int) prec : 0);
+#endif
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_chunk_dims
+ *
+ * Purpose:     Compute the chunk shape for a filtered (compressed and/or
+ *              checksummed) dataset of the given size and file type.
+ *
+ *              By default, the whole dataset is a single chunk. When the
+ *              compression string contains "CHUNKSIZE=<n>[K|M|G]", the
+ *              dataset is instead split into chunks of at most n bytes.
+ *              The chunk shape is found by repeatedly halving the largest
+ *              chunk dimension so that chunks stay roughly cubic. That way
+ *              slices, lineouts and subsets read by DBReadVarSlice touch
+ *              (and decompress) only the chunks they overlap. For ZFP,
+ *              chunk dimensions are kept multiples of 4, ZFP's block size.
+ *              HZIP and FPZIP compress whole objects and are never split.
+ *              "NTHREADS=<n>" without CHUNKSIZE implies 1 megabyte chunks,
+ *              since threads compress whole chunks.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+db_hdf5_chunk_dims(DBfile *dbfile, int rank, hsize_t const size[],
+    hid_t ftype, hsize_t chunk[])
+{
+    char const *cstr = db_hdf5_compression_string(dbfile);
+    db_hdf5_cparams_t cp;
+    double target = 0;
+    hsize_t nbytes;
+    size_t elsize;
+    int i;
+
+    for (i = 0; i < rank; i++)
+        chunk[i] = size[i];
+
+    if (!cstr)
+        return;
+    db_hdf5_parse_compression(cstr, &cp);
+    if (!strcmp(cp.method, "HZIP") || !strcmp(cp.method, "FPZIP"))
+        return;
+
+    if (cp.chunksize > 0)
+        target = cp.chunksize;
+    else if (db_hdf5_compression_nthreads(dbfile) > 1)
+        target = DB_HDF5_MT_CHUNK_BYTES;
+    else
+        return;
+    if (target <= 0 || ftype < 0 || (elsize = H5Tget_size(ftype)) == 0)
+        return;
+
+    while (1)
+    {
+        int imax = 0;
+        for (i = 0, nbytes = elsize; i < rank; i++)
+        {
+            nbytes *= chunk[i];
+            if (chunk[i] > chunk[imax]) imax = i;
+        }
+        if ((double) nbytes <= target || chunk[imax] <= 1)
+            break;
+        chunk[imax] = (chunk[imax] + 1) / 2;
+    }
+
+    if (!strcmp(cp.method, "ZFP"))
+    {
+        for (i = 0; i < rank; i++)
+        {
+            chunk[i] = ((chunk[i] + 3) / 4) * 4;
+            if (chunk[i] > size[i]) chunk[i] = size[i];
+        }
+    }
+}
+
 /*-------------------------------------------------------------------------
  * Function:    db_hdf5_set_properties
  *
@@ -3688,29 +4114,34 @@ db_hdf5_set_compression(DBfile *dbfile, int flags)
  *-------------------------------------------------------------------------
  */
 PRIVATE int
-db_hdf5_set_properties(DBfile *dbfile, int rank, hsize_t size[])
+db_hdf5_set_properties(DBfile *dbfile, int rank, hsize_t size[], hid_t ftype)
 {
     static char *me = "db_hdf5_set_properties";
+    hsize_t chunk[H5S_MAX_RANK];
+
     P_crprops = H5P_DEFAULT;
+    if (DBGetEnableChecksumsFile(dbfile) || db_hdf5_get_compression(dbfile))
+    {
+        db_hdf5_chunk_dims(dbfile, rank, size, ftype, chunk);
+        H5Pset_chunk(P_ckcrprops, rank, chunk);
+    }
+
     if (DBGetEnableChecksumsFile(dbfile) && 
-        !DBGetCompressionFile(dbfile))
+        !db_hdf5_get_compression(dbfile))
     {
-        H5Pset_chunk(P_ckcrprops, rank, size);
         P_crprops = P_ckcrprops;
     }
     else if (DBGetEnableChecksumsFile(dbfile) && 
-        DBGetCompressionFile(dbfile))
+        db_hdf5_get_compression(dbfile))
     {
-        H5Pset_chunk(P_ckcrprops, rank, size);
         if (db_hdf5_set_compression(dbfile, 0)<0) {
             db_perror("db_hdf5_set_compression", E_CALLFAIL, me);
             return(-1);
         }
         P_crprops = P_ckcrprops;
     }
-    else if (DBGetCompressionFile(dbfile))
+    else if (db_hdf5_get_compression(dbfile))
     {
-        H5Pset_chunk(P_ckcrprops, rank, size);
         if (db_hdf5_set_compression(dbfile, 0)<0) {
             db_perror("db_hdf5_set_compression", E_CALLFAIL, me);
             return(-1);
@@ -3719,78 +4150,440 @@ db_hdf5_set_properties(DBfile *dbfile, int rank, hsize_t size[])
     }
     return 0;
 }
+
+/* Bytes of an array that METHOD=AUTO tries each codec on, gathered from
+   this many places in the array, and the size below which arrays are not
+   worth sampling and get DB_HDF5_AUTO_DEFAULT */
+#define DB_HDF5_AUTO_SAMPLE_BYTES (256*1024)
+#define DB_HDF5_AUTO_SAMPLE_BLOCKS 8
+#define DB_HDF5_AUTO_MIN_BYTES 4096
+
+/* Wall clock seconds, for timing compression */
+static double
+db_hdf5_wall_time(void)
+{
+#if HAVE_SYS_TIME_H
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return (double) tv.tv_sec + (double) tv.tv_usec * 1.0e-6;
+#else
+    return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
 /*-------------------------------------------------------------------------
- * Function:    db_hdf5_get_comp_var 
+ * Function:    db_hdf5_auto_sample
  *
- * Purpose:     Given a file handle and varname containing at least one
- *              underscore, attempts to get size and, optionally, read
- *              the corresponding HDF5 datatype name and member
- *              name pair, if it exists, formed by splitting the given
- *              varname at the underscore character. If multiple splits
- *              could possibly match with an HDF5 datatype name and member
- *              name pair in the file, only the first found is returned.
- *
- *              This function is necessary to support the old pdb-ish way
- *              of permitting a Silo client to request raw data arrays
- *              for the component of an object by the naming convention
- *              "<objname>_<compname>"
- *
- * Return:      If a valid split exists:                1
- *
- *              If a valid split does not exist:        0 
+ * Purpose:     Gather a sample of about DB_HDF5_AUTO_SAMPLE_BYTES from
+ *              DB_HDF5_AUTO_SAMPLE_BLOCKS evenly spaced places in an
+ *              array. Whole slabs along the slowest dimension are taken
+ *              when they are small enough, so the sample keeps the
+ *              array's shape; otherwise runs of elements are taken and
+ *              the sample is 1D.
  *
- * Programmer:  Mark C. Miller 
- *              October 11, 2005 
+ * Return:      The sample, which is buf itself when the whole array is
+ *              small enough, or NULL on allocation failure. The sample's
+ *              rank and dimensions are returned in srank and sdims.
  *
  *-------------------------------------------------------------------------
  */
-PRIVATE int
-db_hdf5_get_comp_var(DBfile *_dbfile, char const *name, hsize_t *nelmts,
-    size_t *elsize, hsize_t *fsize, hid_t *datatype, void **buf)
+PRIVATE void const *
+db_hdf5_auto_sample(int rank, hsize_t const size[], size_t elsize,
+    void const *buf, int *srank, hsize_t sdims[])
 {
-    DBfile_hdf5 *dbfile = (DBfile_hdf5*)_dbfile;
-    hid_t fileid = dbfile->cwg;
-    hid_t type_id = -1, stypeid = -1, attr = -1, comptype = -1, memtype = -1;
-    int membno = -1;
-    int retval = 0;
-    hsize_t numvals = 0;
-    size_t valsize = 0;
-    hsize_t filesize = 0;
-
-    /* loop trying different typename, member name combinations */
-    char *tmpname = STRDUP(name);
-    char *p = strrchr(tmpname, '_');
-    char *type_name, *memname;
-    while (p != 0 && *p != '\0')
-    {
-        char *tmpp = p;
-        *p = '\0';
-        type_name = tmpname;
-        memname = p+1;
+    size_t nblocks = DB_HDF5_AUTO_SAMPLE_BLOCKS;
+    size_t slab = elsize, nbytes, blkbytes, b;
+    hsize_t nslabs = size[0];
+    char *sample;
+    int i;
 
-        stypeid = attr = type_id = -1;
-        if ((type_id=H5Topen(fileid, type_name, H5P_DEFAULT))>=0 &&
-            (attr=H5Aopen_name(type_id, "silo"))>=0 &&
-            (stypeid=H5Aget_type(attr))>=0 &&
-            (membno=H5Tget_member_index(stypeid, memname))>=0)
-            retval = 1;
+    for (i = 1; i < rank; i++)
+        slab *= (size_t) size[i];
+    nbytes = slab * (size_t) nslabs;
 
-        if (retval == 1) break;
+    *srank = rank;
+    for (i = 0; i < rank; i++)
+        sdims[i] = size[i];
+    if (nbytes <= DB_HDF5_AUTO_SAMPLE_BYTES)
+        return buf;
 
-        if (attr != -1) H5Aclose(attr);
-        if (stypeid != -1) H5Tclose(stypeid);
-        if (type_id != -1) H5Tclose(type_id);
+    if (!(sample = (char *) malloc(DB_HDF5_AUTO_SAMPLE_BYTES)))
+        return 0;
 
-        p = strrchr(tmpname, '_');
-        *tmpp = '_';
+    if (rank > 1 && slab <= DB_HDF5_AUTO_SAMPLE_BYTES / nblocks)
+    {
+        /* k whole slabs from each of nblocks places along dimension 0 */
+        hsize_t k = DB_HDF5_AUTO_SAMPLE_BYTES / nblocks / slab;
+        blkbytes = (size_t) k * slab;
+        for (b = 0; b < nblocks; b++)
+        {
+            hsize_t start = b * (nslabs - k) / (nblocks - 1);
+            memcpy(sample + b * blkbytes, (char const *) buf + start * slab, blkbytes);
+        }
+        sdims[0] = k * nblocks;
     }
-
-    if (retval == 1)
+    else
     {
-        hid_t mbtype = H5Tget_member_type(stypeid, membno);
-        H5T_class_t mbclass = H5Tget_class(mbtype);
-
-        switch (mbclass) {
+        /* runs of elements from nblocks places in the flattened array */
+        size_t nels = nbytes / elsize;
+        size_t k = DB_HDF5_AUTO_SAMPLE_BYTES / nblocks / elsize;
+        blkbytes = k * elsize;
+        for (b = 0; b < nblocks; b++)
+        {
+            size_t start = b * (nels - k) / (nblocks - 1);
+            memcpy(sample + b * blkbytes, (char const *) buf + start * elsize, blkbytes);
+        }
+        *srank = 1;
+        sdims[0] = k * nblocks;
+    }
+    return sample;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_auto_compression
+ *
+ * Purpose:     Choose the codec for an array about to be written under
+ *              METHOD=AUTO. Each codec available in this build is tried
+ *              on a sample of the array written to an in-memory file, and
+ *              its compression ratio and speed measured. The lossless
+ *              candidates are GZIP (levels 1, 5 and 9), SZIP, FPZIP and
+ *              ZFP in reversible mode; "ACCURACY=<tol>" adds ZFP with
+ *              that error tolerance. HZIP, which needs whole mesh
+ *              objects, is not tried.
+ *
+ *              With GOAL=SIZE (the default) the codec giving the smallest
+ *              sample among those at least MINSPEED megabytes/second fast
+ *              wins. With GOAL=SPEED the fastest codec achieving MINRATIO
+ *              wins. When no codec meets the floor, the fastest (SIZE) or
+ *              the smallest (SPEED) is used.
+ *
+ *              The choice governs compression until
+ *              db_hdf5_compression_record attaches it to the new dataset.
+ *
+ * Return:      void; the array gets DB_HDF5_AUTO_DEFAULT if it is too small
+ *              to sample or sampling fails.
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+db_hdf5_auto_compression(DBfile *dbfile, int rank, hsize_t const size[],
+    hid_t ftype, hid_t mtype, void const *buf)
+{
+    static char const *candidates[] = {
+        "METHOD=GZIP LEVEL=1", "METHOD=GZIP LEVEL=5", "METHOD=GZIP LEVEL=9",
+#ifdef H5_HAVE_FILTER_SZIP
+        "METHOD=SZIP",
+#endif
+#ifdef HAVE_FPZIP
+        "METHOD=FPZIP LOSS=0",
+#endif
+#ifdef HAVE_ZFP
+        "METHOD=ZFP REVERSIBLE",
+        0 /* ZFP ACCURACY=<tol>, if requested */
+#endif
+    };
+    char const *cstr = db_hdf5_get_compression(dbfile);
+    char val[64], method[64], trial[256];
+    int goal_speed = db_hdf5_cparam(cstr, "GOAL", val, sizeof(val)) &&
+                     !strcmp(val, "SPEED");
+    double minspeed = 0, minratio = 1, tol = 0;
+    double best_ratio = 0, best_speed = 0;
+    int best = -1, best_ok = FALSE;
+    size_t elsize = H5Tget_size(mtype), fsize = H5Tget_size(ftype);
+    hsize_t sdims[H5S_MAX_RANK], npoints = 1;
+    void const *sample = 0;
+    hid_t fapl = -1, dapl = -1, fid = -1;
+    int srank, i;
+
+    db_hdf5_auto_params(cstr, DB_HDF5_AUTO_DEFAULT, db_hdf5_auto_choice,
+        sizeof(db_hdf5_auto_choice));
+    db_hdf5_auto_cstr = db_hdf5_auto_choice;
+    snprintf(db_hdf5_auto_report, sizeof(db_hdf5_auto_report),
+        "%s (auto: not sampled)", db_hdf5_auto_choice);
+
+    if (db_hdf5_cparam(cstr, "MINSPEED", val, sizeof(val))) minspeed = strtod(val, 0);
+    if (db_hdf5_cparam(cstr, "MINRATIO", val, sizeof(val))) minratio = strtod(val, 0);
+    if (db_hdf5_cparam(cstr, "ACCURACY", val, sizeof(val))) tol = strtod(val, 0);
+
+    for (i = 0; i < rank; i++)
+        npoints *= size[i];
+    if (npoints * fsize < DB_HDF5_AUTO_MIN_BYTES || elsize == 0 || fsize == 0)
+        return;
+    if (!(sample = db_hdf5_auto_sample(rank, size, elsize, buf, &srank, sdims)))
+        return;
+    for (i = 0, npoints = 1; i < srank; i++)
+        npoints *= sdims[i];
+
+    /* No chunk cache, so chunks are compressed within H5Dwrite */
+    H5E_BEGIN_TRY {
+        if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) >= 0 &&
+            H5Pset_fapl_core(fapl, DB_HDF5_AUTO_SAMPLE_BYTES, FALSE) >= 0 &&
+            (dapl = H5Pcreate(H5P_DATASET_ACCESS)) >= 0 &&
+            H5Pset_chunk_cache(dapl, 0, 0, 1.0) >= 0)
+            fid = H5Fcreate("silo-auto-compression", H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    } H5E_END_TRY;
+
+    for (i = 0; fid >= 0 && i < (int) NELMTS(candidates); i++)
+    {
+        hid_t space = -1, dset = -1;
+        hsize_t stored = 0;
+        double t0, t1, ratio, speed;
+        herr_t status = -1;
+        int ok;
+
+        if (candidates[i])
+            snprintf(method, sizeof(method), "%s", candidates[i]);
+        else if (tol > 0)
+            snprintf(method, sizeof(method), "METHOD=ZFP ACCURACY=%g", tol);
+        else
+            continue;
+
+        db_hdf5_auto_params(cstr, method, trial, sizeof(trial));
+        db_hdf5_auto_cstr = trial;
+        H5E_BEGIN_TRY {
+            if (db_hdf5_set_properties(dbfile, srank, sdims, ftype) >= 0 &&
+                (space = H5Screate_simple(srank, sdims, 0)) >= 0 &&
+                (dset = H5Dcreate(fid, method, ftype, space, H5P_DEFAULT,
+                                  P_crprops, dapl)) >= 0)
+            {
+                t0 = db_hdf5_wall_time();
+                status = H5Dwrite(dset, mtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, sample);
+                t1 = db_hdf5_wall_time();
+                stored = H5Dget_storage_size(dset);
+            }
+            H5Dclose(dset);
+            H5Sclose(space);
+        } H5E_END_TRY;
+        db_hdf5_auto_cstr = db_hdf5_auto_choice;
+        if (status < 0 || stored == 0)
+            continue;
+
+        ratio = (double) (npoints * fsize) / (double) stored;
+        speed = t1 > t0 ? (double) (npoints * elsize) / (t1 - t0) / (1<<20) : 1e30;
+        ok = goal_speed ? ratio >= minratio : speed >= minspeed;
+
+        /* prefer candidates meeting the floor, then by the goal, and
+           the fastest (SIZE) or smallest (SPEED) if none meets it */
+        if (best < 0 || (ok && !best_ok) ||
+            (ok && best_ok && (goal_speed ? speed > best_speed : ratio > best_ratio)) ||
+            (!ok && !best_ok && (goal_speed ? ratio > best_ratio : speed > best_speed)))
+        {
+            best = i;
+            best_ok = ok;
+            best_ratio = ratio;
+            best_speed = speed;
+            db_hdf5_auto_params(cstr, method, db_hdf5_auto_choice,
+                sizeof(db_hdf5_auto_choice));
+        }
+    }
+
+    H5E_BEGIN_TRY {
+        H5Fclose(fid);
+        H5Pclose(dapl);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    if (sample != buf)
+        free((void *) sample);
+
+    /* the trials leave the sample's filters and chunking behind */
+    db_hdf5_clear_compression();
+    if (best < 0)
+        return;
+    snprintf(db_hdf5_auto_report, sizeof(db_hdf5_auto_report),
+        "%s (auto: GOAL=%s, ratio %.3g, %.3g MB/s on a %llu byte sample%s)",
+        db_hdf5_auto_choice, goal_speed ? "SPEED" : "SIZE", best_ratio,
+        best_speed, (unsigned long long) (npoints * elsize),
+        best_ok ? "" : goal_speed ? ", below MINRATIO" : ", below MINSPEED");
+}
+
+/* Layout of the "silo_compression_stats" attribute */
+typedef struct db_hdf5_compstats_t {
+    long long original_bytes;
+    long long stored_bytes;
+    double    write_time;
+} db_hdf5_compstats_t;
+
+PRIVATE hid_t
+db_hdf5_compstats_type(void)
+{
+    hid_t t = H5Tcreate(H5T_COMPOUND, sizeof(db_hdf5_compstats_t));
+    H5Tinsert(t, "original_bytes", HOFFSET(db_hdf5_compstats_t, original_bytes), H5T_NATIVE_LLONG);
+    H5Tinsert(t, "stored_bytes", HOFFSET(db_hdf5_compstats_t, stored_bytes), H5T_NATIVE_LLONG);
+    H5Tinsert(t, "write_time", HOFFSET(db_hdf5_compstats_t, write_time), H5T_NATIVE_DOUBLE);
+    return t;
+}
+
+/* A dataset's original and stored bytes as they are now */
+PRIVATE void
+db_hdf5_compstats_sizes(hid_t dset, db_hdf5_compstats_t *cs)
+{
+    hid_t ftype = H5Dget_type(dset), fspace = H5Dget_space(dset);
+
+    cs->original_bytes = (long long) H5Sget_simple_extent_npoints(fspace) *
+                         (long long) H5Tget_size(ftype);
+    cs->stored_bytes = (long long) H5Dget_storage_size(dset);
+    H5Sclose(fspace);
+    H5Tclose(ftype);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_compression_record
+ *
+ * Purpose:     Record how a newly written compressed dataset fared: its
+ *              compression string (under METHOD=AUTO, the codec chosen and
+ *              why) as the "silo_compression" attribute, and its original
+ *              and stored sizes and the seconds its write took as the
+ *              "silo_compression_stats" attribute. Any METHOD=AUTO choice
+ *              ends here.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+db_hdf5_compression_record(DBfile *dbfile, hid_t dset, double seconds)
+{
+    char const *report = db_hdf5_auto_cstr ? db_hdf5_auto_report : 0;
+    hid_t atype = -1, space = -1, attr = -1;
+    db_hdf5_compstats_t cs;
+
+    db_hdf5_auto_cstr = 0;
+    if (!db_hdf5_get_compression(dbfile) || dset < 0)
+        return;
+    if (!report)
+    {
+        snprintf(db_hdf5_auto_report, sizeof(db_hdf5_auto_report), "%s",
+            db_hdf5_compression_string(dbfile));
+        report = db_hdf5_auto_report;
+    }
+
+    H5E_BEGIN_TRY {
+        db_hdf5_compstats_sizes(dset, &cs);
+        cs.write_time = seconds;
+
+        space = H5Screate(H5S_SCALAR);
+        if ((atype = H5Tcopy(H5T_C_S1)) >= 0 &&
+            H5Tset_size(atype, strlen(report)+1) >= 0 &&
+            (attr = H5Acreate(dset, "silo_compression", atype, space,
+                              H5P_DEFAULT, H5P_DEFAULT)) >= 0)
+            H5Awrite(attr, atype, report);
+        H5Aclose(attr);
+        H5Tclose(atype);
+
+        if ((atype = db_hdf5_compstats_type()) >= 0 &&
+            (attr = H5Acreate(dset, "silo_compression_stats", atype, space,
+                              H5P_DEFAULT, H5P_DEFAULT)) >= 0)
+            H5Awrite(attr, atype, &cs);
+        H5Aclose(attr);
+        H5Tclose(atype);
+        H5Sclose(space);
+    } H5E_END_TRY;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_compression_update
+ *
+ * Purpose:     Bring the "silo_compression_stats" attribute of a dataset
+ *              up to date after a later write to it: its sizes as they
+ *              are now, with the write's seconds added. Datasets without
+ *              the attribute were not compressed and are left alone.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+db_hdf5_compression_update(hid_t dset, double seconds)
+{
+    hid_t atype = -1, attr = -1;
+    db_hdf5_compstats_t cs;
+
+    H5E_BEGIN_TRY {
+        if ((attr = H5Aopen_name(dset, "silo_compression_stats")) >= 0 &&
+            (atype = db_hdf5_compstats_type()) >= 0 &&
+            H5Aread(attr, atype, &cs) >= 0)
+        {
+            db_hdf5_compstats_sizes(dset, &cs);
+            cs.write_time += seconds;
+            H5Awrite(attr, atype, &cs);
+        }
+        H5Aclose(attr);
+        H5Tclose(atype);
+    } H5E_END_TRY;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_get_comp_var 
+ *
+ * Purpose:     Given a file handle and varname containing at least one
+ *              underscore, attempts to get size and, optionally, read
+ *              the corresponding HDF5 datatype name and member
+ *              name pair, if it exists, formed by splitting the given
+ *              varname at the underscore character. If multiple splits
+ *              could possibly match with an HDF5 datatype name and member
+ *              name pair in the file, only the first found is returned.
+ *
+ *              This function is necessary to support the old pdb-ish way
+ *              of permitting a Silo client to request raw data arrays
+ *              for the component of an object by the naming convention
+ *              "<objname>_<compname>"
+ *
+ * Return:      If a valid split exists:                1
+ *
+ *              If a valid split does not exist:        0 
+ *
+ * Programmer:  Mark C. Miller 
+ *              October 11, 2005 
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE int
+db_hdf5_get_comp_var(DBfile *_dbfile, char const *name, hsize_t *nelmts,
+    size_t *elsize, hsize_t *fsize, hid_t *datatype, void **buf)
+{
+    DBfile_hdf5 *dbfile = (DBfile_hdf5*)_dbfile;
+    hid_t fileid = dbfile->cwg;
+    hid_t type_id = -1, stypeid = -1, attr = -1, comptype = -1, memtype = -1;
+    int membno = -1;
+    int retval = 0;
+    hsize_t numvals = 0;
+    size_t valsize = 0;
+    hsize_t filesize = 0;
+
+    /* loop trying different typename, member name combinations */
+    char *tmpname = STRDUP(name);
+    char *p = strrchr(tmpname, '_');
+    char *type_name, *memname;
+    while (p != 0 && *p != '\0')
+    {
+        char *tmpp = p;
+        *p = '\0';
+        type_name = tmpname;
+        memname = p+1;
+
+        stypeid = attr = type_id = -1;
+        if ((type_id=H5Topen(fileid, type_name, H5P_DEFAULT))>=0 &&
+            (attr=H5Aopen_name(type_id, "silo"))>=0 &&
+            (stypeid=H5Aget_type(attr))>=0 &&
+            (membno=H5Tget_member_index(stypeid, memname))>=0)
+            retval = 1;
+
+        if (retval == 1) break;
+
+        if (attr != -1) H5Aclose(attr);
+        if (stypeid != -1) H5Tclose(stypeid);
+        if (type_id != -1) H5Tclose(type_id);
+
+        p = strrchr(tmpname, '_');
+        *tmpp = '_';
+    }
+
+    if (retval == 1)
+    {
+        hid_t mbtype = H5Tget_member_type(stypeid, membno);
+        H5T_class_t mbclass = H5Tget_class(mbtype);
+
+        switch (mbclass) {
             case H5T_INTEGER:
                 numvals = 1;
                 comptype = H5T_NATIVE_INT;
@@ -3877,6 +4670,7 @@ db_hdf5_get_comp_var(DBfile *_dbfile, char const *name, hsize_t *nelmts,
                     P_rdprops = H5P_DEFAULT;
                     if (!DBGetEnableChecksumsFile(_dbfile))
                         P_rdprops = P_ckrdprops;
+                    db_hdf5_set_read_precision(_dbfile);
 
                     if (H5Dread(d, mtype, H5S_ALL, H5S_ALL, P_rdprops, *buf)<0) {
                         hdf5_to_silo_error(name, "db_hdf5_get_comp_var");
@@ -3938,33 +4732,29 @@ db_hdf5_get_comp_var(DBfile *_dbfile, char const *name, hsize_t *nelmts,
 }
 
 /*-------------------------------------------------------------------------
- * Function:    load_toc
+ * Function:    load_toc_classify
  *
- * Purpose:     Add an object to the table of contents
+ * Purpose:     Determine the Silo object type of a link in a group and
+ *              whether it is a (soft or external) link.
  *
- * Return:      Success:        0
+ * Return:      Success:        0, objtype is DB_INVALID_OBJECT for
+ *                              things that do not belong in the TOC.
  *
  *              Failure:        -1
  *
  * Programmer:  Robb Matzke
  *              Thursday, February 11, 1999
  *
- * Modifications:
- *
- *   Mark C. Miller, Tue Feb  1 13:48:33 PST 2005
- *   Made it deal with case of QUAD_RECT or QUAD_CURV
- *
  *-------------------------------------------------------------------------
  */
-PRIVATE herr_t
-load_toc(hid_t grp, char const *name, H5L_info_t const *dummy, void *_toc)
+PRIVATE int
+load_toc_classify(hid_t grp, char const *name, DBObjectType *_objtype_out,
+    int *islink_out, unsigned long objno[2])
 {
-    DBtoc               *toc = (DBtoc*)_toc;
     H5G_stat_t          sb;
     H5L_info_t          lb;
     DBObjectType        objtype = DB_INVALID_OBJECT;
-    int                 *nvals=NULL, _objtype, islink=0;
-    char                ***names=NULL;
+    int                 _objtype, islink=0;
     hid_t               obj=-1, attr=-1;
 
     if (H5Gget_objinfo(grp, name, FALSE, &sb)<0) return -1;
@@ -4013,6 +4803,33 @@ load_toc(hid_t grp, char const *name, H5L_info_t const *dummy, void *_toc)
         break;
     }
 
+    *_objtype_out = objtype;
+    *islink_out = islink;
+    if (objno) {
+        objno[0] = sb.objno[0];
+        objno[1] = sb.objno[1];
+    }
+
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    load_toc_append
+ *
+ * Purpose:     Add a named object of the given type to the table of
+ *              contents. For links, TARGET is the link's target.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+load_toc_append(DBtoc *toc, char const *name, DBObjectType objtype,
+    int islink, char const *target)
+{
+    int                 *nvals=NULL;
+    char                ***names=NULL;
+
     /* What table of contents field does this object belong to? */
     switch (objtype) {
     case DB_INVALID_OBJECT:
@@ -4143,17 +4960,48 @@ load_toc(hid_t grp, char const *name, H5L_info_t const *dummy, void *_toc)
         *names = (char **)realloc(*names, *nvals*sizeof(char*));
         (*names)[n1] = STRDUP(name);
         if (islink) {
-            char target[2*256];
             int n2 = toc->nsymlink++;
             toc->symlink_names = (char **) realloc(toc->symlink_names, (n2+1)*sizeof(char*));
             toc->symlink_names[n2] = (*names)[n1]; /* note: copy of the pointer */
             toc->symlink_target_names = (char **) realloc(toc->symlink_target_names, (n2+1)*sizeof(char*));
-            if (db_hdf5_getslink(grp, name, target) == 0)
-                toc->symlink_target_names[n2] = STRDUP(target);
-            else
-                toc->symlink_target_names[n2] = STRDUP("unknown");
+            toc->symlink_target_names[n2] = STRDUP(target ? target : "unknown");
         }
     }
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    load_toc
+ *
+ * Purpose:     Add an object to the table of contents
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *
+ * Programmer:  Robb Matzke
+ *              Thursday, February 11, 1999
+ *
+ * Modifications:
+ *
+ *   Mark C. Miller, Tue Feb  1 13:48:33 PST 2005
+ *   Made it deal with case of QUAD_RECT or QUAD_CURV
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE herr_t
+load_toc(hid_t grp, char const *name, H5L_info_t const *dummy, void *_toc)
+{
+    DBtoc               *toc = (DBtoc*)_toc;
+    DBObjectType        objtype;
+    int                 islink;
+    char                target[2*256];
+
+    if (load_toc_classify(grp, name, &objtype, &islink, 0)<0) return -1;
+    if (objtype == DB_INVALID_OBJECT) return 0;
+
+    if (islink && db_hdf5_getslink(grp, name, target) != 0)
+        strcpy(target, "unknown");
+    load_toc_append(toc, name, objtype, islink, islink ? target : 0);
 
     return 0;
 }
@@ -4243,89 +5091,997 @@ db_hdf5_handle_ctdt(DBfile_hdf5 *dbfile, int ts, float t, int dts, double dt, in
                 }
             }
 
-            mtype = silom2hdfm_type(types[i]);
-            ftype = silof2hdff_type(dbfile, types[i]);
-            if (space == -1)
-                space = H5Screate_simple(1, &one, &one);
-            dset = H5Dcreate(dbfile->cwg, names[i], ftype, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-            H5Dwrite(dset, mtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf[i]);
-            H5Dclose(dset);
-        }
+            mtype = silom2hdfm_type(types[i]);
+            ftype = silof2hdff_type(dbfile, types[i]);
+            if (space == -1)
+                space = H5Screate_simple(1, &one, &one);
+            dset = H5Dcreate(dbfile->cwg, names[i], ftype, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+            H5Dwrite(dset, mtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf[i]);
+            H5Dclose(dset);
+        }
+
+        if (space != -1)
+            H5Sclose(space);
+
+    }
+    H5E_END_TRY;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    max_compname
+ *
+ * Purpose:     H5Literate callback to find the largest number among the
+ *              "#<number>" names in the link group.
+ *
+ * Return:      0
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE herr_t
+max_compname(hid_t grp, char const *name, H5L_info_t const *dummy, void *_max)
+{
+    long long *max = (long long *) _max;
+    char *end;
+    long long n;
+
+    if (name[0] != '#' || name[1] < '0' || name[1] > '9')
+        return 0;
+    n = strtoll(name+1, &end, 10);
+    if (!*end && n > *max)
+        *max = n;
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_compname
+ *
+ * Purpose:     Returns a new name relative to the link directory. The name
+ *              is generated by incrementing the link counter held in the
+ *              file struct and creating a name from it. The counter is
+ *              initialized from the `nlinks' attribute of the link
+ *              directory on first use and is written back to that
+ *              attribute only when the file is flushed or closed (see
+ *              db_hdf5_save_nlinks). If the name after the attribute's
+ *              count is taken, the attribute is stale and the counter is
+ *              set from the largest name in the link group instead.
+ *
+ * Return:      Success:        0, A new link name not more than
+ *                              DB_HDF5_COMPNAME_LEN characters long
+ *                              counting the null terminator is returned
+ *                              through the NAME argument.
+ *
+ *              Failure:        -1
+ *
+ * Programmer:  Robb Matzke
+ *              Tuesday, March 23, 1999
+ *
+ * Modifications:
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE int
+db_hdf5_compname(DBfile_hdf5 *dbfile, char name[DB_HDF5_COMPNAME_LEN]/*out*/)
+{
+    static char *me = "db_hdf5_compname";
+    hid_t       attr=-1;
+
+    PROTECT {
+        if (dbfile->nlinks_saved < 0)
+        {
+            long long nlinks = 0;
+
+            /* Initialize the counter from the `nlinks' attribute, if any */
+            H5E_BEGIN_TRY {
+                attr = H5Aopen_name(dbfile->link, "nlinks");
+            } H5E_END_TRY;
+            if (attr>=0) {
+                if (H5Aread(attr, H5T_NATIVE_LLONG, &nlinks)<0) {
+                    db_perror("nlinks attribute", E_CALLFAIL, me);
+                    UNWIND();
+                }
+                H5Aclose(attr);
+                attr = -1;
+            }
+            dbfile->nlinks = dbfile->nlinks_saved = nlinks;
+
+            /* Guard against a stale attribute left by a file that was
+               not properly closed. */
+            {
+                char tmp[DB_HDF5_COMPNAME_LEN];
+                htri_t exists;
+                sprintf(tmp, "#%06lld", dbfile->nlinks+1);
+                H5E_BEGIN_TRY {
+                    exists = H5Lexists(dbfile->link, tmp, H5P_DEFAULT);
+                } H5E_END_TRY;
+                if (exists > 0 &&
+                    H5Literate(dbfile->link, H5_INDEX_NAME, H5_ITER_NATIVE,
+                               NULL, max_compname, &dbfile->nlinks)<0) {
+                    db_perror("link group", E_CALLFAIL, me);
+                    UNWIND();
+                }
+            }
+        }
+
+        /* Create a name */
+        dbfile->nlinks++;
+        sprintf(name, "#%06lld", dbfile->nlinks);
+        
+    } CLEANUP {
+        H5E_BEGIN_TRY {
+            H5Aclose(attr);
+        } H5E_END_TRY;
+    } END_PROTECT;
+
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_save_nlinks
+ *
+ * Purpose:     Write the in-memory link counter maintained by
+ *              db_hdf5_compname to the `nlinks' attribute of the link
+ *              directory if it has changed. The attribute is an int as it
+ *              has always been unless the counter no longer fits in one.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE int
+db_hdf5_save_nlinks(DBfile_hdf5 *dbfile)
+{
+    static char *me = "db_hdf5_save_nlinks";
+    hid_t       attr=-1, atype=-1;
+    int         big = dbfile->nlinks > INT_MAX;
+
+    if (dbfile->nlinks_saved < 0 || dbfile->nlinks == dbfile->nlinks_saved)
+        return 0;
+
+    PROTECT {
+        H5E_BEGIN_TRY {
+            attr = H5Aopen_name(dbfile->link, "nlinks");
+        } H5E_END_TRY;
+
+        /* Replace an int attribute that can no longer hold the count */
+        if (attr>=0 && big) {
+            atype = H5Aget_type(attr);
+            if (H5Tget_size(atype) < sizeof(long long)) {
+                H5Aclose(attr);
+                attr = -1;
+                if (H5Adelete(dbfile->link, "nlinks")<0) {
+                    db_perror("nlinks attribute", E_CALLFAIL, me);
+                    UNWIND();
+                }
+            }
+            H5Tclose(atype);
+            atype = -1;
+        }
+
+        if (attr<0 && (attr=H5Acreate(dbfile->link, "nlinks",
+                           big ? H5T_NATIVE_LLONG : H5T_NATIVE_INT,
+                           SCALAR, H5P_DEFAULT, H5P_DEFAULT))<0) {
+            db_perror("nlinks attribute", E_CALLFAIL, me);
+            UNWIND();
+        }
+        if (H5Awrite(attr, H5T_NATIVE_LLONG, &dbfile->nlinks)<0) {
+            db_perror("nlinks attribute", E_CALLFAIL, me);
+            UNWIND();
+        }
+        H5Aclose(attr);
+        dbfile->nlinks_saved = dbfile->nlinks;
+
+    } CLEANUP {
+        H5E_BEGIN_TRY {
+            H5Tclose(atype);
+            H5Aclose(attr);
+        } H5E_END_TRY;
+    } END_PROTECT;
+
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * TOC index
+ *
+ * Building a table of contents by scanning a group (load_toc) requires
+ * several HDF5 calls for every object in the group. For directories
+ * with many objects, that is slow. So, for each directory a writer
+ * has worked in, we store a TOC index at close. The index is a char
+ * dataset in the link group. For each TOC entry, it holds a record of
+ * nul-terminated fields...
+ *
+ *     <silo type>\0<islink>\0<objno[0]>\0<objno[1]>\0<name>\0<target>\0
+ *
+ * in the same (name) order H5Literate visits them. The directory's
+ * "silo_toc" attribute holds five values: the directory's link count
+ * and maximum link creation order when the index was written, its own
+ * object number and the index dataset's number in the link group.
+ * Silo directories track link creation order, so HDF5 advances it for
+ * every link added by any writer, a rename included. A reader uses the
+ * index only if all of these still match, which it checks from the
+ * group's header alone. Otherwise, such as for a directory modified by
+ * an older Silo or a plain HDF5 tool, or by a writer that never reached
+ * close, it falls back to scanning. Directories that do not track
+ * creation order, such as those in files of older Silo versions, are
+ * not indexed and are read exactly as before.
+ *-------------------------------------------------------------------------
+ */
+typedef struct toc_index_buf_t {
+    char       *buf;
+    size_t      len;
+    size_t      cap;
+} toc_index_buf_t;
+
+PRIVATE void
+toc_index_put(toc_index_buf_t *tib, char const *str)
+{
+    size_t n = strlen(str) + 1;
+    if (tib->len + n > tib->cap)
+    {
+        tib->cap = 2 * (tib->len + n) + 4096;
+        tib->buf = (char *) realloc(tib->buf, tib->cap);
+    }
+    memcpy(tib->buf + tib->len, str, n);
+    tib->len += n;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    build_toc_index
+ *
+ * Purpose:     H5Literate callback to append one record to a TOC index.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE herr_t
+build_toc_index(hid_t grp, char const *name, H5L_info_t const *dummy, void *_tib)
+{
+    toc_index_buf_t *tib = (toc_index_buf_t *) _tib;
+    DBObjectType objtype;
+    unsigned long objno[2];
+    int islink;
+    char tmp[2*256];
+
+    if (load_toc_classify(grp, name, &objtype, &islink, objno)<0) return -1;
+    if (objtype == DB_INVALID_OBJECT) return 0;
+
+    sprintf(tmp, "%d", (int) objtype);     toc_index_put(tib, tmp);
+    sprintf(tmp, "%d", islink);            toc_index_put(tib, tmp);
+    sprintf(tmp, "%lu", objno[0]);         toc_index_put(tib, tmp);
+    sprintf(tmp, "%lu", objno[1]);         toc_index_put(tib, tmp);
+    toc_index_put(tib, name);
+    if (!islink || db_hdf5_getslink(grp, name, tmp) != 0)
+        strcpy(tmp, islink ? "unknown" : "");
+    toc_index_put(tib, tmp);
+
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_toc_stamp
+ *
+ * Purpose:     Get the stamp of a directory that its TOC index must
+ *              match: its link count, its maximum link creation order
+ *              and its object number. All come from the group's header;
+ *              no links are visited.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1, also if the group does not track
+ *                              link creation order
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE int
+db_hdf5_toc_stamp(hid_t grp, long long stamp[4])
+{
+    hid_t       gcpl;
+    unsigned    crt_order = 0;
+    H5G_info_t  info;
+    H5G_stat_t  sb;
+
+    if ((gcpl = H5Gget_create_plist(grp))<0)
+        return -1;
+    if (H5Pget_link_creation_order(gcpl, &crt_order)<0)
+        crt_order = 0;
+    H5Pclose(gcpl);
+    if (!(crt_order & H5P_CRT_ORDER_TRACKED) ||
+        H5Gget_info(grp, &info)<0 ||
+        H5Gget_objinfo(grp, ".", TRUE, &sb)<0)
+        return -1;
+    stamp[0] = (long long) info.nlinks;
+    stamp[1] = (long long) info.max_corder;
+    stamp[2] = (long long) sb.objno[0];
+    stamp[3] = (long long) sb.objno[1];
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_read_toc_attr
+ *
+ * Purpose:     Read the five values of a directory's "silo_toc"
+ *              attribute.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1, no such attribute or not of this form
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE int
+db_hdf5_read_toc_attr(hid_t grp, long long vals[5])
+{
+    hid_t       attr=-1, space=-1;
+    int         retval = -1;
+
+    H5E_BEGIN_TRY {
+        if ((attr = H5Aopen_name(grp, "silo_toc"))>=0 &&
+            (space = H5Aget_space(attr))>=0 &&
+            H5Sget_simple_extent_npoints(space) == 5 &&
+            H5Aread(attr, H5T_NATIVE_LLONG, vals)>=0)
+            retval = 0;
+        H5Sclose(space);
+        H5Aclose(attr);
+    } H5E_END_TRY;
+
+    return retval;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_mark_toc_dir
+ *
+ * Purpose:     Remember the current working directory of a writeable
+ *              file so that its TOC index is (re)written at close.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+db_hdf5_mark_toc_dir(DBfile_hdf5 *dbfile)
+{
+    unsigned intent = 0;
+    char dir[1024];
+    int i;
+
+    if (H5Fget_intent(dbfile->fid, &intent)<0 || !(intent & H5F_ACC_RDWR))
+        return;
+    if (db_hdf5_GetDir((DBfile*)dbfile, dir)<0)
+        return;
+
+    /* Most recently visited dirs are most likely to be re-visited */
+    for (i = dbfile->ntocdirs-1; i >= 0; i--)
+    {
+        if (!strcmp(dbfile->tocdirs[i], dir))
+            return;
+    }
+
+    dbfile->tocdirs = (char **) realloc(dbfile->tocdirs,
+        (dbfile->ntocdirs+1) * sizeof(char*));
+    dbfile->tocdirs[dbfile->ntocdirs++] = STRDUP(dir);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_write_toc_index
+ *
+ * Purpose:     Write the TOC index of the named directory, unless its
+ *              stamp shows it is still current. An existing index
+ *              dataset is resized and rewritten in place.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE int
+db_hdf5_write_toc_index(DBfile_hdf5 *dbfile, char const *dirname)
+{
+    static char *me = "db_hdf5_write_toc_index";
+    hid_t       grp=-1, attr=-1, space=-1, dset=-1, dcpl=-1;
+    toc_index_buf_t tib = {0, 0, 0};
+    long long   vals[5], oldvals[5];
+    hsize_t     n;
+    int         hasold = 0, current = 0;
+    char        cname[DB_HDF5_COMPNAME_LEN];
+
+    /* Directories not tracking link creation order are not indexed */
+    H5E_BEGIN_TRY {
+        if ((grp=H5Gopen(dbfile->fid, dirname, H5P_DEFAULT))>=0) {
+            hasold = db_hdf5_read_toc_attr(grp, oldvals)==0;
+            if (db_hdf5_toc_stamp(grp, vals)<0 ||
+                (hasold && !memcmp(vals, oldvals, 4*sizeof(*vals))))
+                current = 1;
+        }
+        H5Gclose(grp);
+        grp = -1;
+    } H5E_END_TRY;
+    if (current)
+        return 0;
+
+    PROTECT {
+        if ((grp=H5Gopen(dbfile->fid, dirname, H5P_DEFAULT))<0) {
+            db_perror(dirname, E_CALLFAIL, me);
+            UNWIND();
+        }
+
+        if (H5Literate(grp, H5_INDEX_NAME, H5_ITER_INC, NULL, build_toc_index, &tib)<0) {
+            db_perror(dirname, E_CALLFAIL, me);
+            UNWIND();
+        }
+        toc_index_put(&tib, ""); /* terminating empty record */
+        n = tib.len;
+
+        /* Resize the old index, if any, or make a new, extendible one */
+        if (hasold) {
+            sprintf(cname, "#%06lld", oldvals[4]);
+            H5E_BEGIN_TRY {
+                if ((dset=H5Dopen(dbfile->link, cname, H5P_DEFAULT))>=0 &&
+                    H5Dset_extent(dset, &n)<0) {
+                    H5Dclose(dset);
+                    dset = -1;
+                    H5Ldelete(dbfile->link, cname, H5P_DEFAULT);
+                }
+            } H5E_END_TRY;
+            vals[4] = oldvals[4];
+        }
+        if (dset<0) {
+            hsize_t maxn = H5S_UNLIMITED, chunk = MIN(MAX(n, 1024), 65536);
+            if (db_hdf5_compname(dbfile, cname)<0) {
+                db_perror("compname", E_CALLFAIL, me);
+                UNWIND();
+            }
+            if ((space=H5Screate_simple(1, &n, &maxn))<0 ||
+                (dcpl=H5Pcreate(H5P_DATASET_CREATE))<0 ||
+                H5Pset_chunk(dcpl, 1, &chunk)<0 ||
+                (dset=H5Dcreate(dbfile->link, cname, H5T_NATIVE_CHAR, space,
+                                H5P_DEFAULT, dcpl, H5P_DEFAULT))<0) {
+                db_perror(cname, E_CALLFAIL, me);
+                UNWIND();
+            }
+            H5Pclose(dcpl);
+            H5Sclose(space);
+            dcpl = space = -1;
+            vals[4] = dbfile->nlinks;
+        }
+        if (H5Dwrite(dset, H5T_NATIVE_CHAR, H5S_ALL, H5S_ALL,
+                     H5P_DEFAULT, tib.buf)<0) {
+            db_perror(cname, E_CALLFAIL, me);
+            UNWIND();
+        }
+        H5Dclose(dset);
+        dset = -1;
+
+        /* Stamp the directory */
+        if (db_hdf5_toc_stamp(grp, vals)<0) {
+            db_perror(dirname, E_CALLFAIL, me);
+            UNWIND();
+        }
+        if (hasold) {
+            attr = H5Aopen_name(grp, "silo_toc");
+        } else {
+            H5E_BEGIN_TRY {
+                H5Adelete(grp, "silo_toc");
+            } H5E_END_TRY;
+            n = 5;
+            if ((space=H5Screate_simple(1, &n, NULL))<0 ||
+                (attr=H5Acreate(grp, "silo_toc", H5T_NATIVE_LLONG, space,
+                                H5P_DEFAULT, H5P_DEFAULT))<0) {
+                db_perror("silo_toc", E_CALLFAIL, me);
+                UNWIND();
+            }
+            H5Sclose(space);
+            space = -1;
+        }
+        if (attr<0 || H5Awrite(attr, H5T_NATIVE_LLONG, vals)<0) {
+            db_perror("silo_toc", E_CALLFAIL, me);
+            UNWIND();
+        }
+        H5Aclose(attr);
+        H5Gclose(grp);
+        FREE(tib.buf);
+
+    } CLEANUP {
+        H5E_BEGIN_TRY {
+            H5Dclose(dset);
+            H5Pclose(dcpl);
+            H5Sclose(space);
+            H5Aclose(attr);
+            H5Gclose(grp);
+        } H5E_END_TRY;
+        FREE(tib.buf);
+    } END_PROTECT;
+
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_write_toc_indexes
+ *
+ * Purpose:     Write TOC indices for all directories a writer visited.
+ *              Failure to write an index is not an error; readers will
+ *              simply fall back to scanning.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE void
+db_hdf5_write_toc_indexes(DBfile_hdf5 *dbfile)
+{
+    int i;
+
+    for (i = 0; i < dbfile->ntocdirs; i++)
+    {
+        db_hdf5_write_toc_index(dbfile, dbfile->tocdirs[i]);
+        FREE(dbfile->tocdirs[i]);
+    }
+    FREE(dbfile->tocdirs);
+    dbfile->ntocdirs = 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_read_toc_index
+ *
+ * Purpose:     Load the table of contents of the current working
+ *              directory from its TOC index.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1, no (valid) index. Caller should scan.
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE int
+db_hdf5_read_toc_index(DBfile_hdf5 *dbfile, DBtoc *toc)
+{
+    hid_t       dset=-1, space=-1;
+    long long   vals[5], stamp[4];
+    char        cname[DB_HDF5_COMPNAME_LEN];
+    char       *buf = 0, *p, *end;
+    hsize_t     len;
+    int         retval = -1;
+
+    H5E_BEGIN_TRY {
+        if (db_hdf5_read_toc_attr(dbfile->cwg, vals)<0 ||
+            db_hdf5_toc_stamp(dbfile->cwg, stamp)<0 ||
+            memcmp(vals, stamp, sizeof(stamp)))
+            goto done;
+
+        sprintf(cname, "#%06lld", vals[4]);
+        if ((dset = H5Dopen(dbfile->link, cname, H5P_DEFAULT))<0)
+            goto done;
+        if ((space = H5Dget_space(dset))<0)
+            goto done;
+        len = (hsize_t) H5Sget_simple_extent_npoints(space);
+        buf = (char *) malloc(len + 1);
+        if (len && H5Dread(dset, H5T_NATIVE_CHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf)<0)
+            goto done;
+        buf[len] = '\0';
+
+        /* Parse records */
+        for (p = buf, end = buf + len; p < end && *p; )
+        {
+            char *f[6];
+            int i;
+            for (i = 0; i < 6; i++)
+            {
+                if (p >= end) goto done;
+                f[i] = p;
+                p += strlen(p) + 1;
+            }
+            load_toc_append(toc, f[4], (DBObjectType) strtol(f[0], 0, 10),
+                (int) strtol(f[1], 0, 10), f[5]);
+        }
+        retval = 0;
+done:
+        H5Sclose(space);
+        H5Dclose(dset);
+    } H5E_END_TRY;
+
+    FREE(buf);
+    return retval;
+}
+
+#if defined(HAVE_PTHREAD) && HDF5_VERSION_GE(1,10,3)
+#define DB_HDF5_MT_MAX_FILTERS 8
+#define DB_HDF5_MT_MAX_CD_VALUES 16
+
+/* One chunk in the window, filtered by whichever thread claimed it */
+typedef struct db_hdf5_mt_chunk_t {
+    void       *buf;            /* chunk data, replaced by each filter */
+    size_t      nbytes;         /* bytes of filtered data in buf */
+    unsigned    mask;           /* optional filters that were skipped */
+    int         failed;         /* a mandatory filter failed */
+    int         done;           /* filtered and ready to write */
+} db_hdf5_mt_chunk_t;
+
+/* State shared by the threads compressing one dataset */
+typedef struct db_hdf5_mt_t {
+    int             rank;
+    hsize_t         size[H5S_MAX_RANK];     /* dataset dimensions */
+    hsize_t         chunk[H5S_MAX_RANK];    /* chunk dimensions */
+    hsize_t         nchunks[H5S_MAX_RANK];  /* chunks along each dimension */
+    size_t          elsize;
+    size_t          chunk_bytes;
+    char const     *data;
+    int             nfilters;
+    H5Z_filter_t    filter[DB_HDF5_MT_MAX_FILTERS];
+    unsigned        flags[DB_HDF5_MT_MAX_FILTERS];
+    size_t          cd_nelmts[DB_HDF5_MT_MAX_FILTERS];
+    unsigned        cd_values[DB_HDF5_MT_MAX_FILTERS][DB_HDF5_MT_MAX_CD_VALUES];
+    hsize_t         total;                  /* chunks in the dataset */
+    hsize_t         window;                 /* chunks filtered ahead of writing */
+    hsize_t         next;                   /* next chunk to claim */
+    hsize_t         written;                /* chunks written and released */
+    int             quit;                   /* a write failed; claim no more */
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;                   /* a chunk was filtered or written */
+    db_hdf5_mt_chunk_t *chunks;             /* ring of window chunks */
+} db_hdf5_mt_t;
+
+/* Offset, in elements, of the idx'th chunk in row-major chunk order */
+static void
+db_hdf5_mt_offset(db_hdf5_mt_t const *mt, hsize_t idx, hsize_t off[])
+{
+    int d;
+    for (d = mt->rank-1; d >= 0; d--)
+    {
+        off[d] = (idx % mt->nchunks[d]) * mt->chunk[d];
+        idx /= mt->nchunks[d];
+    }
+}
+
+/* Copy the chunk at off out of the dataset's memory buffer. Edge chunks
+   are zero-padded to full size just as HDF5 does. */
+static void
+db_hdf5_mt_gather(db_hdf5_mt_t const *mt, hsize_t const off[], char *dst)
+{
+    hsize_t ext[H5S_MAX_RANK], idx[H5S_MAX_RANK];
+    int r = mt->rank, d, partial = 0;
+    size_t rowbytes;
+
+    for (d = 0; d < r; d++)
+    {
+        ext[d] = MIN(mt->chunk[d], mt->size[d] - off[d]);
+        if (ext[d] < mt->chunk[d]) partial = 1;
+        idx[d] = 0;
+    }
+    if (partial)
+        memset(dst, 0, mt->chunk_bytes);
+    rowbytes = (size_t) ext[r-1] * mt->elsize;
+
+    while (1)
+    {
+        hsize_t src = 0, dof = 0;
+        for (d = 0; d < r; d++)
+        {
+            src = src * mt->size[d] + off[d] + idx[d];
+            dof = dof * mt->chunk[d] + idx[d];
+        }
+        memcpy(dst + dof * mt->elsize, mt->data + src * mt->elsize, rowbytes);
+
+        /* advance to the next row; the last dimension is copied whole */
+        for (d = r-2; d >= 0; d--)
+        {
+            if (++idx[d] < ext[d]) break;
+            idx[d] = 0;
+        }
+        if (d < 0) break;
+    }
+}
+
+/* HDF5's byte shuffle (H5Zshuffle.c); leftover bytes stay at the end */
+static size_t
+db_hdf5_mt_shuffle(size_t elsize, size_t nbytes, void **buf)
+{
+    unsigned char const *src = (unsigned char const *) *buf;
+    unsigned char *dst;
+    size_t n = nbytes / elsize, i, j;
+
+    if (elsize <= 1 || n <= 1)
+        return nbytes;
+    if (!(dst = (unsigned char *) malloc(nbytes)))
+        return 0;
+    for (j = 0; j < elsize; j++)
+        for (i = 0; i < n; i++)
+            dst[j*n+i] = src[i*elsize+j];
+    memcpy(dst + n*elsize, src + n*elsize, nbytes - n*elsize);
+    free(*buf);
+    *buf = dst;
+    return nbytes;
+}
+
+#ifdef HAVE_LIBZ
+/* HDF5's deflate filter (H5Zdeflate.c), output buffer size included, so
+   a chunk fails (or, with an optional filter, skips deflate) exactly when
+   it would have through HDF5 */
+static size_t
+db_hdf5_mt_deflate(int level, size_t nbytes, void **buf)
+{
+    double bound = (double) nbytes * (double) 1.001f;
+    uLongf zbytes = (uLongf) bound;
+    void *dst;
+
+    if ((double) zbytes < bound)
+        zbytes++;
+    zbytes += 12;
+    if (!(dst = malloc(zbytes)))
+        return 0;
+    if (compress2((Bytef*) dst, &zbytes, (Bytef const*) *buf, (uLong) nbytes, level) != Z_OK)
+    {
+        free(dst);
+        return 0;
+    }
+    free(*buf);
+    *buf = dst;
+    return (size_t) zbytes;
+}
+#endif
+
+/* Gather chunk idx into its slot of the window and run the filter
+   pipeline on it. Shuffle and deflate make no HDF5 calls. The zfp filter
+   pushes HDF5 errors when it fails, so pipelines with it come here only
+   when HDF5 is thread-safe, and errors stay on this thread's own stack. */
+static void
+db_hdf5_mt_filter(db_hdf5_mt_t *mt, hsize_t idx)
+{
+    db_hdf5_mt_chunk_t *c = &mt->chunks[idx % mt->window];
+    hsize_t off[H5S_MAX_RANK];
+    int f;
+
+    if (!(c->buf = malloc(mt->chunk_bytes)))
+    {
+        c->failed = 1;
+        return;
+    }
+    db_hdf5_mt_offset(mt, idx, off);
+    db_hdf5_mt_gather(mt, off, (char *) c->buf);
+    c->nbytes = mt->chunk_bytes;
+
+    for (f = 0; f < mt->nfilters; f++)
+    {
+        size_t n = 0;
+        switch (mt->filter[f])
+        {
+            case H5Z_FILTER_SHUFFLE:
+                n = db_hdf5_mt_shuffle(mt->cd_values[f][0], c->nbytes, &c->buf);
+                break;
+#ifdef HAVE_LIBZ
+            case H5Z_FILTER_DEFLATE:
+                n = db_hdf5_mt_deflate((int) mt->cd_values[f][0], c->nbytes, &c->buf);
+                break;
+#endif
+#ifdef HAVE_ZFP
+            case H5Z_FILTER_ZFP:
+            {
+                size_t bufsize = c->nbytes;
+                n = H5Z_ZFP->filter(0, mt->cd_nelmts[f], mt->cd_values[f],
+                                    c->nbytes, &bufsize, &c->buf);
+                break;
+            }
+#endif
+        }
+        if (n > 0)
+            c->nbytes = n;
+        else if (mt->flags[f] & H5Z_FLAG_OPTIONAL)
+            c->mask |= 1u << f;
+        else
+        {
+            c->failed = 1;
+            break;
+        }
+    }
+}
+
+/* Claim the next chunk, if the window has room for it, and filter it.
+   Returns 0, without waiting, if there is nothing to claim. Called and
+   returns with the mutex held. */
+static int
+db_hdf5_mt_filter_next(db_hdf5_mt_t *mt)
+{
+    hsize_t idx;
+
+    if (mt->quit || mt->next >= mt->total || mt->next >= mt->written + mt->window)
+        return 0;
+    idx = mt->next++;
+    pthread_mutex_unlock(&mt->mutex);
+    db_hdf5_mt_filter(mt, idx);
+    pthread_mutex_lock(&mt->mutex);
+    mt->chunks[idx % mt->window].done = 1;
+    pthread_cond_broadcast(&mt->cond);
+    return 1;
+}
+
+/* Filter chunks until all are claimed or a write fails, waiting whenever
+   the window is full for the calling thread to write some */
+static void *
+db_hdf5_mt_worker(void *arg)
+{
+    db_hdf5_mt_t *mt = (db_hdf5_mt_t *) arg;
 
-        if (space != -1)
-            H5Sclose(space);
+#ifdef HAVE_ZFP
+    /* the chunks are the parallelism; zfp must not add its own */
+    H5Z_zfp_set_execution(0, 0);
+#endif
 
-    }
-    H5E_END_TRY;
+    pthread_mutex_lock(&mt->mutex);
+    while (!mt->quit && mt->next < mt->total)
+        if (!db_hdf5_mt_filter_next(mt))
+            pthread_cond_wait(&mt->cond, &mt->mutex);
+    pthread_mutex_unlock(&mt->mutex);
+    return 0;
 }
+#endif
 
 /*-------------------------------------------------------------------------
- * Function:    db_hdf5_compname
- *
- * Purpose:     Returns a new name relative to the link directory. The name
- *              is generated by reading the `nlinks' attribute of the link
- *              directory, incrementing it, creating a file name, and saving
- *              it back to the file.
- *
- * Return:      Success:        0, A new link name not more than 8 characters
- *                              long counting the null terminator is returned
- *                              through the NAME argument.
- *
- *              Failure:        -1
- *
- * Programmer:  Robb Matzke
- *              Tuesday, March 23, 1999
- *
- * Modifications:
+ * Function:    db_hdf5_write_chunks_mt
+ *
+ * Purpose:     Write a whole chunked dataset by compressing its chunks on
+ *              nthreads threads and writing the results with
+ *              H5Dwrite_chunk. The workers are started once and compress
+ *              ahead of the calling thread, which writes the chunks in
+ *              order and compresses too whenever the next one is not
+ *              ready. At most two rounds of a few chunks per thread are in
+ *              memory, so one round is compressed while the other is
+ *              written. All HDF5 calls but the zfp filter's error
+ *              reporting stay on the calling thread. The filters are
+ *              reimplemented (shuffle, deflate) or called directly (zfp)
+ *              with the parameters HDF5 recorded for the dataset, so the
+ *              file reads back through HDF5's pipeline unchanged.
+ *
+ * Return:      0 if written, 1 if the dataset does not qualify (not
+ *              chunked, a single chunk, type conversion needed, a filter
+ *              not handled here, or zfp with an HDF5 that is not
+ *              thread-safe) and the caller should use H5Dwrite, -1 on
+ *              failure.
  *
  *-------------------------------------------------------------------------
  */
 PRIVATE int
-db_hdf5_compname(DBfile_hdf5 *dbfile, char name[8]/*out*/)
+db_hdf5_write_chunks_mt(hid_t dset, hid_t mtype, int nthreads, void const *buf)
 {
-    static char *me = "db_hdf5_compname";
-    hid_t       attr=-1;
-    int         nlinks;
+#if defined(HAVE_PTHREAD) && HDF5_VERSION_GE(1,10,3)
+    db_hdf5_mt_t mt;
+    hid_t dcpl = -1, ftype = -1, space = -1;
+    hsize_t i, total = 1;
+    pthread_t *threads = 0;
+    int d, f, t, nstarted = 0, failed = 0, retval = 1;
 
-    PROTECT {
-        /* Open or create the `nlinks' attribute of the link group */
-        H5E_BEGIN_TRY {
-            attr = H5Aopen_name(dbfile->link, "nlinks");
-        } H5E_END_TRY;
-        if (attr<0 && (attr=H5Acreate(dbfile->link, "nlinks", H5T_NATIVE_INT,
-                                      SCALAR, H5P_DEFAULT, H5P_DEFAULT))<0) {
-            db_perror("nlinks attribute", E_CALLFAIL, me);
-            UNWIND();
-        }
+    if (nthreads <= 1 || !buf)
+        return 1;
 
-        /* Increment the nlinks value */
-        if (H5Aread(attr, H5T_NATIVE_INT, &nlinks)<0) {
-            db_perror("nlinks attribute", E_CALLFAIL, me);
-            UNWIND();
-        }
+    memset(&mt, 0, sizeof(mt));
+    mt.data = (char const *) buf;
+    mt.chunks = 0;
 
-        nlinks++;
-        if (nlinks > 999999) {
-            db_perror("exceeded maximum number of nlinks", E_CALLFAIL, me);
-            UNWIND();
-        }
+    H5E_BEGIN_TRY {
+        dcpl = H5Dget_create_plist(dset);
+        ftype = H5Dget_type(dset);
+        space = H5Dget_space(dset);
+    } H5E_END_TRY;
+    if (dcpl < 0 || ftype < 0 || space < 0)
+        goto done;
+    if (H5Pget_layout(dcpl) != H5D_CHUNKED || H5Tequal(ftype, mtype) <= 0)
+        goto done;
+    if ((mt.rank = H5Pget_chunk(dcpl, H5S_MAX_RANK, mt.chunk)) <= 0 ||
+        H5Sget_simple_extent_ndims(space) != mt.rank ||
+        H5Sget_simple_extent_dims(space, mt.size, 0) < 0)
+        goto done;
+    mt.elsize = H5Tget_size(ftype);
+    mt.chunk_bytes = mt.elsize;
+    for (d = 0; d < mt.rank; d++)
+    {
+        mt.nchunks[d] = (mt.size[d] + mt.chunk[d] - 1) / mt.chunk[d];
+        mt.chunk_bytes *= (size_t) mt.chunk[d];
+        total *= mt.nchunks[d];
+    }
+    if (total < 2)
+        goto done;
 
-        if (H5Awrite(attr, H5T_NATIVE_INT, &nlinks)<0) {
-            db_perror("nlinks attribute", E_CALLFAIL, me);
-            UNWIND();
+    /* Only pipelines made entirely of filters we can run ourselves */
+    if ((mt.nfilters = H5Pget_nfilters(dcpl)) > DB_HDF5_MT_MAX_FILTERS)
+        goto done;
+    for (f = 0; f < mt.nfilters; f++)
+    {
+        mt.cd_nelmts[f] = DB_HDF5_MT_MAX_CD_VALUES;
+        mt.filter[f] = H5Pget_filter2(dcpl, (unsigned) f, &mt.flags[f],
+                           &mt.cd_nelmts[f], mt.cd_values[f], 0, 0, 0);
+        if (mt.cd_nelmts[f] > DB_HDF5_MT_MAX_CD_VALUES)
+            goto done;
+        switch (mt.filter[f])
+        {
+            case H5Z_FILTER_SHUFFLE:
+                if (mt.cd_nelmts[f] < 1) goto done;
+                break;
+#ifdef HAVE_LIBZ
+            case H5Z_FILTER_DEFLATE:
+                if (mt.cd_nelmts[f] < 1) goto done;
+                break;
+#endif
+#ifdef HAVE_ZFP
+            case H5Z_FILTER_ZFP:
+            {
+                hbool_t ts = 0;
+                if (H5is_library_threadsafe(&ts) < 0 || !ts) goto done;
+                break;
+            }
+#endif
+            default:
+                goto done;
         }
-        H5Aclose(attr);
+    }
 
-        /* Create a name */
-        sprintf(name, "#%06d", nlinks);
-        
-    } CLEANUP {
-        H5E_BEGIN_TRY {
-            H5Aclose(attr);
-        } H5E_END_TRY;
-    } END_PROTECT;
+    retval = -1;
+    mt.total = total;
+    mt.window = MIN(2 * (hsize_t) nthreads * DB_HDF5_MT_CHUNKS_PER_THREAD, total);
+    if (!(mt.chunks = (db_hdf5_mt_chunk_t *) calloc(mt.window, sizeof(*mt.chunks))) ||
+        !(threads = (pthread_t *) malloc(nthreads * sizeof(*threads))))
+        goto done;
+    pthread_mutex_init(&mt.mutex, 0);
+    pthread_cond_init(&mt.cond, 0);
+
+    /* the calling thread is one of the workers */
+    for (t = 1; t < nthreads && (hsize_t) t < total; t++)
+        if (pthread_create(&threads[nstarted], 0, db_hdf5_mt_worker, &mt) == 0)
+            nstarted++;
+#ifdef HAVE_ZFP
+    H5Z_zfp_set_execution(0, 0);
+#endif
 
-    return 0;
+    for (i = 0; i < total && !failed; i++)
+    {
+        db_hdf5_mt_chunk_t *c = &mt.chunks[i % mt.window];
+        hsize_t off[H5S_MAX_RANK];
+
+        /* help compress until chunk i is ready */
+        pthread_mutex_lock(&mt.mutex);
+        while (!c->done)
+            if (!db_hdf5_mt_filter_next(&mt))
+                pthread_cond_wait(&mt.cond, &mt.mutex);
+        pthread_mutex_unlock(&mt.mutex);
+
+        db_hdf5_mt_offset(&mt, i, off);
+        if (c->failed ||
+            H5Dwrite_chunk(dset, H5P_DEFAULT, c->mask, off, c->nbytes, c->buf) < 0)
+            failed = 1;
+        free(c->buf);
+
+        /* release the slot to the chunk a window ahead */
+        pthread_mutex_lock(&mt.mutex);
+        memset(c, 0, sizeof(*c));
+        mt.written++;
+        mt.quit = failed;
+        pthread_cond_broadcast(&mt.cond);
+        pthread_mutex_unlock(&mt.mutex);
+    }
+
+    for (t = 0; t < nstarted; t++)
+        pthread_join(threads[t], 0);
+    for (i = 0; i < mt.window; i++)
+        free(mt.chunks[i].buf);
+    pthread_cond_destroy(&mt.cond);
+    pthread_mutex_destroy(&mt.mutex);
+    if (!failed)
+        retval = 0;
+
+done:
+    free(threads);
+    free(mt.chunks);
+    H5E_BEGIN_TRY {
+        H5Sclose(space);
+        H5Tclose(ftype);
+        H5Pclose(dcpl);
+    } H5E_END_TRY;
+    return retval;
+#else
+    return 1;
+#endif
 }
 
 /*-------------------------------------------------------------------------
@@ -4420,11 +6176,14 @@ db_hdf5_compwrz(DBfile_hdf5 *dbfile, int dtype, int rank, int const _size[],
             UNWIND();
         }
  
-        if (db_hdf5_set_properties((DBfile*) dbfile, rank, size) < 0 ) {
+        if (buf && db_hdf5_compression_method_is(
+                       db_hdf5_get_compression((DBfile*)dbfile), "AUTO"))
+            db_hdf5_auto_compression((DBfile*)dbfile, rank, size, ftype, mtype, buf);
+        if (db_hdf5_set_properties((DBfile*) dbfile, rank, size, ftype) < 0 ) {
             db_perror("db_hdf5_set_properties", E_CALLFAIL, me);
             UNWIND();
         }
-        if (DBGetCompressionFile((DBfile*)dbfile) && compressionFlags)
+        if (db_hdf5_get_compression((DBfile*)dbfile) && compressionFlags)
         {
             if (db_hdf5_set_compression((DBfile*)dbfile, compressionFlags)<0)
             {
@@ -4437,7 +6196,7 @@ db_hdf5_compwrz(DBfile_hdf5 *dbfile, int dtype, int rank, int const _size[],
         {
             if (fname)
             {
-                if ((dset=H5Dcreate(dbfile->cwg, fname, ftype, space, H5P_DEFAULT, P_crprops, H5P_DEFAULT))<0) {
+                if ((dset=H5Dcreate(dbfile->cwg, fname, ftype, space, H5P_DEFAULT, P_crprops, P_wrdaprops))<0) {
                     db_perror(name, E_CALLFAIL, me);
                     UNWIND();
                 }
@@ -4445,7 +6204,7 @@ db_hdf5_compwrz(DBfile_hdf5 *dbfile, int dtype, int rank, int const _size[],
             }
             else
             {
-                if ((dset=H5Dcreate(dbfile->link, name, ftype, space, H5P_DEFAULT, P_crprops, H5P_DEFAULT))<0) {
+                if ((dset=H5Dcreate(dbfile->link, name, ftype, space, H5P_DEFAULT, P_crprops, P_wrdaprops))<0) {
                     db_perror(name, E_CALLFAIL, me);
                     UNWIND();
                 }
@@ -4453,7 +6212,7 @@ db_hdf5_compwrz(DBfile_hdf5 *dbfile, int dtype, int rank, int const _size[],
         }
         else
         {
-            if ((dset=H5Dcreate(dbfile->link, name, ftype, space, H5P_DEFAULT, P_crprops, H5P_DEFAULT))<0) {
+            if ((dset=H5Dcreate(dbfile->link, name, ftype, space, H5P_DEFAULT, P_crprops, P_wrdaprops))<0) {
                 db_perror(name, E_CALLFAIL, me);
                 UNWIND();
             }
@@ -4461,17 +6220,32 @@ db_hdf5_compwrz(DBfile_hdf5 *dbfile, int dtype, int rank, int const _size[],
                 H5Glink(dbfile->cwg, H5G_LINK_SOFT, name, fname);
         }
 
-        if (buf && H5Dwrite(dset, mtype, space, space, H5P_DEFAULT, buf)<0) {
-            hdf5_to_silo_error(name, "db_hdf5_compwrz");
-            UNWIND();
+        if (buf)
+        {
+            int nthreads = db_hdf5_compression_nthreads((DBfile*)dbfile);
+            double t0 = db_hdf5_wall_time();
+            int mt;
+
+            db_hdf5_set_zfp_execution((DBfile*)dbfile, 1);
+            mt = db_hdf5_write_chunks_mt(dset, mtype, nthreads, buf);
+            if (mt > 0)
+                mt = H5Dwrite(dset, mtype, space, space, H5P_DEFAULT, buf) < 0 ? -1 : 0;
+            db_hdf5_set_zfp_execution((DBfile*)dbfile, 0);
+            if (mt < 0) {
+                hdf5_to_silo_error(name, "db_hdf5_compwrz");
+                UNWIND();
+            }
+            db_hdf5_compression_record((DBfile*)dbfile, dset, db_hdf5_wall_time() - t0);
         }
+        else
+            db_hdf5_auto_cstr = 0;
 
         /* Release resources */
         H5Dclose(dset);
         H5Sclose(space);
 
         /* remove any mesh specific filters if we have 'em */
-        if (DBGetCompressionFile((DBfile*)dbfile) && compressionFlags)
+        if (db_hdf5_get_compression((DBfile*)dbfile) && compressionFlags)
         {
             int i;
             for (i=0; i<H5Pget_nfilters(P_crprops); i++)
@@ -4489,6 +6263,7 @@ db_hdf5_compwrz(DBfile_hdf5 *dbfile, int dtype, int rank, int const _size[],
         }
 
     } CLEANUP {
+        db_hdf5_auto_cstr = 0;
         H5E_BEGIN_TRY {
             H5Dclose(dset);
             H5Sclose(space);
@@ -4630,6 +6405,7 @@ db_hdf5_comprd(DBfile_hdf5 *dbfile, char *name, int ignore_force_single)
             P_rdprops = H5P_DEFAULT;
             if (!DBGetEnableChecksumsFile((DBfile*)dbfile))
                 P_rdprops = P_ckrdprops;
+            db_hdf5_set_read_precision((DBfile*)dbfile);
 
             if (H5Dread(d, mtype, H5S_ALL, H5S_ALL, P_rdprops, buf)<0) {
                 hdf5_to_silo_error(name, me);
@@ -4736,14 +6512,14 @@ db_hdf5_resolvename(DBfile *_dbfile,
     n = (n + 1) % nmax;           \
     return cbuf[n?n-1:nmax-1];    \
 }
-    static int n = 0;
+    static SILO_THREAD_LOCAL int n = 0;
     static int const nmax = 32;
-    static char *cbuf[32] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    static SILO_THREAD_LOCAL char *cbuf[32] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
                              0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
 #ifndef _MSC_VER
 #warning HARD CODED SIZE HERE
 #endif
-    static char cwgname[4096];
+    static SILO_THREAD_LOCAL char cwgname[4096];
     char *parent_objdirname = 0;
     char *parent_fullname = 0;
     char *child_fullname = 0;
@@ -5001,7 +6777,8 @@ db_hdf5_process_file_options(int opts_set_id, int mode, hid_t *fcpl)
     else
         h5status |= H5Pset_fclose_degree(retval, H5F_CLOSE_STRONG);
 
-    /* Disable chunk caching since we single chunk */
+    /* Disable chunk caching since we single chunk by default. With
+       CHUNKSIZE, a slice read touches each of its chunks only once. */
     H5Pset_cache(retval, 0, 0, 0, 0);
 
     /* Handle cases where we are running on Windows. If a client
@@ -5188,6 +6965,12 @@ db_hdf5_process_file_options(int opts_set_id, int mode, hid_t *fcpl)
                     int block_count = H5FD_SILO_DEFAULT_BLOCK_COUNT; 
                     int log_stats = H5FD_SILO_DEFAULT_LOG_STATS;
                     int use_direct = H5FD_SILO_DEFAULT_USE_DIRECT;
+                    int async_flush = H5FD_SILO_DEFAULT_ASYNC_FLUSH;
+                    int meta_at_end = H5FD_SILO_DEFAULT_META_AT_END;
+                    hsize_t cache_bytes = H5FD_SILO_DEFAULT_CACHE_BYTES;
+                    int shared_cache = H5FD_SILO_DEFAULT_SHARED_CACHE;
+                    int nwriters = H5FD_SILO_DEFAULT_NWRITERS;
+                    int writer = H5FD_SILO_DEFAULT_WRITER;
 
                     if ((p = DBGetOption(opts, DBOPT_H5_SILO_BLOCK_SIZE)))
                         block_size = (hsize_t) (*((int*) p));
@@ -5197,11 +6980,27 @@ db_hdf5_process_file_options(int opts_set_id, int mode, hid_t *fcpl)
                         log_stats = *((int*) p);
                     if ((p = DBGetOption(opts, DBOPT_H5_SILO_USE_DIRECT)))
                         use_direct = *((int*) p);
+                    if ((p = DBGetOption(opts, DBOPT_H5_SILO_ASYNC_FLUSH)))
+                        async_flush = *((int*) p);
+                    if ((p = DBGetOption(opts, DBOPT_H5_SILO_META_AT_END)))
+                        meta_at_end = *((int*) p);
+                    if ((p = DBGetOption(opts, DBOPT_H5_SILO_CACHE_MBYTES)))
+                        cache_bytes = ((hsize_t) (*((int*) p))) << 20;
+                    if ((p = DBGetOption(opts, DBOPT_H5_SILO_SHARED_CACHE)))
+                        shared_cache = *((int*) p);
+                    if ((p = DBGetOption(opts, DBOPT_H5_SILO_NWRITERS)))
+                        nwriters = *((int*) p);
+                    if ((p = DBGetOption(opts, DBOPT_H5_SILO_WRITER)))
+                        writer = *((int*) p);
 
                     h5status |= H5Pset_fapl_silo(retval);
                     h5status |= H5Pset_silo_block_size_and_count(retval, block_size, block_count);
                     h5status |= H5Pset_silo_log_stats(retval, log_stats);
                     h5status |= H5Pset_silo_use_direct(retval, use_direct);
+                    h5status |= H5Pset_silo_async_flush(retval, async_flush);
+                    h5status |= H5Pset_silo_meta_at_end(retval, meta_at_end);
+                    h5status |= H5Pset_silo_cache_budget(retval, cache_bytes, shared_cache);
+                    h5status |= H5Pset_silo_multi_writer(retval, nwriters, writer);
 #else
                     H5Pclose(retval);
                     return db_perror("Silo block VFD >= HDF5 1.8.4", E_NOTENABLEDINBUILD, me);
@@ -5669,7 +7468,9 @@ db_hdf5_finish_open(DBfile_hdf5 *dbfile)
      */
     dbfile->cwg = cwg;
     dbfile->link = link;
+    dbfile->nlinks_saved = -1; /*read `nlinks' attr lazily*/
     db_hdf5_InitCallbacks(dbfile, target);
+    db_hdf5_mark_toc_dir(dbfile);
         
     return (DBfile*) dbfile;
 }
@@ -5778,6 +7579,8 @@ db_hdf5_finish_create(DBfile_hdf5 *dbfile, int target, char const *finfo)
         return silo_db_close((DBfile*) dbfile);
     }
 
+    db_hdf5_mark_toc_dir(dbfile);
+
     return (DBfile*) dbfile;
 }
 
@@ -5812,6 +7615,14 @@ db_hdf5_initiate_close(DBfile *_dbfile)
         dbfile->dsettab[i] = NULL;
     }
     dbfile->dsettab_ins = dbfile->dsettab_rem = 0;
+
+    /* Write TOC indices for dirs we wrote to */
+    db_hdf5_write_toc_indexes(dbfile);
+
+    /* Persist the link counter */
+    if (db_hdf5_save_nlinks(dbfile)<0) {
+        return db_perror("nlinks", E_CALLFAIL, me);
+    }
     
     /* Close current working group and link group */
     if (H5Gclose(dbfile->cwg)<0 || H5Gclose(dbfile->link)<0) {
@@ -6051,7 +7862,6 @@ db_hdf5_Create(char const *name, int mode, int target, int opts_set_id, char con
          * HDF5's BTree's will effect storage overhead. Since Silo really
          * doesn't support growing/shrinking datasets, we just use a value
          * of '1' for istore_k */
-        int created_fcprops = 0;
         if (fcprops == -1)
         {
             fcprops = H5Pcreate(H5P_FILE_CREATE);
@@ -6059,11 +7869,15 @@ db_hdf5_Create(char const *name, int mode, int target, int opts_set_id, char con
 #warning BACKWARD COMPAT ISSUE FOR HDF5
 #endif
             /*H5Pset_istore_k(fcprops, 1);*/
-            created_fcprops = 1;
         }
+        else
+        {
+            fcprops = H5Pcopy(fcprops);
+        }
+        /* The root group tracks link creation order for its TOC index */
+        H5Pset_link_creation_order(fcprops, H5P_CRT_ORDER_TRACKED);
         fid = H5Fcreate(name, H5F_ACC_TRUNC, fcprops, faprops);
-        if (created_fcprops)
-            H5Pclose(fcprops);
+        H5Pclose(fcprops);
         H5Glink(fid, H5G_LINK_HARD, "/", ".."); /*don't care if fails*/
     } else if (DB_NOCLOBBER==(mode & 0x00000003)) {
         fid = H5Fopen(name, H5F_ACC_RDWR, faprops);
@@ -6226,7 +8040,8 @@ db_hdf5_Flush(DBfile *_dbfile)
         return retval;
 
     PROTECT {
-        if (H5Fflush(dbfile->fid, H5F_SCOPE_LOCAL)>=0)
+        if (db_hdf5_save_nlinks(dbfile)>=0 &&
+            H5Fflush(dbfile->fid, H5F_SCOPE_LOCAL)>=0)
             retval = 0;
     } CLEANUP {
     } END_PROTECT;
@@ -6234,6 +8049,236 @@ db_hdf5_Flush(DBfile *_dbfile)
     return retval;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_GetIOStats
+ *
+ * Purpose:     Returns the I/O counters kept by the silo VFD for this
+ *              file. Other VFDs keep no such counters.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+SILO_CALLBACK int
+db_hdf5_GetIOStats(DBfile *_dbfile, DBiostats *stats)
+{
+    DBfile_hdf5    *dbfile = (DBfile_hdf5*)_dbfile;
+    static char *me = "db_hdf5_GetIOStats";
+#if HDF5_VERSION_GE(1,8,4)
+    H5FD_silo_io_stats_t vfd_stats;
+
+    if (H5Fget_silo_io_stats(dbfile->fid, &vfd_stats) < 0)
+        return db_perror("file not using the silo VFD", E_NOTIMP, me);
+
+    stats->block_size         = (long long) vfd_stats.block_size;
+    stats->block_count        = vfd_stats.block_count;
+    stats->bytes_read         = (long long) vfd_stats.bytes_read;
+    stats->bytes_written      = (long long) vfd_stats.bytes_written;
+    stats->read_calls         = (long long) vfd_stats.read_calls;
+    stats->write_calls        = (long long) vfd_stats.write_calls;
+    stats->seeks              = (long long) vfd_stats.seeks;
+    stats->read_time          = vfd_stats.read_time;
+    stats->write_time         = vfd_stats.write_time;
+    stats->block_hits         = (long long) vfd_stats.block_hits;
+    stats->block_misses       = (long long) vfd_stats.block_misses;
+    stats->block_evictions    = (long long) vfd_stats.block_evictions;
+    stats->blocks_read_ahead  = (long long) vfd_stats.blocks_read_ahead;
+    stats->raw_reads          = (long long) vfd_stats.raw_reads;
+    stats->raw_bytes_read     = (long long) vfd_stats.raw_bytes_read;
+    stats->raw_writes         = (long long) vfd_stats.raw_writes;
+    stats->raw_bytes_written  = (long long) vfd_stats.raw_bytes_written;
+    stats->meta_reads         = (long long) vfd_stats.meta_reads;
+    stats->meta_bytes_read    = (long long) vfd_stats.meta_bytes_read;
+    stats->meta_writes        = (long long) vfd_stats.meta_writes;
+    stats->meta_bytes_written = (long long) vfd_stats.meta_bytes_written;
+
+    return 0;
+#else
+    return db_perror("Silo block VFD >= HDF5 1.8.4", E_NOTENABLEDINBUILD, me);
+#endif
+}
+
+/* Fold one dataset into a DBcompressionstats total. Datasets written
+   without compression count toward the byte totals only. */
+PRIVATE void
+db_hdf5_compstats_add(hid_t dset, DBcompressionstats *stats)
+{
+    hid_t attr = -1, atype = -1, ftype = -1, space = -1;
+    db_hdf5_compstats_t cs;
+    char method[sizeof(stats->method)], *p;
+
+    H5E_BEGIN_TRY {
+        if ((attr = H5Aopen_name(dset, "silo_compression_stats")) >= 0 &&
+            (atype = db_hdf5_compstats_type()) >= 0 &&
+            H5Aread(attr, atype, &cs) >= 0)
+        {
+            stats->original_bytes += cs.original_bytes;
+            stats->stored_bytes += cs.stored_bytes;
+            stats->write_time += cs.write_time;
+            stats->ncompressed++;
+        }
+        else
+        {
+            ftype = H5Dget_type(dset);
+            space = H5Dget_space(dset);
+            stats->original_bytes += (long long) H5Sget_simple_extent_npoints(space) *
+                                     (long long) H5Tget_size(ftype);
+            stats->stored_bytes += (long long) H5Dget_storage_size(dset);
+            attr = (H5Aclose(attr), -1);
+        }
+        stats->ndatasets++;
+        H5Tclose(atype);
+        H5Tclose(ftype);
+        H5Sclose(space);
+
+        /* the codec, less any METHOD=AUTO reasoning */
+        method[0] = '\0';
+        if (attr >= 0)
+        {
+            H5Aclose(attr);
+            if ((attr = H5Aopen_name(dset, "silo_compression")) >= 0 &&
+                (atype = H5Tcopy(H5T_C_S1)) >= 0 &&
+                H5Tset_size(atype, sizeof(method)) >= 0 &&
+                H5Aread(attr, atype, method) >= 0)
+            {
+                method[sizeof(method)-1] = '\0';
+                if ((p = strstr(method, " (auto"))) *p = '\0';
+            }
+            H5Tclose(atype);
+        }
+        H5Aclose(attr);
+    } H5E_END_TRY;
+
+    if (!method[0])
+        return;
+    if (!stats->method[0])
+        strcpy(stats->method, method);
+    else if (strcmp(stats->method, method))
+        strcpy(stats->method, "mixed");
+}
+
+typedef struct compstats_visit_t {
+    DBcompressionstats *stats;
+    unsigned long (*seen)[2];       /* objects with several hard links */
+    int nseen, maxseen;
+} compstats_visit_t;
+
+/* H5Lvisit callback summing every dataset in the file once */
+static herr_t
+compstats_visit(hid_t grp, char const *name, H5L_info_t const *linfo, void *op_data)
+{
+    compstats_visit_t *cv = (compstats_visit_t *) op_data;
+    H5G_stat_t sb;
+    hid_t dset;
+    int i;
+
+    if (linfo->type != H5L_TYPE_HARD ||
+        H5Gget_objinfo(grp, name, FALSE, &sb) < 0 || sb.type != H5G_DATASET)
+        return 0;
+    if (sb.nlink > 1)
+    {
+        for (i = 0; i < cv->nseen; i++)
+            if (cv->seen[i][0] == sb.objno[0] && cv->seen[i][1] == sb.objno[1])
+                return 0;
+        if (cv->nseen == cv->maxseen)
+        {
+            void *tmp = realloc(cv->seen, (cv->maxseen*2+16) * sizeof(cv->seen[0]));
+            if (!tmp) return -1;
+            cv->seen = (unsigned long (*)[2]) tmp;
+            cv->maxseen = cv->maxseen*2+16;
+        }
+        cv->seen[cv->nseen][0] = sb.objno[0];
+        cv->seen[cv->nseen][1] = sb.objno[1];
+        cv->nseen++;
+    }
+    if ((dset = H5Dopen(grp, name, H5P_DEFAULT)) < 0)
+        return 0;
+    db_hdf5_compstats_add(dset, cv->stats);
+    H5Dclose(dset);
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_GetCompressionStats
+ *
+ * Purpose:     Sums the compression statistics recorded when datasets
+ *              were written. NAME may be a dataset, a Silo object (its
+ *              datasets are summed) or NULL for every dataset in the file.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+SILO_CALLBACK int
+db_hdf5_GetCompressionStats(DBfile *_dbfile, char const *name,
+    DBcompressionstats *stats)
+{
+    DBfile_hdf5 *dbfile = (DBfile_hdf5*)_dbfile;
+    static char *me = "db_hdf5_GetCompressionStats";
+    hid_t       dset = -1, o = -1;
+    DBobject    *obj = 0;
+    int         i;
+
+    memset(stats, 0, sizeof(*stats));
+
+    if (!name)
+    {
+        compstats_visit_t cv = {0, 0, 0, 0};
+        herr_t status;
+        cv.stats = stats;
+        status = H5Lvisit(dbfile->fid, H5_INDEX_NAME, H5_ITER_INC,
+                          compstats_visit, &cv);
+        free(cv.seen);
+        if (status < 0)
+            return db_perror("H5Lvisit", E_CALLFAIL, me);
+        return 0;
+    }
+
+    H5E_BEGIN_TRY {
+        dset = H5Dopen(dbfile->cwg, name, H5P_DEFAULT);
+        if (dset < 0)
+            o = H5Topen(dbfile->cwg, name, H5P_DEFAULT);
+    } H5E_END_TRY;
+
+    if (dset >= 0)
+    {
+        db_hdf5_compstats_add(dset, stats);
+        H5Dclose(dset);
+        return 0;
+    }
+    if (o < 0)
+        return db_perror(name, E_NOTFOUND, me);
+    H5Tclose(o);
+
+    /* A Silo object; its string valued components name its datasets */
+    if (!(obj = db_hdf5_GetObject(_dbfile, name)))
+        return -1;
+    for (i = 0; i < obj->ncomponents; i++)
+    {
+        char dname[1024];
+        size_t len;
+
+        if (strncmp(obj->pdb_names[i], "'<s>", 4))
+            continue;
+        len = strlen(obj->pdb_names[i]+4);
+        if (len < 2 || len > sizeof(dname))
+            continue;
+        memcpy(dname, obj->pdb_names[i]+4, len-1);
+        dname[len-1] = '\0';
+        H5E_BEGIN_TRY {
+            dset = H5Dopen(dbfile->cwg, dname, H5P_DEFAULT);
+        } H5E_END_TRY;
+        if (dset < 0)
+            continue;
+        db_hdf5_compstats_add(dset, stats);
+        H5Dclose(dset);
+    }
+    DBFreeObject(obj);
+    return 0;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    db_hdf5_Filters
  *
@@ -6282,15 +8327,20 @@ db_hdf5_MkDir(DBfile *_dbfile, char const *name)
     DBfile_hdf5 *dbfile = (DBfile_hdf5*)_dbfile;
     static char *me = "db_hdf5_MkDir";
     char        *dotdot = NULL,  *parent=NULL, *t=NULL;
-    hid_t       grp = -1;
+    hid_t       grp = -1, gcpl = -1;
 
     PROTECT {
 
-        /* Create the new group */
-        if ((grp=H5Gcreate(dbfile->cwg, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT))<0) {
+        /* Create the new group, tracking link creation order for its
+           TOC index */
+        if ((gcpl=H5Pcreate(H5P_GROUP_CREATE))<0 ||
+            H5Pset_link_creation_order(gcpl, H5P_CRT_ORDER_TRACKED)<0 ||
+            (grp=H5Gcreate(dbfile->cwg, name, H5P_DEFAULT, gcpl, H5P_DEFAULT))<0) {
             db_perror(name, E_CALLFAIL, me);
             UNWIND();
         }
+        H5Pclose(gcpl);
+        gcpl = -1;
 
         /* What is the name of the parent directory of the new directory? */
         parent = STRDUP(name);
@@ -6317,6 +8367,7 @@ db_hdf5_MkDir(DBfile *_dbfile, char const *name)
 
     } CLEANUP {
         H5E_BEGIN_TRY {
+            H5Pclose(gcpl);
             H5Gclose(grp);
         } H5E_END_TRY;
         FREE(dotdot);
@@ -6369,6 +8420,7 @@ db_hdf5_SetDir(DBfile *_dbfile, char const *name)
             free(dbfile->cwg_name);
             dbfile->cwg_name = new_cwg_name;
         }
+        db_hdf5_mark_toc_dir(dbfile);
     } CLEANUP {
         H5E_BEGIN_TRY {
             H5Gclose(newdir);
@@ -6637,7 +8689,7 @@ copy_obj(hid_t hobj, char const *name, void *op_data)
                 if (strncmp(mem_value, "/.silo/#", 8) == 0)
                 {
                     /* get unique name for this dataset in dst file */
-                    char cname[8];
+                    char cname[DB_HDF5_COMPNAME_LEN];
                     db_hdf5_compname(dstfile, cname);
 
                     /* copy this dataset to /.silo dir in dst file */
@@ -6978,6 +9030,14 @@ db_hdf5_NewToc(DBfile *_dbfile)
     db_FreeToc(_dbfile);
     dbfile->pub.toc = toc = db_AllocToc();
 
+    /* Use the directory's TOC index if it has a valid one */
+    if (db_hdf5_read_toc_index(dbfile, toc) == 0)
+        return 0;
+
+    /* Partially loaded index may have left entries behind */
+    db_FreeToc(_dbfile);
+    dbfile->pub.toc = toc = db_AllocToc();
+
     if (H5Literate(dbfile->cwg, H5_INDEX_NAME, H5_ITER_INC, NULL, load_toc, toc)<0) return -1;
 
     return 0;
@@ -8180,6 +10240,7 @@ db_hdf5_GetVar(DBfile *_dbfile, char const *name)
                 P_rdprops = H5P_DEFAULT;
                 if (!DBGetEnableChecksumsFile(_dbfile))
                     P_rdprops = P_ckrdprops;
+                db_hdf5_set_read_precision(_dbfile);
 
                 /* Read entire variable */
                 if (H5Dread(dset, mtype, H5S_ALL, H5S_ALL, P_rdprops, result)<0) {
@@ -8258,6 +10319,7 @@ db_hdf5_ReadVar(DBfile *_dbfile, char const *vname, void *result)
            P_rdprops = H5P_DEFAULT;
            if (!DBGetEnableChecksumsFile(_dbfile))
                P_rdprops = P_ckrdprops;
+           db_hdf5_set_read_precision(_dbfile);
 
            /* Read entire variable */
            if (H5Dread(dset, mtype, H5S_ALL, H5S_ALL, P_rdprops, result)<0) {
@@ -8288,6 +10350,187 @@ db_hdf5_ReadVar(DBfile *_dbfile, char const *vname, void *result)
    return 0;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    db_hdf5_read_zfp_slice
+ *
+ * Purpose:     Read a slice of a dataset compressed by ZFP in fixed-rate
+ *              mode by decoding only the 4^d ZFP blocks the slice touches.
+ *              Every block of such a chunk has the same size, so each one
+ *              can be found in the raw chunk (read with H5Dread_chunk)
+ *              without decoding the blocks ahead of it. Values are the
+ *              same as those HDF5's filter pipeline produces.
+ *
+ * Return:      0 if read, 1 if the dataset does not qualify (ZFP is not
+ *              its only filter, a mode other than fixed-rate, type
+ *              conversion needed or the slice covers the whole dataset)
+ *              and the caller should use H5Dread, -1 on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+PRIVATE int
+db_hdf5_read_zfp_slice(hid_t dset, hid_t mtype, int ndims, int const *offset,
+    int const *length, int const *stride, void *result)
+{
+#if defined(HAVE_ZFP) && HDF5_VERSION_GE(1,10,3)
+    hid_t dcpl = -1, ftype = -1, space = -1;
+    hsize_t size[H5S_MAX_RANK], chunk[H5S_MAX_RANK];
+    hsize_t first[H5S_MAX_RANK], last[H5S_MAX_RANK], step[H5S_MAX_RANK];
+    hsize_t cidx[H5S_MAX_RANK], clo[H5S_MAX_RANK], chi[H5S_MAX_RANK];
+    hsize_t rstride[H5S_MAX_RANK];
+    size_t cd_nelmts = H5Z_ZFP_CD_NELMTS_MAX;
+    unsigned int cd_values[H5Z_ZFP_CD_NELMTS_MAX], flags;
+    size_t elsize = 0, chunk_bytes = 0;
+    void *cbuf = 0, *box = 0;
+    int d, partial = 0, retval = 1;
+
+    H5E_BEGIN_TRY {
+        dcpl = H5Dget_create_plist(dset);
+        ftype = H5Dget_type(dset);
+        space = H5Dget_space(dset);
+    } H5E_END_TRY;
+    if (dcpl < 0 || ftype < 0 || space < 0)
+        goto done;
+    if (H5Pget_layout(dcpl) != H5D_CHUNKED || H5Tequal(ftype, mtype) <= 0)
+        goto done;
+    if (H5Pget_nfilters(dcpl) != 1 ||
+        H5Pget_filter2(dcpl, 0, &flags, &cd_nelmts, cd_values, 0, 0, 0) != H5Z_FILTER_ZFP ||
+        cd_nelmts > H5Z_ZFP_CD_NELMTS_MAX ||
+        H5Z_zfp_block_bits(cd_nelmts, cd_values) <= 0)
+        goto done;
+    if (H5Sget_simple_extent_ndims(space) != ndims ||
+        H5Sget_simple_extent_dims(space, size, 0) < 0 ||
+        H5Pget_chunk(dcpl, H5S_MAX_RANK, chunk) != ndims)
+        goto done;
+
+    /* Selected indices in each dimension are first, first+step, ... last
+       (see build_fspace); only worth doing if some are left out */
+    elsize = H5Tget_size(ftype);
+    chunk_bytes = elsize;
+    for (d = ndims-1; d >= 0; d--)
+    {
+        hsize_t count = stride[d] ? (length[d]+stride[d]-1)/stride[d] : 1;
+        if (offset[d] < 0 || count < 1)
+            goto done;
+        first[d] = offset[d];
+        step[d] = stride[d] ? stride[d] : 1;
+        last[d] = first[d] + (count-1) * step[d];
+        if (last[d] >= size[d])
+            goto done;
+        if (first[d] > 0 || last[d] < size[d]-1 || step[d] > 1)
+            partial = 1;
+        rstride[d] = d == ndims-1 ? 1 : rstride[d+1] * (stride[d+1] ?
+            (length[d+1]+stride[d+1]-1)/stride[d+1] : 1);
+        chunk_bytes *= chunk[d];
+        clo[d] = cidx[d] = first[d] / chunk[d];
+        chi[d] = last[d] / chunk[d];
+    }
+    if (!partial)
+        goto done;
+
+    retval = -1;
+    if (!(cbuf = malloc(chunk_bytes)) || !(box = malloc(chunk_bytes)))
+        goto done;
+
+    /* Visit every chunk the slice's bounding box overlaps */
+    while (1)
+    {
+        hsize_t coff[H5S_MAX_RANK], bfirst[H5S_MAX_RANK], blast[H5S_MAX_RANK];
+        hsize_t csize = 0, idx[H5S_MAX_RANK];
+        size_t zlo[4], zcount[4];
+        uint32_t mask = 0;
+        int nz = 0, empty = 0, status;
+
+        /* First and last selected index of each dimension in this chunk */
+        for (d = 0; d < ndims; d++)
+        {
+            hsize_t cend;
+            coff[d] = cidx[d] * chunk[d];
+            cend = coff[d] + chunk[d] - 1;
+            bfirst[d] = first[d] >= coff[d] ? first[d] :
+                first[d] + ((coff[d] - first[d] + step[d] - 1) / step[d]) * step[d];
+            blast[d] = last[d] <= cend ? last[d] :
+                first[d] + ((cend - first[d]) / step[d]) * step[d];
+            if (bfirst[d] > blast[d])
+                empty = 1;
+        }
+
+        if (!empty)
+        {
+            /* ZFP's dimensions are the chunk's non-unity ones, fastest first */
+            for (d = ndims-1; d >= 0; d--)
+            {
+                if (chunk[d] <= 1) continue;
+                if (nz == 4) goto done;
+                zlo[nz] = (size_t) (bfirst[d] - coff[d]);
+                zcount[nz] = (size_t) (blast[d] - bfirst[d] + 1);
+                nz++;
+            }
+
+            if (H5Dget_chunk_storage_size(dset, coff, &csize) < 0 ||
+                csize == 0 || csize > chunk_bytes)
+            {
+                retval = 1; /* unallocated or incompressible, let HDF5 sort it out */
+                goto done;
+            }
+            if (H5Dread_chunk(dset, H5P_DEFAULT, coff, &mask, cbuf) < 0)
+                goto done;
+            if (mask)
+            {
+                retval = 1; /* the filter was skipped for this chunk */
+                goto done;
+            }
+            if ((status = H5Z_zfp_decode_box(cd_nelmts, cd_values, cbuf,
+                     (size_t) csize, nz, zlo, zcount, box)) <= 0)
+            {
+                if (status == 0) retval = 1;
+                goto done;
+            }
+
+            /* Scatter the selected values of the box into the result */
+            for (d = 0; d < ndims; d++)
+                idx[d] = bfirst[d];
+            while (1)
+            {
+                hsize_t src = 0, dst = 0;
+                for (d = 0; d < ndims; d++)
+                {
+                    src = src * (blast[d] - bfirst[d] + 1) + (idx[d] - bfirst[d]);
+                    dst += (idx[d] - first[d]) / step[d] * rstride[d];
+                }
+                memcpy((char *) result + dst * elsize, (char *) box + src * elsize, elsize);
+                for (d = ndims-1; d >= 0; d--)
+                {
+                    idx[d] += step[d];
+                    if (idx[d] <= blast[d]) break;
+                    idx[d] = bfirst[d];
+                }
+                if (d < 0) break;
+            }
+        }
+
+        for (d = ndims-1; d >= 0; d--)
+        {
+            if (++cidx[d] <= chi[d]) break;
+            cidx[d] = clo[d];
+        }
+        if (d < 0) break;
+    }
+    retval = 0;
+
+done:
+    free(cbuf);
+    free(box);
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Tclose(ftype);
+        H5Sclose(space);
+    } H5E_END_TRY;
+    return retval;
+#else
+    return 1;
+#endif
+}
+
 /*-------------------------------------------------------------------------
  * Function:    db_hdf5_ReadVarSlice
  *
@@ -8314,6 +10557,7 @@ db_hdf5_ReadVarSlice(DBfile *_dbfile, char const *vname, int const *offset, int
    static char  *me = "db_hdf5_ReadVarSlice";
    hid_t        dset=-1, ftype=-1, mtype=-1, mspace=-1, fspace=-1;
    hsize_t      mem_size[H5S_MAX_RANK];
+   int          status;
 
    PROTECT {
        /* Get dataset and data type */
@@ -8348,9 +10592,17 @@ db_hdf5_ReadVarSlice(DBfile *_dbfile, char const *vname, int const *offset, int
        P_rdprops = H5P_DEFAULT;
        if (!DBGetEnableChecksumsFile(_dbfile))
            P_rdprops = P_ckrdprops;
+       db_hdf5_set_read_precision(_dbfile);
 
-       /* Read the data */
-       if (H5Dread(dset, mtype, mspace, fspace, P_rdprops, result)<0) {
+       /* Read the data, decoding only the blocks of fixed-rate ZFP data
+          the slice touches when possible */
+       if ((status = db_hdf5_read_zfp_slice(dset, mtype, ndims, offset,
+                length, stride, result)) < 0) {
+           db_perror(vname, E_CALLFAIL, me);
+           UNWIND();
+       }
+       if (status > 0 &&
+           H5Dread(dset, mtype, mspace, fspace, P_rdprops, result)<0) {
            hdf5_to_silo_error(vname, me);
            UNWIND();
        }
@@ -8448,6 +10700,7 @@ db_hdf5_ReadVarVals(DBfile *_dbfile, char const *vname, int mode,
        P_rdprops = H5P_DEFAULT;
        if (!DBGetEnableChecksumsFile(_dbfile))
            P_rdprops = P_ckrdprops;
+       db_hdf5_set_read_precision(_dbfile);
 
        /* allocate space for returned array of values */
        if (!*result)
@@ -8542,7 +10795,8 @@ db_hdf5_WriteCKZ(DBfile *_dbfile, char const *vname, void const *var,
    hid_t        mtype=-1, ftype=-1, space=-1, dset=-1, dset_type=-1;
    hsize_t      ds_size[H5S_MAX_RANK], new_ds_size[H5S_MAX_RANK];
    H5T_class_t  fclass, mclass;
-   int          i;
+   int          i, nthreads = 1, record = FALSE;
+   double       t0;
 
    PROTECT {
        /* Create the memory and file data type */
@@ -8589,16 +10843,24 @@ db_hdf5_WriteCKZ(DBfile *_dbfile, char const *vname, void const *var,
 
            if (nofilters == 0)
            {
-               if (db_hdf5_set_properties(_dbfile, ndims, ds_size) < 0 ) {
+               if (var && db_hdf5_compression_method_is(
+                              db_hdf5_get_compression(_dbfile), "AUTO"))
+                   db_hdf5_auto_compression(_dbfile, ndims, ds_size, ftype, mtype, var);
+               if (db_hdf5_set_properties(_dbfile, ndims, ds_size, ftype) < 0 ) {
                    db_perror("db_hdf5_set_properties", E_CALLFAIL, me);
                    UNWIND();
                }
 
                /* Create dataset if it doesn't already exist */
-               if ((dset=H5Dcreate(dbfile->cwg, vname, ftype, space, H5P_DEFAULT, P_crprops, H5P_DEFAULT))<0) {
+               if ((dset=H5Dcreate(dbfile->cwg, vname, ftype, space, H5P_DEFAULT, P_crprops, P_wrdaprops))<0) {
                    db_perror(vname, E_CALLFAIL, me);
                    UNWIND();
                }
+
+               /* A new dataset is written whole, so its chunks may be
+                  compressed on threads */
+               nthreads = db_hdf5_compression_nthreads(_dbfile);
+               record = TRUE;
            }
            else
            {
@@ -8632,15 +10894,26 @@ db_hdf5_WriteCKZ(DBfile *_dbfile, char const *vname, void const *var,
 #endif
 
        /* Write data */
-       if (H5Dwrite(dset, mtype, space, space, H5P_DEFAULT, var)<0) {
+       t0 = db_hdf5_wall_time();
+       db_hdf5_set_zfp_execution(_dbfile, !nofilters);
+       i = db_hdf5_write_chunks_mt(dset, mtype, nthreads, var);
+       if (i > 0)
+           i = H5Dwrite(dset, mtype, space, space, H5P_DEFAULT, var) < 0 ? -1 : 0;
+       db_hdf5_set_zfp_execution(_dbfile, 0);
+       if (i < 0) {
            db_perror(vname, E_CALLFAIL, me);
            UNWIND();
        }
+       if (record)
+           db_hdf5_compression_record(_dbfile, dset, db_hdf5_wall_time() - t0);
+       else
+           db_hdf5_compression_update(dset, db_hdf5_wall_time() - t0);
 
        /* Close everything */
        H5Dclose(dset);
        H5Sclose(space);
    } CLEANUP {
+       db_hdf5_auto_cstr = 0;
        H5E_BEGIN_TRY {
            H5Dclose(dset);
            H5Sclose(space);
@@ -8689,7 +10962,8 @@ db_hdf5_WriteSlice(
    static char  *me = "db_hdf5_WriteSlice" ;
    hid_t        mtype=-1, ftype=-1, fspace=-1, mspace=-1, dset=-1;
    hsize_t      ds_size[H5S_MAX_RANK];
-   int          i;
+   int          i, created = FALSE;
+   double       t0;
 
    PROTECT {
        if ((mtype=silom2hdfm_type(dtype))<0 ||
@@ -8727,7 +11001,7 @@ db_hdf5_WriteSlice(
                UNWIND();
            }
 
-           if (db_hdf5_set_properties(_dbfile, ndims, ds_size) < 0 ) {
+           if (db_hdf5_set_properties(_dbfile, ndims, ds_size, ftype) < 0 ) {
                db_perror("db_hdf5_set_properties", E_CALLFAIL, me);
                UNWIND();
            }
@@ -8738,6 +11012,7 @@ db_hdf5_WriteSlice(
                UNWIND();
            }
            H5Sclose(fspace);
+           created = TRUE;
        }
 
        /*
@@ -8773,10 +11048,15 @@ db_hdf5_WriteSlice(
        }
 
        /* Write data */
+       t0 = db_hdf5_wall_time();
        if (H5Dwrite(dset, mtype, mspace, fspace, H5P_DEFAULT, values)<0) {
            db_perror(vname, E_CALLFAIL, me);
            UNWIND();
        }
+       if (created)
+           db_hdf5_compression_record(_dbfile, dset, db_hdf5_wall_time() - t0);
+       else
+           db_hdf5_compression_update(dset, db_hdf5_wall_time() - t0);
 
        /* Close everything */
        H5Dclose(dset);
@@ -10076,7 +12356,7 @@ db_hdf5_GetDefvars(DBfile *_dbfile, char const *name)
  */
 static int PrepareForQuadmeshCompression(DBfile *_dbfile)
 {
-    if (DBGetCompressionFile(_dbfile) == 0) return 0;
+    if (db_hdf5_get_compression(_dbfile) == 0) return 0;
 
 #ifdef HAVE_HZIP
     db_hdf5_hzip_clear_params();
@@ -10166,6 +12446,7 @@ db_hdf5_PutQuadmesh(DBfile *_dbfile, char const *name, char const * const *coord
             db_perror("bad options", E_CALLFAIL, me);
             UNWIND();
         }
+        db_hdf5_obj_cstr = _qm._compression;
 
         /* hack to maintain backward compatibility with pdb driver */
         db_hdf5_handle_ctdt(dbfile, _qm._time_set, _qm._time,
@@ -10316,8 +12597,9 @@ db_hdf5_PutQuadmesh(DBfile *_dbfile, char const *name, char const * const *coord
         } OUTPUT(dbfile, coordtype == DB_COLLINEAR ? DB_QUADRECT : DB_QUADCURV, name, &m);
 
     } CLEANUP {
-        /*void*/
+        db_hdf5_obj_cstr = 0;
     } END_PROTECT;
+    db_hdf5_obj_cstr = 0;
     return 0;
 }
 
@@ -10511,7 +12793,7 @@ db_hdf5_GetQuadmesh(DBfile *_dbfile, char const *name)
 static int
 PrepareForQuadvarCompression(DBfile *_dbfile, int centering, int datatype)
 {
-    if (DBGetCompressionFile(_dbfile) == 0) return 0;
+    if (db_hdf5_get_compression(_dbfile) == 0) return 0;
     if (centering == DB_ZONECENT) return 0;
 
 #ifdef HAVE_HZIP
@@ -10602,6 +12884,7 @@ db_hdf5_PutQuadvar(DBfile *_dbfile, char const *name, char const *meshname, int
         _qm._group_no = -1;
         _qm._missing_value = DB_MISSING_VALUE_NOT_SET;
         db_ProcessOptlist(DB_QUADMESH, optlist); /*yes, QUADMESH*/
+        db_hdf5_obj_cstr = _qm._compression;
         _qm._nzones = _qm._nnodes = 1; /*initial value only*/
         for (nels=(ndims?1:0), i=0; i<ndims; i++) {
             nels *= dims[i];
@@ -10739,8 +13022,9 @@ db_hdf5_PutQuadvar(DBfile *_dbfile, char const *name, char const *meshname, int
         } OUTPUT(dbfile, DB_QUADVAR, name, &m);
         
     } CLEANUP {
-        void;
+        db_hdf5_obj_cstr = 0;
     } END_PROTECT;
+    db_hdf5_obj_cstr = 0;
     return 0;
 }
 
@@ -10923,7 +13207,7 @@ db_hdf5_GetQuadvar(DBfile *_dbfile, char const *name)
 static int PrepareForUcdmeshCompression(DBfile_hdf5 *dbfile,
     char const *meshname, char const *zlname)
 {
-    if (DBGetCompressionFile((DBfile*)dbfile) == 0) return 0;
+    if (db_hdf5_get_compression((DBfile*)dbfile) == 0) return 0;
 
 #ifdef HAVE_HZIP
     if (LookupNodelist(dbfile, zlname, meshname) != 0)
@@ -11014,6 +13298,7 @@ db_hdf5_PutUcdmesh(DBfile *_dbfile, char const *name, int ndims, char const * co
         _um._use_specmf = DB_OFF;
         _um._group_no = -1;
         db_ProcessOptlist(DB_UCDMESH, optlist);
+        db_hdf5_obj_cstr = _um._compression;
 
         /* Prepare for possible compression of coords/gnodeno */
         compressionFlags = PrepareForUcdmeshCompression(dbfile,
@@ -11124,8 +13409,9 @@ db_hdf5_PutUcdmesh(DBfile *_dbfile, char const *name, int ndims, char const * co
         } OUTPUT(dbfile, DB_UCDMESH, name, &m);
         
     } CLEANUP {
-        /*void*/
+        db_hdf5_obj_cstr = 0;
     } END_PROTECT;
+    db_hdf5_obj_cstr = 0;
     return 0;
 }
 
@@ -11510,7 +13796,7 @@ static int
 PrepareForUcdvarCompression(DBfile_hdf5 *dbfile, char const *varname,
     char const *meshname, int datatype, int centering)
 {
-    if (DBGetCompressionFile((DBfile*)dbfile) == 0) return 0;
+    if (db_hdf5_get_compression((DBfile*)dbfile) == 0) return 0;
 
 #ifdef HAVE_HZIP
     if (centering == DB_NODECENT)
@@ -11594,6 +13880,7 @@ db_hdf5_PutUcdvar(DBfile *_dbfile, char const *name, char const *meshname, int n
         _um._group_no = -1;
         _um._missing_value = DB_MISSING_VALUE_NOT_SET;
         db_ProcessOptlist(DB_UCDMESH, optlist); /*yes, UCDMESH*/
+        db_hdf5_obj_cstr = _um._compression;
 
         /* Prepare for possible compression of ucdvars */
         compressionFlags = PrepareForUcdvarCompression(dbfile, name, meshname,
@@ -11681,8 +13968,9 @@ db_hdf5_PutUcdvar(DBfile *_dbfile, char const *name, char const *meshname, int n
         } OUTPUT(dbfile, DB_UCDVAR, name, &m);
 
     } CLEANUP {
-        /*void*/
+        db_hdf5_obj_cstr = 0;
     } END_PROTECT;
+    db_hdf5_obj_cstr = 0;
     return 0;
 }
 
@@ -12087,7 +14375,7 @@ PrepareForZonelistCompression(DBfile_hdf5 *dbfile, char const *name,
     int ntopo = 0, zncnt = 0;
 
     if (nshapes == 0) return 0;
-    if (DBGetCompressionFile((DBfile*)dbfile) == 0) return 0;
+    if (db_hdf5_get_compression((DBfile*)dbfile) == 0) return 0;
 
     zncnt = shapecnt[0];
 #ifdef HAVE_HZIP
@@ -12237,6 +14525,7 @@ db_hdf5_PutZonelist2(DBfile *_dbfile, char const *name, int nzones, int ndims,
         /* Set global options */
         memset(&_uzl, 0, sizeof _uzl);
         db_ProcessOptlist(DB_ZONELIST, optlist);
+        db_hdf5_obj_cstr = _uzl._compression;
 
         /* Prepare for possible compression of zonelist */
         compressionFlags = PrepareForZonelistCompression(dbfile,
@@ -12303,8 +14592,9 @@ db_hdf5_PutZonelist2(DBfile *_dbfile, char const *name, int nzones, int ndims,
         } OUTPUT(dbfile, DB_ZONELIST, name, &m);
         
     } CLEANUP {
-        /*void*/
+        db_hdf5_obj_cstr = 0;
     } END_PROTECT;
+    db_hdf5_obj_cstr = 0;
     return 0;
 }
 
@@ -14017,6 +16307,7 @@ db_hdf5_GetMultimeshadj(DBfile *_dbfile, char const *name, int nmesh,
                  P_rdprops = H5P_DEFAULT;
                  if (!DBGetEnableChecksumsFile(_dbfile))
                      P_rdprops = P_ckrdprops;
+                 db_hdf5_set_read_precision(_dbfile);
 
                  /* Read data */
                  if (H5Dread(nldset, mtype, mspace, fspace, P_rdprops, nlist)<0) {
@@ -14065,6 +16356,7 @@ db_hdf5_GetMultimeshadj(DBfile *_dbfile, char const *name, int nmesh,
                  P_rdprops = H5P_DEFAULT;
                  if (!DBGetEnableChecksumsFile(_dbfile))
                      P_rdprops = P_ckrdprops;
+                 db_hdf5_set_read_precision(_dbfile);
 
                  /* Read data */
                  if (H5Dread(zldset, mtype, mspace, fspace, P_rdprops, zlist)<0) {
@@ -15072,6 +17364,7 @@ db_hdf5_PutPointmesh(DBfile *_dbfile, char const *name, int ndims, DBVCP2_t _coo
         _pm._ndims = _pm._nspace = ndims;
         _pm._group_no = -1;
         db_ProcessOptlist(DB_POINTMESH, optlist);
+        db_hdf5_obj_cstr = _pm._compression;
         _pm._nels = nels;
         _pm._minindex = _pm._lo_offset;
         _pm._maxindex = nels - _pm._hi_offset - 1;
@@ -15174,8 +17467,9 @@ db_hdf5_PutPointmesh(DBfile *_dbfile, char const *name, int ndims, DBVCP2_t _coo
         } OUTPUT(dbfile, DB_POINTMESH, name, &m);
 
     } CLEANUP {
-        /*void*/
+        db_hdf5_obj_cstr = 0;
     } END_PROTECT;
+    db_hdf5_obj_cstr = 0;
     return 0;
 }
 
@@ -15351,6 +17645,7 @@ db_hdf5_PutPointvar(DBfile *_dbfile, char const *name, char const *meshname, int
         _pm._group_no = -1;
         _pm._missing_value = DB_MISSING_VALUE_NOT_SET;
         db_ProcessOptlist(DB_POINTMESH, optlist);
+        db_hdf5_obj_cstr = _pm._compression;
         _pm._nels = nels;
         _pm._minindex = _pm._lo_offset;
         _pm._maxindex = nels - _pm._hi_offset - 1;
@@ -15426,8 +17721,9 @@ db_hdf5_PutPointvar(DBfile *_dbfile, char const *name, char const *meshname, int
         } OUTPUT(dbfile, DB_POINTVAR, name, &m);
 
     } CLEANUP {
-        /*void*/
+        db_hdf5_obj_cstr = 0;
     } END_PROTECT;
+    db_hdf5_obj_cstr = 0;
     return 0;
 }
 
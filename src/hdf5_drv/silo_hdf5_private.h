@@ -83,6 +83,10 @@ typedef struct DBfile_hdf5 {
     char        compname[NDSETTAB][32]; /*component names for datasets  */
     int         dsettab_ins;            /*next insert location          */
     int         dsettab_rem;            /*next remove location          */
+    long long   nlinks;                 /*last link group dataset number*/
+    long long   nlinks_saved;           /*`nlinks' attr value, -1=unread*/
+    char        **tocdirs;              /*dirs to (re)index at close    */
+    int         ntocdirs;               /*number of entries in tocdirs  */
     hid_t       T_char;                 /*target DB_CHAR type           */
     hid_t       T_short;                /*target DB_SHORT type          */
     hid_t       T_int;                  /*target DB_INT type            */
@@ -100,6 +104,8 @@ typedef struct DBfile_hdf5 {
 SILO_CALLBACK int db_hdf5_Close (DBfile *);
 SILO_CALLBACK int db_hdf5_Filters(DBfile *_dbfile, FILE *stream);
 SILO_CALLBACK int db_hdf5_Flush (DBfile *);
+SILO_CALLBACK int db_hdf5_GetIOStats (DBfile *, DBiostats *);
+SILO_CALLBACK int db_hdf5_GetCompressionStats (DBfile *, char const *, DBcompressionstats *);
 
 /* Directory operations */
 SILO_CALLBACK int db_hdf5_MkDir(DBfile *_dbfile, char const *name);
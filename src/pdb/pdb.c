@@ -103,6 +103,7 @@ jmp_buf		_lite_PD_create_err ;
 jmp_buf		_lite_PD_generic_err ;
 char		lite_PD_err[MAXLINE];
 int		lite_PD_buffer_size = -1;
+int		lite_PD_io_mode = PD_IO_STDIO;
 ReaderFuncType	lite_pdb_rd_hook = NULL;
 WriterFuncType	lite_pdb_wr_hook = NULL;
 char           *lite_PD_DEF_CREATM = "wx";
@@ -160,6 +161,8 @@ lite_PD_close(PDBfile *file) {
    if (io_close(fp) != 0) {
       lite_PD_error("CAN'T CLOSE FILE - PD_CLOSE", PD_CLOSE);
    }
+   _lite_PD_pio_unmap(file->map_addr, file->map_size);
+   file->map_addr = NULL;
 
    /*
     * Free the space
@@ -288,6 +291,8 @@ lite_PD_open (char *name, char *mode) {
    char		str[MAXLINE], *token;
    PDBfile 	*file=NULL;
    static FILE 	*fp;
+   static char	*map_addr;
+   static long	map_size;
    syment 	*ep;
 
 #ifdef PDB_WRITE
@@ -299,9 +304,14 @@ lite_PD_open (char *name, char *mode) {
    assert (!strchr(mode,'r')) ;
 #endif
 
+   fp       = NULL;
+   map_addr = NULL;
+   map_size = 0L;
+
    switch (setjmp(_lite_PD_open_err)) {
    case ABORT:
       if (fp) io_close(fp);
+      _lite_PD_pio_unmap(map_addr, map_size);
       return(NULL);
    case ERR_FREE:
       return(file);
@@ -315,8 +325,15 @@ lite_PD_open (char *name, char *mode) {
     */
    strcpy(str, name);
 
+   /*
+    * Files only read may be read from a memory map instead. If the
+    * file can't be mapped fall back to a stdio stream.
+    */
+   if ((lite_PD_io_mode == PD_IO_MMAP) && !strchr(mode,'a'))
+      fp = _lite_PD_pio_map(str, &map_addr, &map_size);
+
 #ifdef PDB_WRITE
-   fp = io_open(str, BINARY_MODE_RPLUS);
+   if (fp == NULL) fp = io_open(str, BINARY_MODE_RPLUS);
    if (fp == NULL) {
       if (strchr(mode,'r')) {
 #endif
@@ -334,7 +351,7 @@ lite_PD_open (char *name, char *mode) {
    }
 #endif
 
-   if (lite_PD_buffer_size != -1) {
+   if ((lite_PD_buffer_size != -1) && (map_addr == NULL)) {
       if (io_setvbuf(fp, NULL, _IOFBF, (size_t) lite_PD_buffer_size)) {
 	 lite_PD_error("CAN'T SET FILE BUFFER - PD_OPEN", PD_OPEN);
       }
@@ -344,7 +361,9 @@ lite_PD_open (char *name, char *mode) {
    if (file == NULL) {
       lite_PD_error("CAN'T ALLOCATE PDBFILE - PD_OPEN", PD_OPEN);
    }
-   file->stream = fp;
+   file->stream   = fp;
+   file->map_addr = map_addr;
+   file->map_size = map_size;
 #ifdef PDB_WRITE
    if (strchr(mode,'a')) file->mode = PD_APPEND;
    else file->mode = PD_OPEN;
@@ -1806,6 +1825,24 @@ int lite_PD_set_buffer_size(int s)
     return lite_PD_buffer_size;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    lite_PD_set_io_mode
+ *
+ * Purpose:     Select how files opened from now on are accessed, either
+ *              PD_IO_STDIO or PD_IO_MMAP. PD_IO_MMAP applies only to
+ *              files opened for reading and only where memory maps are
+ *              available; other files use stdio.
+ *
+ * Return:      The previous mode.
+ *-------------------------------------------------------------------------
+ */
+int lite_PD_set_io_mode(int m)
+{
+    int old = lite_PD_io_mode;
+    lite_PD_io_mode = m;
+    return old;
+}
+
 #ifndef _MSC_VER
 #warning MOVE TO PDLOW.C
 #endif
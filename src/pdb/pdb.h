@@ -116,6 +116,9 @@ extern "C" {
 #define NSTD         6       /* Number of standards currently in the system 
                                             should be same as last standard */
 
+#define PD_IO_STDIO  0             /* stdio stream, lite_PD_buffer_size */
+#define PD_IO_MMAP   1       /* read-only files read from a memory map */
+
 #define PD_READ   0
 #define PD_WRITE  1
 #define PD_APPEND 2
@@ -277,6 +280,10 @@ struct s_PDBfile {
    long symtaddr;
    long chrtaddr;
    int ignore_apersand_ptr_ia_syms; 
+   int defer_symt;                     /* index symtab, parse on lookup */
+   char *symt_buf;                     /* symtab text for deferred entries */
+   char *map_addr;                     /* memory map backing stream, if any */
+   long map_size;
 };
 
 typedef struct s_PDBfile PDBfile;
@@ -460,6 +467,7 @@ extern jmp_buf		_lite_PD_read_err ;
 extern jmp_buf		_lite_PD_trace_err ;
 extern char		lite_PD_err[] ;
 extern int		lite_PD_buffer_size ;
+extern int		lite_PD_io_mode ;
 extern int		lite_FORMAT_FIELDS ;
 extern char*            lite_PD_DEF_CREATM;
 extern data_standard	lite_IEEEA_STD ;
@@ -561,6 +569,8 @@ extern data_standard *	_lite_PD_mk_standard (void);
 extern syment *		_lite_PD_mk_syment (char*,long,long,symindir*,dimdes*);
 extern int		_lite_PD_null_pointer (char*,int);
 extern int		_lite_PD_pio_close (FILE*);
+extern FILE *		_lite_PD_pio_map (char*,char**,long*);
+extern void		_lite_PD_pio_unmap (char*,long);
 extern int		_lite_PD_pio_printf (FILE*,char*,...);
 extern int		_lite_PD_pio_seek (FILE*,long,int);
 extern int		_lite_PD_prim_typep (char*,HASHTAB*,int);
@@ -571,6 +581,7 @@ extern int		_lite_PD_rd_itag (PDBfile*,PD_itag*);
 extern void		_lite_PD_rd_prim_extras (PDBfile*,int,int,char*);
 extern long		_lite_PD_rd_syment (PDBfile*,syment*,char*,lite_SC_byte*);
 extern int		_lite_PD_rd_symt (PDBfile*);
+extern void		_lite_PD_rl_symt_index (PDBfile*);
 extern char *		_lite_PD_rfgets (char*,int,FILE*);
 extern void		_lite_PD_rl_alignment (data_alignment*);
 extern void		_lite_PD_rl_defstr (defstr*);
@@ -585,6 +596,7 @@ extern void		_lite_PD_setup_chart (HASHTAB*,data_standard*,
 					      data_alignment*,int);
 LITE_API extern long		_lite_PD_skip_over (PDBfile*,long,int);
 LITE_API extern long		_lite_PD_str_size (memdes*,HASHTAB*);
+extern syment *		_lite_PD_symt_lookup (PDBfile*,char*);
 LITE_API extern int		_lite_PD_unp_bits (char*,char*,int,int,int,int,long,
 					   long);
 
@@ -613,6 +625,7 @@ LITE_API extern int      lite_PD_append_as(PDBfile *file, char *name, char *inty
 LITE_API extern int      lite_PD_append_as_alt(PDBfile *file, char *name, char *intype, void *vr, int nd, long *ind);
 /* added 21Mar17 for Collette */
 LITE_API extern int      lite_PD_set_buffer_size(int s);
+LITE_API extern int      lite_PD_set_io_mode(int m);
 LITE_API extern char    *lite_PD_get_error(void);
 LITE_API extern syment  *lite_PD_query_entry(PDBfile *file, char *name, char *fullname);
 LITE_API extern int      lite_PD_get_entry_info(syment *ep, char **type, long *size, int *ndims, long **dims);
@@ -63,6 +63,12 @@ be used for advertising or product endorsement purposes.
 #if HAVE_STDARG_H
 #include <stdarg.h>
 #endif
+#if defined(HAVE_MMAP) && defined(HAVE_FMEMOPEN)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "pdb.h"
 
 static char 	Pbuffer[LRG_TXT_BUFFER];
@@ -96,6 +102,81 @@ _lite_PD_pio_close (FILE *stream) {
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:	_lite_PD_pio_map
+ *
+ * Purpose:	Map the named file read-only into memory and return a
+ *		stream reading from the mapping, so that reads copy from
+ *		the mapped pages without system calls. Reads larger than
+ *		the stream's buffer copy straight into the caller's memory.
+ *		The mapping's address and size are returned in ADDR and
+ *		SIZE and must be released with _lite_PD_pio_unmap after
+ *		the stream is closed.
+ *
+ * Return:	Success:	the stream
+ *
+ *		Failure:	NULL, also where memory maps are unavailable
+ *
+ *-------------------------------------------------------------------------
+ */
+FILE *
+_lite_PD_pio_map (char *name, char **addr, long *size) {
+
+#if defined(HAVE_MMAP) && defined(HAVE_FMEMOPEN)
+   struct stat sb;
+   void *map;
+   FILE *fp;
+   int fd;
+
+   *addr = NULL;
+   *size = 0L;
+
+   if ((fd = open(name, O_RDONLY)) < 0) return(NULL);
+   if ((fstat(fd, &sb) != 0) || (sb.st_size <= 0)) {
+      close(fd);
+      return(NULL);
+   }
+
+   map = mmap(NULL, (size_t) sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (map == MAP_FAILED) return(NULL);
+
+   fp = fmemopen(map, (size_t) sb.st_size, BINARY_MODE_R);
+   if (fp == NULL) {
+      munmap(map, (size_t) sb.st_size);
+      return(NULL);
+   }
+
+   *addr = (char *) map;
+   *size = (long) sb.st_size;
+   return(fp);
+#else
+   *addr = NULL;
+   *size = 0L;
+   return(NULL);
+#endif
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	_lite_PD_pio_unmap
+ *
+ * Purpose:	Release a mapping made by _lite_PD_pio_map. Does nothing
+ *		if ADDR is NULL.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+_lite_PD_pio_unmap (char *addr, long size) {
+
+#if defined(HAVE_MMAP) && defined(HAVE_FMEMOPEN)
+   if (addr != NULL) munmap(addr, (size_t) size);
+#endif
+}
+
+
 /*-------------------------------------------------------------------------
  * Function:	_lite_PD_pio_seek
  *
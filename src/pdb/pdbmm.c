@@ -135,6 +135,12 @@ _lite_PD_mk_pdb (char *name, const char *options) {
    file->ignore_apersand_ptr_ia_syms = 0;
    if (strchr(options, 'i')) file->ignore_apersand_ptr_ia_syms = 1;
 
+   file->defer_symt = 0;
+   file->symt_buf   = NULL;
+   file->map_addr   = NULL;
+   file->map_size   = 0L;
+   if (strchr(options, 'd')) file->defer_symt = 1;
+
    return(file);
 }
 
@@ -170,6 +176,7 @@ _lite_PD_rl_pdb (PDBfile *file) {
 
    _lite_PD_clr_table(file->host_chart,(FreeFuncType)_lite_PD_rl_defstr);
    _lite_PD_clr_table(file->chart,(FreeFuncType)_lite_PD_rl_defstr);
+   _lite_PD_rl_symt_index(file);
    _lite_PD_clr_table(file->symtab,(FreeFuncType)_lite_PD_rl_syment_d);
 
    if (file->previous_file != NULL) SFREE(file->previous_file);
@@ -62,6 +62,27 @@ be used for advertising or product endorsement purposes.
 #include "pdb.h"
 #include "pdform.h"
 
+/*
+ * _PD_bswap uses SSSE3 byte shuffles when the CPU it runs on has them.
+ * Compilers that support per-function targets build that code even when
+ * the library as a whole is not compiled for SSSE3.
+ */
+#if defined(__SSSE3__)
+#define PD_SSSE3
+#define PD_SSSE3_TARGET
+#define PD_SSSE3_CPU    1
+#elif (defined(__x86_64__) || defined(__i386__)) &&                         \
+      (defined(__clang__) || (__GNUC__ > 4) ||                               \
+       ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))
+#define PD_SSSE3
+#define PD_SSSE3_TARGET __attribute__((target("ssse3")))
+#define PD_SSSE3_CPU    __builtin_cpu_supports("ssse3")
+#endif
+
+#ifdef PD_SSSE3
+#include <tmmintrin.h>
+#endif
+
 #define ONES_COMP_NEG(n, nb, incr)                                           \
     {if (nb == 8*sizeof(long))                                               \
         n = ~n + incr;                                                       \
@@ -74,6 +95,10 @@ be used for advertising or product endorsement purposes.
  * Forward declarations...
  */
 static void             _PD_btrvout (char*,long,long);
+static int              _PD_bswap (char*,char*,long,int);
+#ifdef PD_SSSE3
+static long             _PD_bswap_ssse3 (unsigned char*,unsigned char*,long,int);
+#endif
 static int              _PD_get_bit (char*,int,int,int*);
 static void             _PD_insert_field (long,int,char*,int,int,int);
 static void             _PD_ncopy (char**,char**,long,long);
@@ -635,6 +660,9 @@ _lite_PD_convert_ascii (char *out, char *in, long nitems, int bpci, int offs) {
  *
  * Modifications:
  *
+ *      Copy or byte swap integers whose size does not change in a
+ *      single pass.
+ *
  *-------------------------------------------------------------------------
  */
 void
@@ -648,6 +676,20 @@ _lite_PD_iconvert (char **out, char **in, long nitems, long nbi, int ordi,
    lin = *in;
    lout = *out;
 
+   /*
+    * Integers of the same size need only be copied or byte swapped.
+    */
+   if ((nbi == nbo) && !onescmp) {
+      if (ordi == ordo)
+         memmove(lout, lin, nitems*nbo);
+      else if (!_PD_bswap(lout, lin, nitems, (int) nbo))
+         goto general;
+      *in  += nitems*nbi;
+      *out += nitems*nbo;
+      return;
+   }
+
+general:
    /*
     * Convert nitems integers.
     * test sign bit to properly convert negative integers
@@ -819,6 +861,10 @@ _lite_PD_iconvert (char **out, char **in, long nitems, long nbi, int ordi,
  *      Sean Ahern, Fri Mar  2 09:40:15 PST 2001
  *      Reformatted some of the code.
  *
+ *      Added a logic path for formats that differ only in byte order
+ *      being reversed, e.g. big and little endian IEEE, which swaps
+ *      the bytes of each item instead of converting it bit by bit.
+ *
  *-------------------------------------------------------------------------*/
 void
 _lite_PD_fconvert (char **out, char **in, long nitems, int boffs, long *infor,
@@ -855,6 +901,24 @@ _lite_PD_fconvert (char **out, char **in, long nitems, int boffs, long *infor,
    hexpn     = 1L << (outfor[1] - 1L);
    expn_max  = (1L << outfor[1]) - 1L;
 
+   /*
+    * Same format in reversed byte order.
+    */
+   if ((boffs == 0) && !onescmp && (nbi == 8*inbytes)) {
+      for (i = 0; i < lite_FORMAT_FIELDS; i++)
+         if (infor[i] != outfor[i])
+            break;
+      for (dindx = 0; (i == lite_FORMAT_FIELDS) && (dindx < inbytes); dindx++)
+         if (inord[inbytes-1-dindx] != outord[dindx])
+            break;
+      if ((i == lite_FORMAT_FIELDS) && (dindx == inbytes) &&
+          _PD_bswap(*out, *in, nitems, inbytes)) {
+         *in  += nitems*inbytes;
+         *out += nitems*outbytes;
+         return;
+      }
+   }
+
     if ( (inord[0] != outord[0]) ||
          (infor[0] != outfor[0]) || (infor[1] != outfor[1]) ||
          (infor[2] != outfor[2]) || (infor[3] != outfor[3]) ||
@@ -1223,6 +1287,110 @@ _PD_btrvout (char *out, long nb, long nitems) {
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:    _PD_bswap
+ *
+ * Purpose:     Copy NITEMS words of NB bytes each from IN to OUT
+ *              reversing the bytes of each word. IN and OUT may be the
+ *              same buffer. Uses SSSE3 byte shuffles when the CPU has
+ *              them.
+ *
+ * Return:      Success:        TRUE
+ *
+ *              Failure:        FALSE if NB is not 2, 4 or 8
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+_PD_bswap (char *out, char *in, long nitems, int nb) {
+
+   unsigned char *o = (unsigned char *) out;
+   unsigned char *p = (unsigned char *) in;
+   unsigned char t0, t1, t2, t3;
+   long i = 0L, nbytes = nitems*nb;
+
+   if ((nb != 2) && (nb != 4) && (nb != 8))
+      return(FALSE);
+
+#ifdef PD_SSSE3
+   if (PD_SSSE3_CPU)
+      i = _PD_bswap_ssse3(o, p, nbytes, nb);
+#endif
+
+   switch (nb) {
+      case 2:
+         for (; i < nbytes; i += 2) {
+            t0 = p[i];
+            o[i]   = p[i+1];
+            o[i+1] = t0;
+         }
+         break;
+      case 4:
+         for (; i < nbytes; i += 4) {
+            t0 = p[i]; t1 = p[i+1];
+            o[i]   = p[i+3];
+            o[i+1] = p[i+2];
+            o[i+2] = t1;
+            o[i+3] = t0;
+         }
+         break;
+      case 8:
+         for (; i < nbytes; i += 8) {
+            t0 = p[i]; t1 = p[i+1]; t2 = p[i+2]; t3 = p[i+3];
+            o[i]   = p[i+7];
+            o[i+1] = p[i+6];
+            o[i+2] = p[i+5];
+            o[i+3] = p[i+4];
+            o[i+4] = t3;
+            o[i+5] = t2;
+            o[i+6] = t1;
+            o[i+7] = t0;
+         }
+         break;
+   }
+
+   return(TRUE);
+}
+
+
+#ifdef PD_SSSE3
+/*-------------------------------------------------------------------------
+ * Function:    _PD_bswap_ssse3
+ *
+ * Purpose:     Reverse the bytes of each NB byte word in the leading
+ *              multiple of 16 bytes of the NBYTES at IN, storing them at
+ *              OUT. Must only be called when the CPU has SSSE3.
+ *
+ * Return:      The number of bytes done.
+ *
+ *-------------------------------------------------------------------------
+ */
+PD_SSSE3_TARGET static long
+_PD_bswap_ssse3 (unsigned char *o, unsigned char *p, long nbytes, int nb) {
+
+   __m128i mask;
+   long i;
+
+   if (nb == 2)
+      mask = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+                           9, 8, 11, 10, 13, 12, 15, 14);
+   else if (nb == 4)
+      mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                           11, 10, 9, 8, 15, 14, 13, 12);
+   else
+      mask = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0,
+                           15, 14, 13, 12, 11, 10, 9, 8);
+
+   for (i = 0L; i + 16 <= nbytes; i += 16)
+      _mm_storeu_si128((__m128i *) (o + i),
+                       _mm_shuffle_epi8(_mm_loadu_si128((__m128i *) (p + i)),
+                                        mask));
+
+   return(i);
+}
+#endif
+
+
 /*-------------------------------------------------------------------------
  * Function:    _lite_PD_extract_field
  *
@@ -169,9 +169,20 @@ static int      _PD_has_dirs = FALSE;
 static char     local[LRG_TXT_BUFFER];
 static char     **_PD_cast_lst ;
 
+/*
+ * Hash table type of symbol table entries which have been indexed but
+ * not yet parsed. The def of such an entry points at its line of text.
+ */
+static char     _PD_deferred_s[] = "deferred syment";
+
+#define _PD_SYMT_EOL(c) (((c) == '\n') || ((c) == 0x1f) || ((c) == (char) EOF))
+
 static defstr * _lite_PD_defstr (HASHTAB*,char*,int,long,int,int,int*,long*);
 static char *   _PD_get_tok (char*,int,FILE*,int);
 static char *   _PD_get_token (char*,char*,int,int);
+static int      _PD_index_symt (PDBfile*);
+static syment * _PD_parse_syment (char*);
+static char *   _PD_symt_field (char*,char*,int);
 static int      _PD_consistent_dims (PDBfile*,syment*,dimdes*);
 
 #ifdef PDB_WRITE
@@ -445,6 +456,9 @@ _lite_PD_rd_symt (PDBfile *file) {
    if (numb != symt_sz) return(FALSE);
    _lite_PD_tbuffer[symt_sz-1] = (char) EOF;
 
+   if (file->defer_symt && (file->mode == PD_OPEN))
+      return(_PD_index_symt(file));
+
    pbf  = _lite_PD_tbuffer;
    prev = NULL;
    tab  = file->symtab;
@@ -476,6 +490,193 @@ _lite_PD_rd_symt (PDBfile *file) {
    return(TRUE);
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    _PD_index_symt
+ *
+ * Purpose:     Deferred form of _lite_PD_rd_symt. Install only the name
+ *              of each entry in the symbol table, pointing at its line
+ *              of text in the retained table buffer. The syment itself
+ *              is built by _lite_PD_symt_lookup the first time the entry
+ *              is asked for.
+ *
+ * Return:      Success:        TRUE
+ *
+ *              Failure:        FALSE
+ *-------------------------------------------------------------------------
+ */
+static int
+_PD_index_symt (PDBfile *file) {
+
+   char *pbf, *pnm, *peol;
+   long n;
+
+   pbf = _lite_PD_tbuffer;
+   while (*pbf != (char) EOF) {
+      for (peol = pbf; !_PD_SYMT_EOL(*peol); peol++) /*void*/;
+      for (pnm = pbf; (pnm < peol) && (*pnm == '\001'); pnm++) /*void*/;
+
+      /*
+       * An empty line ends the symbol table.
+       */
+      if (pnm == peol) {
+         pbf = (*peol == (char) EOF) ? peol : peol + 1;
+         break;
+      }
+
+      for (n = 0; (pnm + n < peol) && (pnm[n] != '\001'); n++) /*void*/;
+      if (n >= LRG_TXT_BUFFER) return(FALSE);
+      memcpy(local, pnm, n);
+      local[n] = '\0';
+
+      if (!(file->ignore_apersand_ptr_ia_syms &&
+            strstr(local, "/&ptrs/ia_")))
+         lite_SC_install(local, (lite_SC_byte *) pbf, _PD_deferred_s,
+                         file->symtab);
+
+      pbf = (*peol == (char) EOF) ? peol : peol + 1;
+   }
+
+   /*
+    * Leave the tokenizer positioned at the extras table for
+    * _lite_PD_rd_extras and keep the buffer for later lookups.
+    */
+   _PD_get_token(pbf, local, 0, '\n');
+   file->symt_buf = _lite_PD_tbuffer;
+
+   return(TRUE);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    _PD_symt_field
+ *
+ * Purpose:     Copy the next \001 delimited field of a symbol table line
+ *              into S. This is strtok for a single line which leaves the
+ *              line intact and the strtok state of the caller alone.
+ *
+ * Return:      Success:        Ptr to the character following the field.
+ *
+ *              Failure:        NULL, no more fields on the line.
+ *-------------------------------------------------------------------------
+ */
+static char *
+_PD_symt_field (char *p, char *s, int n) {
+
+   int i;
+
+   while (*p == '\001') p++;
+   if (_PD_SYMT_EOL(*p)) return(NULL);
+
+   for (i = 0; !_PD_SYMT_EOL(*p) && (*p != '\001'); p++) {
+      if (i < n - 1) s[i++] = *p;
+   }
+   s[i] = '\0';
+
+   return(p);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    _PD_parse_syment
+ *
+ * Purpose:     Build the syment for one line of the symbol table text
+ *              the same way _lite_PD_rd_symt does.
+ *
+ * Return:      Success:        Ptr to a new syment.
+ *
+ *              Failure:        NULL
+ *-------------------------------------------------------------------------
+ */
+static syment *
+_PD_parse_syment (char *pbf) {
+
+   char type[MAXLINE], fld[MAXLINE], *p;
+   long numb, addr, mini, leng;
+   dimdes *dims, *next, *prev;
+
+   if ((p = _PD_symt_field(pbf, fld, MAXLINE)) == NULL) return(NULL);
+   if ((p = _PD_symt_field(p, type, MAXLINE)) == NULL) return(NULL);
+   if ((p = _PD_symt_field(p, fld, MAXLINE)) == NULL) return(NULL);
+   numb = lite_SC_stol(fld);
+   if ((p = _PD_symt_field(p, fld, MAXLINE)) == NULL) return(NULL);
+   addr = lite_SC_stol(fld);
+
+   dims = NULL;
+   prev = NULL;
+   while ((p = _PD_symt_field(p, fld, MAXLINE)) != NULL) {
+      mini = lite_SC_stol(fld);
+      p    = _PD_symt_field(p, fld, MAXLINE);
+      leng = (p == NULL) ? 0L : lite_SC_stol(fld);
+      next = _lite_PD_mk_dimensions(mini, leng);
+      if (dims == NULL) {
+         dims = next;
+      } else {
+         prev->next = next;
+      }
+
+      prev = next;
+      if (p == NULL) break;
+   }
+
+   return(_lite_PD_mk_syment(type, numb, addr, NULL, dims));
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    _lite_PD_symt_lookup
+ *
+ * Purpose:     Look up NAME in the symbol table of FILE, building the
+ *              syment first if the table was only indexed at open.
+ *
+ * Return:      Success:        Ptr to the syment.
+ *
+ *              Failure:        NULL
+ *-------------------------------------------------------------------------
+ */
+syment *
+_lite_PD_symt_lookup (PDBfile *file, char *name) {
+
+   hashel *hp;
+
+   hp = lite_SC_lookup(name, file->symtab);
+   if (hp == NULL) return(NULL);
+
+   if (hp->type == _PD_deferred_s) {
+      hp->def  = (lite_SC_byte *) _PD_parse_syment((char *) hp->def);
+      hp->type = lite_PD_SYMENT_S;
+   }
+
+   return((syment *) hp->def);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    _lite_PD_rl_symt_index
+ *
+ * Purpose:     Forget the symbol table entries which were never looked up
+ *              and release the table text they point into. This must
+ *              precede releasing the symbol table itself.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+void
+_lite_PD_rl_symt_index (PDBfile *file) {
+
+   int i;
+   hashel *hp;
+
+   if (file->symt_buf == NULL) return;
+
+   for (i = 0; i < file->symtab->size; i++) {
+      for (hp = file->symtab->table[i]; hp != NULL; hp = hp->next) {
+         if (hp->type == _PD_deferred_s) {
+            hp->def  = NULL;
+            hp->type = lite_PD_SYMENT_S;
+         }
+      }
+   }
+
+   if (_lite_PD_tbuffer == file->symt_buf) _lite_PD_tbuffer = NULL;
+   SFREE(file->symt_buf);
+}
+
 /*-------------------------------------------------------------------------
  * Function:    _lite_PD_rd_chrt
  *
@@ -799,9 +1000,11 @@ _lite_PD_rd_extras (PDBfile *file) {
    else file->align = _lite_PD_copy_alignment(&lite_DEF_ALIGNMENT);
 
    /*
-    * Release the buffer which held both the symbol table and the extras.
+    * Release the buffer which held both the symbol table and the extras
+    * unless the deferred symbol table entries still point into it.
     */
-   SFREE(_lite_PD_tbuffer);
+   if (_lite_PD_tbuffer == file->symt_buf) _lite_PD_tbuffer = NULL;
+   else SFREE(_lite_PD_tbuffer);
 
    return(TRUE);
 }
@@ -891,11 +1094,15 @@ void
 _lite_PD_e_install (char *name, syment *entr, HASHTAB *tab) {
 
    syment *ep;
+   hashel *hp;
 
    /*
-    * We can leak a lot of memory if we don't check this!!
+    * We can leak a lot of memory if we don't check this!! Deferred
+    * entries own nothing and are simply overwritten.
     */
-   ep = (syment *) lite_SC_def_lookup(name, tab);
+   hp = lite_SC_lookup(name, tab);
+   ep = (hp == NULL) || (hp->type == _PD_deferred_s) ?
+        NULL : (syment *) hp->def;
    if (ep != NULL) {
       lite_SC_hash_rem(name, tab);
       _lite_PD_rl_syment_d(ep);
@@ -539,7 +539,7 @@ lite_PD_inquire_entry(PDBfile *file, char *name, int flag, char *fullname) {
 
    if (fullname != NULL) strcpy(fullname, s);
 
-   ep = (syment *) lite_SC_def_lookup(s, file->symtab);
+   ep = _lite_PD_symt_lookup(file, s);
 
    /*
     * If the file has directories and the entry is not "/",
@@ -549,12 +549,12 @@ lite_PD_inquire_entry(PDBfile *file, char *name, int flag, char *fullname) {
        (PD_has_directories(file)) &&
        (strcmp(s, "/") != 0)) {
       if (strrchr(s, '/') == s) {
-	 ep = (syment *) lite_SC_def_lookup(s + 1, file->symtab);
+	 ep = _lite_PD_symt_lookup(file, s + 1);
       } else if (strrchr(s, '/') == NULL) {
 	 char t[MAXLINE];
 	 if (snprintf(t, sizeof(t), "/%s", s)>=sizeof(t))
              t[sizeof(t)-1] = '\0';
-	 ep = (syment *) lite_SC_def_lookup(t, file->symtab);
+	 ep = _lite_PD_symt_lookup(file, t);
       }
    }
 
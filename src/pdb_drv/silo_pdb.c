@@ -414,24 +414,40 @@ static int     _pj_force_single = FALSE;
 
 /* Definition of global variables (bleah!) */
 
-/* The variable use_PJgroup_cache is used in the PJ_GetObject function call.
- * That function will cache any PJgroup that it retrieves, if possible.
- * Sometimes, however, we've changed the state of the file (like changing
- * directories) and must ignore any cache that we already have.  The
- * "use_PJgroup_cache" variable is a boolean value that allows us to ignore
- * the cached value when we need to.  Note that, even if this variable is set
- * to 0 here, it will be reset to 1 after the first group is read.
+/* PJ_GetObject keeps the PJgroups it reads in a per-file LRU cache keyed
+ * on the object's full path, so readers alternating among a handful of
+ * objects do not re-read and re-parse them. A cache is created for each
+ * file the driver opens or creates and released when it is closed. At
+ * most DBGetPDBObjectCacheSizeFile() groups (but at least one) are kept.
+ * Writing a group removes any cached copy of it.
  */
-static int use_PJgroup_cache = 1;
-
-/* To cache the PJgroup, we need to keep the group, and we need to keep
- * the "definition" of which object it is.  This information can be
- * captured by storing the name of the object, the name of the file it
- * came from, and the directory from which it came.
+typedef struct pj_cache_entry_t {
+    char                    *path;
+    PJgroup                 *group;
+    struct pj_cache_entry_t *prev;
+    struct pj_cache_entry_t *next;
+} pj_cache_entry_t;
+
+typedef struct pj_cache_t {
+    PDBfile                 *pdb;
+    DBfile                  *dbfile;
+    pj_cache_entry_t        *head;      /* most recently used first */
+    pj_cache_entry_t        *tail;      /* least recently used */
+    int                      n;
+    long long                hits;
+    long long                misses;
+    long long                evictions;
+    struct pj_cache_t       *next;
+} pj_cache_t;
+
+static pj_cache_t *pj_caches = NULL;
+
+/* The group last returned by PJ_GetObject, used by PJ_GetComponentType.
+ * It belongs to a cache unless it came from a file without one (an object
+ * named in another file), in which case uncached_group owns it.
  */
 static PJgroup *cached_group = NULL;
-static char    *cached_obj_name = NULL;
-static char    *cached_file_name = NULL;
+static PJgroup *uncached_group = NULL;
 
 PRIVATE int db_pdb_ParseVDBSpec (char const *mvdbspec, char **varname,
                                  char **filename);
@@ -487,29 +503,107 @@ PJ_InqForceSingle(void)
 }
 
 /*----------------------------------------------------------------------
- *  Routine:                                                PJ_NoCache
+ *  Routine                                               pj_cache_find
+ *
+ *  Purpose
  *
- *  Purpose:
- *      Turn off caching of PJgroups until the next PJ_GetObject call.
+ *      Return the object cache of the given file, if it has one.
+ *--------------------------------------------------------------------
+ */
+PRIVATE pj_cache_t *
+pj_cache_find(PDBfile *file)
+{
+    pj_cache_t *c;
+
+    for (c = pj_caches; c != NULL; c = c->next)
+        if (c->pdb == file)
+            return c;
+    return NULL;
+}
+
+/*----------------------------------------------------------------------
+ *  Routine                                             pj_cache_unlink
  *
- *  Programmer:
- *      Sean Ahern, Mon Jul  1 08:23:41 PDT 1996
+ *  Purpose
  *
- *  Notes:
- *     See comment at the top of this file about the use_PJgroup_cache
- *     global variable.
+ *      Remove an entry from its cache's list without freeing it.
+ *--------------------------------------------------------------------
+ */
+PRIVATE void
+pj_cache_unlink(pj_cache_t *c, pj_cache_entry_t *e)
+{
+    if (e->prev) e->prev->next = e->next;
+    else c->head = e->next;
+    if (e->next) e->next->prev = e->prev;
+    else c->tail = e->prev;
+    e->prev = e->next = NULL;
+    c->n--;
+}
+
+/*----------------------------------------------------------------------
+ *  Routine                                               pj_cache_free
  *
- *  Modifications:
+ *  Purpose
  *
- *     Jim Reus, 23 Apr 97
- *     Provide void in parameter list (to agree with header file).
+ *      Remove an entry from its cache and release it and its group.
+ *--------------------------------------------------------------------
+ */
+PRIVATE void
+pj_cache_free(pj_cache_t *c, pj_cache_entry_t *e)
+{
+    pj_cache_unlink(c, e);
+    if (cached_group == e->group)
+        cached_group = NULL;
+    PJ_rel_group(e->group);
+    FREE(e->path);
+    FREE(e);
+}
+
+/*----------------------------------------------------------------------
+ *  Routine                                                PJ_OpenCache
+ *
+ *  Purpose
  *
+ *      Create the object cache for a file the driver has just opened or
+ *      created.
  *--------------------------------------------------------------------
  */
 INTERNAL void
-PJ_NoCache ( void )
+PJ_OpenCache(PDBfile *file, DBfile *dbfile)
 {
-    use_PJgroup_cache = 0;
+    pj_cache_t *c = ALLOC(pj_cache_t);
+
+    c->pdb = file;
+    c->dbfile = dbfile;
+    c->next = pj_caches;
+    pj_caches = c;
+}
+
+/*----------------------------------------------------------------------
+ *  Routine                                              PJ_ForgetObject
+ *
+ *  Purpose
+ *
+ *      Drop the cached copy, if any, of the object with the given full
+ *      path because it is being written.
+ *--------------------------------------------------------------------
+ */
+INTERNAL void
+PJ_ForgetObject(PDBfile *file, char const *path)
+{
+    pj_cache_t *c = pj_cache_find(file);
+    pj_cache_entry_t *e;
+
+    if (c == NULL)
+        return;
+    for (e = c->head; e != NULL; e = e->next)
+    {
+        if (strcmp(e->path, path) == 0)
+        {
+            pj_cache_free(c, e);
+            return;
+        }
+    }
 }
 
 
@@ -565,14 +659,19 @@ PJ_NoCache ( void )
  *      Replaced returned 'ret_type' argument with input expected_dbtype
  *      argument and cause it to fail if type that is read doesn't
  *      match the expected_dbtype.
+ *
+ *      Replaced the single cached PJgroup with a per-file LRU cache
+ *      keyed on the object's full path.
  *--------------------------------------------------------------------*/
 INTERNAL int
 PJ_GetObject(PDBfile *file_in, char const *objname_in, PJcomplist *tobj, int expected_dbtype)
 {
     int             i, j, error;
-    char           *varname=NULL, *filename=NULL;
+    char           *varname=NULL, *filename=NULL, *path=NULL;
     char const     *objname=NULL;
     PDBfile        *file=NULL;
+    pj_cache_t     *cache=NULL;
+    pj_cache_entry_t *e=NULL;
     char           *me = "PJ_GetObject";
 
     if (!file_in)
@@ -608,67 +707,92 @@ PJ_GetObject(PDBfile *file_in, char const *objname_in, PJcomplist *tobj, int exp
         file = file_in;
     }
 
-    /* Read object description if we don't have it cached.
-     *
-     * There are three things that we have to check:
-     *     use_PJgroup_cache is true
-     *     cache_obj_name is the same as the passed-in name
-     *     cache_file_name is the same as the passed-in file's name
-     *
-     * If any of these are false, we can't use the cached PJgroup and must
-     * instead read a new one from the PDBfile.
-     */
-    if ((use_PJgroup_cache == 0) ||
-        (cached_obj_name == NULL) || (strcmp(cached_obj_name, objname) != 0) ||
-        (cached_file_name == NULL) || (strcmp(cached_file_name, file->name)))
+    /* Read the object description unless it is in the file's cache. Objects
+     * named in another file are read every time and kept only until the
+     * next call. */
+    cache = file == file_in ? pj_cache_find(file) : NULL;
+    if (cache)
     {
-        PJ_ClearCache();
-        error = !PJ_get_group(file, objname, &cached_group);
-        if (error || cached_group == NULL)
+        path = db_absoluteOf_path(lite_PD_pwd(file), objname);
+        for (e = cache->head; e != NULL; e = e->next)
+            if (strcmp(e->path, path) == 0)
+                break;
+    }
+
+    if (e)
+    {
+        cache->hits++;
+        pj_cache_unlink(cache, e);
+        FREE(path);
+    }
+    else
+    {
+        PJgroup *group = NULL;
+
+        if (cache)
+            cache->misses++;
+        error = !PJ_get_group(file, objname, &group);
+        if (error || group == NULL)
         {
             char err_str[256];
             sprintf(err_str,"PJ_get_group: Probably no such object \"%s\".",objname);
+            FREE(path);
             FREE(varname);
-            FREE(filename);
+            if (filename != NULL)
+            {
+                FREE(filename);
+                lite_PD_close(file);
+            }
             db_perror(err_str, E_CALLFAIL, me);
             return -1;
         }
 
-        /* Check object type before we do any allocations */
-        if (expected_dbtype > 0)
+        if (cache)
         {
-            int matched = 1;
-            if (expected_dbtype == DB_QUADMESH)
-            {
-                if ((strcmp(cached_group->type, DBGetObjtypeName(DB_QUAD_RECT)) != 0) &&
-                    (strcmp(cached_group->type, DBGetObjtypeName(DB_QUAD_CURV)) != 0))
-                    matched = 0;
-            }  
-            else if (strcmp(cached_group->type, DBGetObjtypeName(expected_dbtype)) != 0)
-            {
-                matched = 0;
-            }
-            if (!matched)
+            e = ALLOC(pj_cache_entry_t);
+            e->path = path;
+            e->group = group;
+        }
+        else
+        {
+            if (uncached_group)
             {
-                char error[256];
-                sprintf(error,"Requested %s object \"%s\" is not a %s.",
-                    cached_group->type, objname_in, DBGetObjtypeName(expected_dbtype));
-                FREE(varname);
-                FREE(filename);
-                db_perror(error, E_NOTFOUND, me);
-                return -1;
+                if (cached_group == uncached_group)
+                    cached_group = NULL;
+                PJ_rel_group(uncached_group);
             }
+            uncached_group = group;
         }
+    }
 
-        /* We've gotten a new group, remember which one it is. */
-        cached_obj_name = STRDUP(objname);
-        cached_file_name = STRDUP(file->name);
+    if (e)
+    {
+        int maxn = DBGetPDBObjectCacheSizeFile(cache->dbfile);
 
-        /* Now that we've cached a group, turn caching back on. */
-        use_PJgroup_cache = 1;
+        /* Make it the most recently used and trim the least recently used */
+        e->next = cache->head;
+        if (cache->head)
+            cache->head->prev = e;
+        else
+            cache->tail = e;
+        cache->head = e;
+        cache->n++;
+        cached_group = e->group;
+
+        if (maxn < 1)
+            maxn = 1;
+        while (cache->n > maxn)
+        {
+            pj_cache_free(cache, cache->tail);
+            cache->evictions++;
+        }
+    }
+    else
+    {
+        cached_group = uncached_group;
     }
 
-    /* Check object type */
+    /* Check object type before we do any allocations */
     if (expected_dbtype > 0)
     {
         int matched = 1;
@@ -685,10 +809,14 @@ PJ_GetObject(PDBfile *file_in, char const *objname_in, PJcomplist *tobj, int exp
         if (!matched)
         {
             char error[256];
-            FREE(varname);
-            FREE(filename);
             sprintf(error,"Requested %s object \"%s\" is not a %s.",
                 cached_group->type, objname_in, DBGetObjtypeName(expected_dbtype));
+            FREE(varname);
+            if (filename != NULL)
+            {
+                FREE(filename);
+                lite_PD_close(file);
+            }
             db_perror(error, E_NOTFOUND, me);
             return -1;
         }
@@ -736,7 +864,9 @@ PJ_GetObject(PDBfile *file_in, char const *objname_in, PJcomplist *tobj, int exp
 /*----------------------------------------------------------------------
  * Function:                                             PJ_ClearCache
  *
- * Purpose:     Frees up the storage associated with the cache.
+ * Purpose:     Frees up the storage associated with a file's object
+ *              cache and forgets the cache. Called when the file is
+ *              closed.
  *
  * Programmer:  Sean Ahern, Mon Nov 23 17:19:17 PST 1998
  *
@@ -748,26 +878,24 @@ PJ_GetObject(PDBfile *file_in, char const *objname_in, PJcomplist *tobj, int exp
  *    Brad Whitlock, Thu Jan 20 15:32:27 PST 2000
  *    Added the void to the argument list to preserve the prototype.
  *
+ *    Takes the file whose cache is to be freed now that there is one
+ *    cache per file.
  *--------------------------------------------------------------------*/
 INTERNAL int
-PJ_ClearCache(void)
+PJ_ClearCache(PDBfile *file)
 {
-    int error;
-    static char *me = "PJ_ClearCache";
+    pj_cache_t *c, **pc;
 
-    /* Free up the old group. */
-    if (cached_group)
-    {
-        error = !PJ_rel_group(cached_group);
-        if (error)
-        {
-            db_perror("PJ_rel_group", E_CALLFAIL, me);
-            return -1;
-        }
-        cached_group = NULL;
-    }
-    FREE(cached_obj_name);
-    FREE(cached_file_name);
+    for (pc = &pj_caches; *pc != NULL; pc = &(*pc)->next)
+        if ((*pc)->pdb == file)
+            break;
+    if ((c = *pc) == NULL)
+        return 0;
+
+    while (c->head)
+        pj_cache_free(c, c->head);
+    *pc = c->next;
+    FREE(c);
 
     return 0;
 }
@@ -832,6 +960,9 @@ PJ_GetComponent (PDBfile *file, char const *objname, char const *compname) {
  *    Mark C. Miller, Thu Aug 24 22:41:23 PDT 2023
  *    Add use_PJcache_group==0 to conditions controlling whether a new
  *    call to PJ_GetObject is made.
+ *
+ *    Always go through PJ_GetObject, asking for no components, so the
+ *    group comes from the object cache without reading any data.
  *--------------------------------------------------------------------
  */
 INTERNAL int
@@ -839,30 +970,18 @@ PJ_GetComponentType (PDBfile *file, char const *objname, char const *compname)
 {
    int  retval = DB_NOTYPE;
    char *me = "PJ_GetComponentType";
-   PJcomplist    *_tcl;
-
-   /* If there is no cached group, or we are interested in a
-    * different object, get the one we want.  */
-   if(use_PJgroup_cache == 0 || cached_group == NULL || cached_obj_name == NULL ||
-      (!STR_EQUAL(cached_obj_name, objname)))
-   {
-       char       *result = NULL;
-       PJcomplist tmp_obj;
-
-       /* Read just the requested component of the given object */
-       INIT_OBJ(&tmp_obj);
-       DEFALL_OBJ(compname, &result, DB_NOTYPE);
+   PJcomplist tmp_obj;
+   PJcomplist *_tcl;
 
-       if (PJ_GetObject(file, objname, &tmp_obj, 0) < 0) {
-          db_perror("PJ_GetObject", E_CALLFAIL, me);
-          return DB_NOTYPE;
-       }
-       FREE(result);
+   INIT_OBJ(&tmp_obj);
+   if (PJ_GetObject(file, objname, &tmp_obj, 0) < 0) {
+      db_perror("PJ_GetObject", E_CALLFAIL, me);
+      return DB_NOTYPE;
    }
 
    /* If there is now cached group information (and there should be)
     * then look for the component in the group and determine its type.  */
-   if(use_PJgroup_cache && cached_group)
+   if(cached_group)
    {
        int i, index, found = 0;
 
@@ -1702,6 +1821,7 @@ PJ_put_group (
     *  Build an absolute pathname.
     *---------------------------------------*/
    PJ_get_fullpath(lite_PD_pwd(file), group->name, name);
+   PJ_ForgetObject(file, name);
 
    /*----------------------------------------
     *  Make sure this group description hasn't
@@ -1975,6 +2095,7 @@ db_pdb_InitCallbacks ( DBfile *dbfile )
     dbfile->pub.free_z = db_pdb_FreeCompressionResources;
 
     dbfile->pub.sort_obo = db_pdb_SortObjectsByOffset;
+    dbfile->pub.g_iostats = db_pdb_GetIOStats;
 }
 
 /*-------------------------------------------------------------------------
@@ -2005,6 +2126,8 @@ db_pdb_InitCallbacks ( DBfile *dbfile )
  *
  *    Sean Ahern, Mon Nov 23 17:29:17 PST 1998
  *    Added clearing of the object cache when the file is closed.
+ *
+ *    The object cache is per file now; free this file's before closing.
  *-------------------------------------------------------------------------*/
 SILO_CALLBACK int
 db_pdb_close(DBfile *_dbfile)
@@ -2013,26 +2136,49 @@ db_pdb_close(DBfile *_dbfile)
 
    if (dbfile)
    {
+      /* Free this file's object cache. */
+      PJ_ClearCache(dbfile->pdb);
+
       /*
        * Free the private parts of the file.
        */
       lite_PD_close(dbfile->pdb);
       dbfile->pdb = NULL;
 
-      /* We've closed a file, so we can't cache PJgroups any more */
-      PJ_NoCache();
-
       /*
        * Free the public parts of the file.
        */
       silo_db_close(_dbfile);
-
-      /* Clear the current object cache. */
-      PJ_ClearCache();
    }
    return 0;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    db_pdb_GetIOStats
+ *
+ * Purpose:     Returns the counters of this file's object cache. The
+ *              PDB driver keeps no other I/O counters.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        never fails
+ *-------------------------------------------------------------------------
+ */
+SILO_CALLBACK int
+db_pdb_GetIOStats(DBfile *_dbfile, DBiostats *stats)
+{
+    DBfile_pdb    *dbfile = (DBfile_pdb *) _dbfile;
+    pj_cache_t    *c = pj_cache_find(dbfile->pdb);
+
+    if (c)
+    {
+        stats->object_hits      = c->hits;
+        stats->object_misses    = c->misses;
+        stats->object_evictions = c->evictions;
+    }
+    return 0;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    db_pdb_flush
  *
@@ -2058,6 +2204,48 @@ db_pdb_flush(DBfile *_dbfile)
    return retval;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    db_pdb_set_io_options
+ *
+ * Purpose:     Set up how the PDB library accesses the next file it opens
+ *              or creates from the DBOPT_PDB_IO and DBOPT_PDB_BUFFER_SIZE
+ *              options of a registered file options set. Any other
+ *              options set id, e.g. 0, restores the defaults.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1, bad options set id
+ *-------------------------------------------------------------------------*/
+PRIVATE int
+db_pdb_set_io_options(int opts_set_id)
+{
+#ifndef USING_PDB_PROPER
+    static char    *me = "db_pdb_set_io_options";
+    int             io = DB_PDB_IO_STDIO;
+    int             bufsize = DB_PDB_DEFAULT_BUFFER_SIZE;
+
+    if (opts_set_id > DB_FILE_OPTS_LAST)
+    {
+        int _opts_set_id = opts_set_id - NUM_DEFAULT_FILE_OPTIONS_SETS;
+        DBoptlist const *opts;
+        void *p;
+
+        if (_opts_set_id >= MAX_FILE_OPTIONS_SETS ||
+            (opts = SILO_Globals.fileOptionsSets[_opts_set_id]) == 0)
+            return db_perror("Bad file options set index", E_CALLFAIL, me);
+
+        if ((p = DBGetOption(opts, DBOPT_PDB_IO)))
+            io = *((int*) p);
+        if ((p = DBGetOption(opts, DBOPT_PDB_BUFFER_SIZE)))
+            bufsize = *((int*) p);
+    }
+
+    lite_PD_set_buffer_size(io == DB_PDB_IO_BUFFERED && bufsize > 0 ? bufsize : -1);
+    lite_PD_set_io_mode(io == DB_PDB_IO_MMAP ? PD_IO_MMAP : PD_IO_STDIO);
+#endif
+    return 0;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    db_pdb_Open
  *
@@ -2095,6 +2283,8 @@ db_pdb_flush(DBfile *_dbfile)
  *
  *    Mark C. Miller, Wed Feb 25 09:37:48 PST 2009
  *    Changed error code for failure to open to E_DRVRCANTOPEN
+ *
+ *    Apply the I/O options of the file options set, if any.
  *-------------------------------------------------------------------------*/
 INTERNAL DBfile *
 db_pdb_Open(char const *name, int mode, int opts_set_id)
@@ -2112,25 +2302,31 @@ db_pdb_Open(char const *name, int mode, int opts_set_id)
         db_perror("not readable", E_NOFILE, me);
         return NULL;
     }
+    if (db_pdb_set_io_options(opts_set_id) < 0)
+        return NULL;
     if (mode == DB_READ)
     {
-        if (NULL == (pdb = lite_PD_open((char*)name, "r")))
-        {
-            db_perror(NULL, E_DRVRCANTOPEN, me);
-            return NULL;
-        }
+        /* Index the symbol table at open and parse entries on lookup */
+#ifdef USING_PDB_PROPER
+        pdb = lite_PD_open((char*)name, "r");
+#else
+        pdb = lite_PD_open((char*)name, "rd");
+#endif
     } else if (mode == DB_APPEND)
     {
-        if (NULL == (pdb = lite_PD_open((char*)name, "a")))
-        {
-            db_perror(NULL, E_DRVRCANTOPEN, me);
-            return NULL;
-        }
+        pdb = lite_PD_open((char*)name, "a");
     } else
     {
+        db_pdb_set_io_options(0);
         db_perror("mode", E_INTERNAL, me);
         return (NULL);
     }
+    db_pdb_set_io_options(0);
+    if (NULL == pdb)
+    {
+        db_perror(NULL, E_DRVRCANTOPEN, me);
+        return NULL;
+    }
 
     /*
      * If it is the netcdf flavor of pdb, then return NULL.
@@ -2155,6 +2351,7 @@ db_pdb_Open(char const *name, int mode, int opts_set_id)
 #endif
     dbfile->pdb = pdb;
     db_pdb_InitCallbacks((DBfile *) dbfile);
+    PJ_OpenCache(pdb, (DBfile *) dbfile);
     return (DBfile *) dbfile;
 }
 
@@ -2198,6 +2395,8 @@ db_pdb_Open(char const *name, int mode, int opts_set_id)
  *
  *    Thomas R. Treadway, Wed Feb 28 11:36:34 PST 2007
  *    Checked for compression option.
+ *
+ *    Apply the I/O options of the file options set, if any.
  *-------------------------------------------------------------------------*/
 /* ARGSUSED */
 INTERNAL DBfile *
@@ -2260,7 +2459,15 @@ db_pdb_Create (char const *name, int mode, int target, int opts_set_id, char con
 #endif
     db_pdb_InitCallbacks((DBfile *) dbfile);
 
-    if (NULL == (dbfile->pdb = lite_PD_open((char*)name, "w")))
+    if (db_pdb_set_io_options(opts_set_id) < 0)
+    {
+        FREE(dbfile->pub.name);
+        FREE(dbfile);
+        return NULL;
+    }
+    dbfile->pdb = lite_PD_open((char*)name, "w");
+    db_pdb_set_io_options(0);
+    if (NULL == dbfile->pdb)
     {
         FREE(dbfile->pub.name);
         FREE(dbfile);
@@ -2270,6 +2477,7 @@ db_pdb_Create (char const *name, int mode, int target, int opts_set_id, char con
 #ifdef USING_PDB_PROPER
     PD_set_track_pointers(dbfile->pdb, FALSE);
 #endif
+    PJ_OpenCache(dbfile->pdb, (DBfile *) dbfile);
     DBNewToc((DBfile *) dbfile);
     if (finfo)
     {
@@ -6942,9 +7150,6 @@ db_pdb_SetDir (DBfile *_dbfile, char const *path)
    if (1 == lite_PD_cd(dbfile->pdb, (char*) path)) {
       dbfile->pub.dirid = 0;
 
-      /* We've changed directories, so we can't cache PJgroups any more */
-      PJ_NoCache();
-
       /* Must make new table-of-contents since dir has changed */
       db_FreeToc(_dbfile);
    }
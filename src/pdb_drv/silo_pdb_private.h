@@ -105,6 +105,7 @@ typedef struct {
 #ifndef SILO_NO_CALLBACKS
 SILO_CALLBACK int db_pdb_close (DBfile *);
 SILO_CALLBACK int db_pdb_flush (DBfile *);
+SILO_CALLBACK int db_pdb_GetIOStats (DBfile *, DBiostats *);
 SILO_CALLBACK int db_pdb_InqVarExists (DBfile *, char const *);
 SILO_CALLBACK void *db_pdb_GetComponent (DBfile *, char const *, char const *);
 SILO_CALLBACK int db_pdb_GetComponentType (DBfile *, char const *, char const *);
@@ -157,6 +158,7 @@ SILO_CALLBACK int db_pdb_GetComponentNames (DBfile *, char const *, char ***, ch
 SILO_CALLBACK int db_pdb_FreeCompressionResources(DBfile *_dbfile, char const *meshname);
 
 PRIVATE int db_pdb_getobjinfo (PDBfile *, char const *, char *, int *);
+PRIVATE int db_pdb_set_io_options (int);
 PRIVATE int db_pdb_getvarinfo (PDBfile *, char const *, char *, int *, int *, int);
 
 #ifdef PDB_WRITE
@@ -326,6 +328,7 @@ PRIVATE void db_InitDefvars (DBoptlist const *);
  *-------------------------------------------------------------------------
  */
 #define MAXNAME         256
+#define DB_PDB_DEFAULT_BUFFER_SIZE (1<<20) /* for DB_PDB_IO_BUFFERED */
 #define INIT_OBJ(A)     (_tcl=(A),_tcl->num=0)
 #define DEFINE_OBJ(NM,PP,TYP) DEF_OBJ(NM,PP,TYP,1)
 #define DEFALL_OBJ(NM,PP,TYP) DEF_OBJ(NM,PP,TYP,0)
@@ -352,9 +355,10 @@ PRIVATE int pdb_getvarinfo (PDBfile *, char *, char *, int *, int *, int);
 
 PRIVATE int PJ_ForceSingle (int);
 PRIVATE int PJ_GetObject (PDBfile *, char const *, PJcomplist *, int expected_dbtype);
-PRIVATE int PJ_ClearCache(void);
+PRIVATE int PJ_ClearCache(PDBfile *);
 PRIVATE int PJ_InqForceSingle (void);
-PRIVATE void PJ_NoCache ( void );
+PRIVATE void PJ_OpenCache(PDBfile *, DBfile *);
+PRIVATE void PJ_ForgetObject(PDBfile *, char const *);
 PRIVATE void *PJ_GetComponent (PDBfile *, char const *, char const *);
 PRIVATE int PJ_GetComponentType (PDBfile *, char const *, char const *);
 PRIVATE int PJ_ReadVariable (PDBfile *, char *, int, int, char **);
@@ -162,6 +162,81 @@ lite_SC_hash (char *s, int size) {
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:	_lite_SC_place
+ *
+ * Purpose:	Put the element NP into TAB without looking for an entry
+ *		of the same name. Tables with more than one slot use open
+ *		addressing with linear probing and hold one element per
+ *		slot. A table of size one stays a single list, newest
+ *		entry first, which the PDB structure charts depend on.
+ *
+ * Return:	void
+ *-------------------------------------------------------------------------
+ */
+static void
+_lite_SC_place (hashel *np, HASHTAB *tab) {
+
+   hashel **tb;
+   int i, sz;
+
+   sz = tab->size;
+   tb = tab->table;
+   i  = lite_SC_hash(np->name, sz);
+   if (sz > 1) {
+      while (tb[i] != NULL) {
+         if (++i == sz) i = 0;
+      }
+      np->next = NULL;
+   } else {
+      np->next = tb[i];
+   }
+
+   tb[i] = np;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	_lite_SC_grow
+ *
+ * Purpose:	Roughly double the number of slots in TAB, or more if it
+ *		is still over half full, and re-place its elements. The
+ *		hashels themselves do not move so pointers to them stay
+ *		valid.
+ *
+ * Return:	Success:	TRUE
+ *
+ *		Failure:	FALSE
+ *-------------------------------------------------------------------------
+ */
+static int
+_lite_SC_grow (HASHTAB *tab) {
+
+   hashel **otb, **tb, *np, *nxt;
+   int i, osz, sz;
+
+   osz = tab->size;
+   otb = tab->table;
+   sz  = 2*osz + 1;
+   while (2*(tab->nelements + 1) > sz) sz = 2*sz + 1;
+   tb  = FMAKE_N(hashel *, sz, "SC_GROW:tb");
+   if (tb == NULL) return(FALSE);
+   for (i = 0; i < sz; i++) tb[i] = NULL;
+
+   tab->size  = sz;
+   tab->table = tb;
+   for (i = 0; i < osz; i++) {
+      for (np = otb[i]; np != NULL; np = nxt) {
+         nxt = np->next;
+         _lite_SC_place(np, tab);
+      }
+   }
+
+   SFREE(otb);
+   return(TRUE);
+}
+
+
 /*-------------------------------------------------------------------------
  * Function:	lite_SC_lookup
  *
@@ -184,12 +259,23 @@ lite_SC_lookup (char *s, HASHTAB *tab) {
    hashel *np, **tb;
    int sz;
 
+   int i, n;
+
    if (tab == NULL) return(NULL);
 
+   /*
+    * Probe from the home slot up to the first empty one. Each slot is
+    * also walked as a chain so tables read from older files, where
+    * collisions were chained in the home slot, are still found.
+    */
    sz = tab->size;
    tb = tab->table;
-   for (np = tb[lite_SC_hash(s, sz)]; np != NULL; np = np->next) {
-      if (strcmp(s, np->name) == 0) return(np); /* found it */
+   i  = lite_SC_hash(s, sz);
+   for (n = 0; (n < sz) && (tb[i] != NULL); n++) {
+      for (np = tb[i]; np != NULL; np = np->next) {
+         if (strcmp(s, np->name) == 0) return(np); /* found it */
+      }
+      if (++i == sz) i = 0;
    }
 
    return(NULL); /* not found */
@@ -278,26 +364,25 @@ lite_SC_install (char *name, lite_SC_byte *obj, char *type, HASHTAB *tab) {
 hashel *
 _lite_SC_install (char *name, lite_SC_byte *obj, char *type, HASHTAB *tab) {
 
-   hashel *np, **tb;
-   int hashval, sz;
+   hashel *np;
 
-   sz = tab->size;
-   tb = tab->table;
    np = lite_SC_lookup(name, tab);
 
    /*
-    * If not found install it.
+    * If not found install it, first growing the table if that would
+    * leave it more than half full.
     */
    if (np == NULL) {
+      if ((tab->size > 1) && (2*(tab->nelements + 1) > tab->size) &&
+          !_lite_SC_grow(tab)) return(NULL);
+
       np = FMAKE(hashel, "SC_INSTALL:np");
       if (np == NULL) return(NULL);
 
       np->name = lite_SC_strsavef(name, "char*:SC_INSTALL:name");
       if (np->name == NULL) return(NULL);
 
-      hashval     = lite_SC_hash(np->name, sz);
-      np->next    = tb[hashval];
-      tb[hashval] = np;
+      _lite_SC_place(np, tab);
       (tab->nelements)++;
    }
 
@@ -327,53 +412,65 @@ _lite_SC_install (char *name, lite_SC_byte *obj, char *type, HASHTAB *tab) {
 int
 lite_SC_hash_rem (char *name, HASHTAB *tab) {
 
-   hashel *np, *nxt, **tb;
-   int sz, i;
+   hashel *np, *prev, *nxt, **tb;
+   int sz, i, n;
 
    sz = tab->size;
    tb = tab->table;
    i  = lite_SC_hash(name, sz);
-   np = tb[i];
+
+   /*
+    * Find the slot and chain predecessor of the entry.
+    */
+   np = NULL;
+   for (n = 0; (n < sz) && (tb[i] != NULL); n++) {
+      for (prev = NULL, np = tb[i]; np != NULL; prev = np, np = np->next) {
+         if (strcmp(name, np->name) == 0) break;
+      }
+      if (np != NULL) break;
+      if (++i == sz) i = 0;
+   }
 
    /*
     * If not found nothing else to do.
     */
-   if (np == NULL) {
-      return(FALSE);
-   } else {
-      if (strcmp(name, np->name) == 0) {
-	 tb[i] = np->next;
+   if (np == NULL) return(FALSE);
 
-	 /*
-	  * Undo the MARK in SC_install.
-	  */
-	 SFREE(np->def);
-	 SFREE(np->name);
-	 SFREE(np);
-	 (tab->nelements)--;
-	 return(TRUE);
+   if (prev == NULL) tb[i] = np->next;
+   else prev->next = np->next;
 
-      } else {
-	 /*
-	  * Otherwise search for it.
-	  */
-	 for (; np->next != NULL; np = np->next) {
-	    nxt = np->next;
-	    if (strcmp(name, nxt->name) == 0) {
-	       np->next = nxt->next;
-	       SFREE(nxt->def);
-	       SFREE(nxt->name);
-	       SFREE(nxt);
-	       (tab->nelements)--;
-	       return(TRUE);
-	    }
-	 }
+   /*
+    * Undo the MARK in SC_install.
+    */
+   SFREE(np->def);
+   SFREE(np->name);
+   SFREE(np);
+   (tab->nelements)--;
+
+   /*
+    * An emptied slot may split a probe sequence so re-place the rest
+    * of the cluster which follows it. A table read from an older file
+    * may still be chained and too full for that, in which case it is
+    * re-placed whole.
+    */
+   if ((sz > 1) && (tb[i] == NULL)) {
+      if (2*tab->nelements > sz) return(_lite_SC_grow(tab));
+      if (++i == sz) i = 0;
+      while (tb[i] != NULL) {
+         np    = tb[i];
+         tb[i] = NULL;
+         for (/*void*/; np != NULL; np = nxt) {
+            nxt = np->next;
+            _lite_SC_place(np, tab);
+         }
+         if (++i == sz) i = 0;
       }
    }
-   return(FALSE);
-}
 
+   return(TRUE);
+}
 
+
 /*-------------------------------------------------------------------------
  * Function:	lite_SC_hash_clr
  *
@@ -415,7 +512,9 @@ lite_SC_hash_clr (HASHTAB *tab) {
 /*-------------------------------------------------------------------------
  * Function:	lite_SC_make_hash_table
  *
- * Purpose:	Allocate and initialize a hash table of size SZ.
+ * Purpose:	Allocate and initialize a hash table of size SZ. A table
+ *		of more than one slot grows as entries are installed so
+ *		SZ is only its initial size.
  *
  * Return:	Success:	HASHTAB pointer
  *
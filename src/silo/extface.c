@@ -53,28 +53,80 @@ be used for advertising or product endorsement purposes.
 */
 
 #include "silo_private.h"
+#include <limits.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
 
 /*
- * Maximum size of the hash table.  This should be a prime number.  This
- * was pulled off the web from
- *    http://www.utm.edu/research/primes/notes/10000.txti 
+ * External faces are found by inserting every face of every zone into
+ * a hash table of faces. When a face is inserted that matches one
+ * already in the table (same nodes, opposite orientation), the two
+ * cancel and the existing face is removed. What remains are the
+ * external faces.
+ *
+ * The table uses open addressing with linear probing and tombstones
+ * and grows as needed. Faces live in a single arena (the `faces' array
+ * of the table) and removed faces are recycled through a free list so
+ * the arena's size is bounded by the peak number of faces live in the
+ * table, not the total number inserted. The nodes of faces with more
+ * than FACE_INLINE_NODES nodes (polyhedral faces) are kept in a
+ * separate node arena. A face's home slot is determined by its
+ * smallest node number (FACE_SLOT), with room for a few faces per
+ * node, so zones near each other in a well ordered mesh probe nearby
+ * slots.
+ *
+ * Zones may optionally be partitioned among several threads (see
+ * DBSetExternalFacelistThreads). Each thread builds a table for its
+ * own range of zones. The faces surviving in each are then merged into
+ * a final table where faces on partition boundaries cancel.
+ *
+ * The resulting faces are returned in the order of the chained hash
+ * table of MIN(nNodes,HASH_MAX) buckets used by earlier versions:
+ * by bucket (smallest node modulo the number of buckets) and, within
+ * a bucket, most recently inserted first. That order depends only on
+ * the faces that survive, so the answer is the same however it was
+ * computed.
  */
 #define HASH_MAX 100003
+#define FACE_INLINE_NODES 4
+#define SLOT_EMPTY       -1
+#define SLOT_TOMB        -2
+#define FACE_SLOT(n)     ((unsigned) (n) << 3)
+
+/* Minimum number of zones per thread worth starting a thread for */
+#define MIN_ZONES_PER_THREAD 10000
 
 #define MALLOC_N(T,N)            ((T*)malloc((size_t)((N)*sizeof(T))))
 
 typedef struct Face
 {
     int       nNodes;           /* The number of nodes in the face. */
-    int       *nodes;           /* The nodes making up the face. */
     int       zoneNo;           /* The zone number associated with the face. */
-    struct Face *next;          /* Pointer to another face. */
+    int       faceNo;           /* The face's index within its zone. */
+    unsigned  hash;             /* Orientation independent hash of nodes. */
+    int       next;             /* Next face in the free list. */
+    union {
+        int    nodes[FACE_INLINE_NODES]; /* The nodes making up the face,
+                                           starting with the smallest. */
+        size_t offset;          /* For larger faces, the offset of the
+                                   nodes in the node arena. */
+    } u;
 } Face;
 
 typedef struct FaceHash
 {
-    Face      **table;          /* The hash table. */
-    int       size;             /* The size of the hash table. */
+    int       *table;           /* The hash table of face indices. */
+    unsigned  size;             /* The size of the hash table (power of 2). */
+    int       nLive;            /* Number of live faces in the table. */
+    int       nTomb;            /* Number of tombstones in the table. */
+    Face      *faces;           /* Face arena. */
+    int       nFaces;           /* High water mark of face arena. */
+    int       maxFaces;         /* Allocated size of face arena. */
+    int       freeFace;         /* Head of free list of faces. */
+    int       *nodes;           /* Node arena for large faces. */
+    size_t    nNodes;           /* Used size of node arena. */
+    size_t    maxNodes;         /* Allocated size of node arena. */
 } FaceHash;
 
 typedef struct CalcExternalFacesState
@@ -90,17 +142,51 @@ typedef struct CalcExternalFacesState
     int       nShapes;
     int       *matList;
     int       bndMethod;
-    FaceHash  faceHash;
 } CalcExternalFacesState;
 
-PRIVATE Face *AllocFace(void);
+/*
+ * A position in the zonelist: the shape, the zone within that
+ * shape, the global zone number and the offset into the zonelist.
+ */
+typedef struct ZoneCursor
+{
+    int       iShape;
+    int       j;
+    int       iZone;
+    int       iZoneList;
+} ZoneCursor;
+
+typedef struct ZoneRange
+{
+    CalcExternalFacesState *st;
+    ZoneCursor start;
+    int       nZones;
+    FaceHash  faceHash;
+} ZoneRange;
+
 PRIVATE DBfacelist *CalcExternalFaces(int *zoneList, int nNodes,
     int lowOffset, int highOffset, int origin, int *shapeType, int *shapeSize,
     int *shapeCnt, int nShapes, int *matList, int bndMethod);
-PRIVATE DBfacelist *FormFaceList(CalcExternalFacesState *st);
-PRIVATE void FreeFace(Face *face);
-PRIVATE void InsertFace(CalcExternalFacesState *st, int *nodes, int nNodes,
-    int zoneNo);
+PRIVATE DBfacelist *FormFaceList(CalcExternalFacesState *st, FaceHash *faceHash);
+PRIVATE void InsertFace(CalcExternalFacesState *st, FaceHash *faceHash,
+    int const *nodes, int nNodes, int zoneNo, int faceNo);
+PRIVATE int InsertZone(CalcExternalFacesState *st, FaceHash *faceHash,
+    int iShape, int const *zoneNodes, int zoneNo);
+PRIVATE int ZoneLength(CalcExternalFacesState *st, int iShape,
+    int const *zoneNodes);
+PRIVATE void RehashFaceHash(FaceHash *faceHash, unsigned size);
+PRIVATE int *FaceNodes(FaceHash *faceHash, Face *face);
+PRIVATE int *SortedFaces(FaceHash *faceHash, int minIndex, int maxIndex,
+    int nBuckets, int *nFaces);
+#ifdef HAVE_PTHREAD
+PRIVATE void *InsertZoneRange(void *arg);
+PRIVATE void MergeFaceHash(CalcExternalFacesState *st, FaceHash *dst,
+    FaceHash *src);
+#endif
+PRIVATE void InitFaceHash(FaceHash *faceHash, int sizeHint);
+PRIVATE void FreeFaceHash(FaceHash *faceHash);
+PRIVATE void InsertZones(CalcExternalFacesState *st, FaceHash *faceHash,
+    ZoneCursor *cur, int nZones);
 
 /***********************************************************************
  *
@@ -217,6 +303,52 @@ DBCalcExternalFacelist2(int *nodeList, int nNodes, int lowOffset,
     return fl;
 }
 
+/***********************************************************************
+ *
+ * Purpose:  Set/get the number of threads DBCalcExternalFacelist and
+ *           DBCalcExternalFacelist2 may use. The default is 1. Values
+ *           less than 1 are treated as 1. Builds without POSIX threads
+ *           always use 1.
+ *
+ * Return:   The previous (Set) or current (Get) number of threads.
+ *
+ **********************************************************************/
+
+PUBLIC int
+DBSetExternalFacelistThreads(int nthreads)
+{
+    int old = SILO_Globals.extfaceThreads;
+    SILO_Globals.extfaceThreads = nthreads < 1 ? 1 : nthreads;
+    return old;
+}
+
+PUBLIC int
+DBGetExternalFacelistThreads(void)
+{
+    return SILO_Globals.extfaceThreads;
+}
+
+/*
+ * The faces of the fixed shape zone types. Each entry is the number of
+ * nodes in the face followed by the indices of the face's nodes within
+ * the zone.
+ */
+static int const tetFaces[4][5] = {
+    {3, 0, 1, 2},    {3, 0, 2, 3},    {3, 0, 3, 1},    {3, 1, 3, 2}
+};
+static int const pyramidFaces[5][5] = {
+    {4, 0, 1, 2, 3}, {3, 0, 4, 1},    {3, 1, 4, 2},    {3, 2, 4, 3},
+    {3, 3, 4, 0}
+};
+static int const prismFaces[5][5] = {
+    {4, 0, 1, 2, 3}, {4, 3, 2, 5, 4}, {4, 4, 5, 1, 0}, {3, 3, 4, 0},
+    {3, 1, 5, 2}
+};
+static int const hexFaces[6][5] = {
+    {4, 0, 3, 2, 1}, {4, 1, 2, 6, 5}, {4, 5, 6, 7, 4}, {4, 4, 7, 3, 0},
+    {4, 0, 1, 5, 4}, {4, 3, 7, 6, 2}
+};
+
 /***********************************************************************
  *
  * Purpose:  Given a zonelist, calculate a facelist describing all of
@@ -269,12 +401,12 @@ CalcExternalFaces(int *zoneList, int nNodes, int lowOffset, int highOffset,
                   int origin, int *shapeType, int *shapeSize, int *shapeCnt,
                   int nShapes, int *matList, int bndMethod)
 {
-    int       i, j, k;
+    int       i;
     CalcExternalFacesState st;
-    int       nFaces;
-    int       nEdges;
-    int       iZone, iZoneList;
-    int       nodes[4];
+    int       nZones;
+    int       nThreads;
+    ZoneCursor cur;
+    FaceHash  faceHash;
     DBfacelist *faceList=NULL;
 
     /*
@@ -293,205 +425,381 @@ CalcExternalFaces(int *zoneList, int nNodes, int lowOffset, int highOffset,
     st.matList    = matList;
     st.bndMethod  = bndMethod;
 
-    st.faceHash.size  = MIN(nNodes, HASH_MAX);
-    st.faceHash.table = MALLOC_N(Face *, st.faceHash.size);
-    memset(st.faceHash.table, 0, st.faceHash.size * sizeof(Face *));
+    nZones = 0;
+    for (i = 0; i < nShapes; i++) nZones += shapeCnt[i];
 
-    /*
-     * Loop over all the shapes, adding the faces for each shape,
-     * removing duplicates as they are encountered.
-     */
-    iZone = 0;
-    iZoneList = 0;
-    for (i = 0; i < nShapes; i++)
+    nThreads = SILO_Globals.extfaceThreads;
+    if (nThreads > nZones / MIN_ZONES_PER_THREAD)
+        nThreads = nZones / MIN_ZONES_PER_THREAD;
+
+#ifdef HAVE_PTHREAD
+    if (nThreads > 1)
     {
-        switch (shapeType[i])
+        ZoneRange *ranges = MALLOC_N(ZoneRange, nThreads);
+        pthread_t *threads = MALLOC_N(pthread_t, nThreads);
+        int       *started = MALLOC_N(int, nThreads);
+        int        t;
+
+        /*
+         * Divide the zones into contiguous ranges, one per thread,
+         * and find where in the zonelist each range starts.
+         */
+        cur.iShape = 0;
+        cur.j = 0;
+        cur.iZone = 0;
+        cur.iZoneList = 0;
+        for (t = 0; t < nThreads; t++)
         {
-            case DB_ZONETYPE_QUAD_TET:
-            case DB_ZONETYPE_TET:
-                for (j = 0; j < shapeCnt[i]; j++)
-                {
-                    nodes[0] = zoneList[iZoneList+0];
-                    nodes[1] = zoneList[iZoneList+1];
-                    nodes[2] = zoneList[iZoneList+2];
-                    InsertFace(&st, nodes, 3, iZone);
-                    nodes[0] = zoneList[iZoneList+0];
-                    nodes[1] = zoneList[iZoneList+2];
-                    nodes[2] = zoneList[iZoneList+3];
-                    InsertFace(&st, nodes, 3, iZone);
-                    nodes[0] = zoneList[iZoneList+0];
-                    nodes[1] = zoneList[iZoneList+3];
-                    nodes[2] = zoneList[iZoneList+1];
-                    InsertFace(&st, nodes, 3, iZone);
-                    nodes[0] = zoneList[iZoneList+1];
-                    nodes[1] = zoneList[iZoneList+3];
-                    nodes[2] = zoneList[iZoneList+2];
-                    InsertFace(&st, nodes, 3, iZone);
-                    iZone++;
-                    iZoneList += 4;
-                }
-                break;
-            case DB_ZONETYPE_QUAD_PYRAMID:
-            case DB_ZONETYPE_PYRAMID:
-                for (j = 0; j < shapeCnt[i]; j++)
-                {
-                    nodes[0] = zoneList[iZoneList+0];
-                    nodes[1] = zoneList[iZoneList+1];
-                    nodes[2] = zoneList[iZoneList+2];
-                    nodes[3] = zoneList[iZoneList+3];
-                    InsertFace(&st, nodes, 4, iZone);
-                    nodes[0] = zoneList[iZoneList+0];
-                    nodes[1] = zoneList[iZoneList+4];
-                    nodes[2] = zoneList[iZoneList+1];
-                    InsertFace(&st, nodes, 3, iZone);
-                    nodes[0] = zoneList[iZoneList+1];
-                    nodes[1] = zoneList[iZoneList+4];
-                    nodes[2] = zoneList[iZoneList+2];
-                    InsertFace(&st, nodes, 3, iZone);
-                    nodes[0] = zoneList[iZoneList+2];
-                    nodes[1] = zoneList[iZoneList+4];
-                    nodes[2] = zoneList[iZoneList+3];
-                    InsertFace(&st, nodes, 3, iZone);
-                    nodes[0] = zoneList[iZoneList+3];
-                    nodes[1] = zoneList[iZoneList+4];
-                    nodes[2] = zoneList[iZoneList+0];
-                    InsertFace(&st, nodes, 3, iZone);
-                    iZone++;
-                    iZoneList += 5;
-                }
-                break;
-            case DB_ZONETYPE_QUAD_PRISM:
-            case DB_ZONETYPE_PRISM:
-                for (j = 0; j < shapeCnt[i]; j++)
-                {
-                    nodes[0] = zoneList[iZoneList+0];
-                    nodes[1] = zoneList[iZoneList+1];
-                    nodes[2] = zoneList[iZoneList+2];
-                    nodes[3] = zoneList[iZoneList+3];
-                    InsertFace(&st, nodes, 4, iZone);
-                    nodes[0] = zoneList[iZoneList+3];
-                    nodes[1] = zoneList[iZoneList+2];
-                    nodes[2] = zoneList[iZoneList+5];
-                    nodes[3] = zoneList[iZoneList+4];
-                    InsertFace(&st, nodes, 4, iZone);
-                    nodes[0] = zoneList[iZoneList+4];
-                    nodes[1] = zoneList[iZoneList+5];
-                    nodes[2] = zoneList[iZoneList+1];
-                    nodes[3] = zoneList[iZoneList+0];
-                    InsertFace(&st, nodes, 4, iZone);
-                    nodes[0] = zoneList[iZoneList+3];
-                    nodes[1] = zoneList[iZoneList+4];
-                    nodes[2] = zoneList[iZoneList+0];
-                    InsertFace(&st, nodes, 3, iZone);
-                    nodes[0] = zoneList[iZoneList+1];
-                    nodes[1] = zoneList[iZoneList+5];
-                    nodes[2] = zoneList[iZoneList+2];
-                    InsertFace(&st, nodes, 3, iZone);
-                    iZone++;
-                    iZoneList += 6;
-                }
-                break;
-            case DB_ZONETYPE_QUAD_HEX:
-            case DB_ZONETYPE_HEX:
-                for (j = 0; j < shapeCnt[i]; j++)
-                {
-                    nodes[0] = zoneList[iZoneList+0];
-                    nodes[1] = zoneList[iZoneList+3];
-                    nodes[2] = zoneList[iZoneList+2];
-                    nodes[3] = zoneList[iZoneList+1];
-                    InsertFace(&st, nodes, 4, iZone);
-                    nodes[0] = zoneList[iZoneList+1];
-                    nodes[1] = zoneList[iZoneList+2];
-                    nodes[2] = zoneList[iZoneList+6];
-                    nodes[3] = zoneList[iZoneList+5];
-                    InsertFace(&st, nodes, 4, iZone);
-                    nodes[0] = zoneList[iZoneList+5];
-                    nodes[1] = zoneList[iZoneList+6];
-                    nodes[2] = zoneList[iZoneList+7];
-                    nodes[3] = zoneList[iZoneList+4];
-                    InsertFace(&st, nodes, 4, iZone);
-                    nodes[0] = zoneList[iZoneList+4];
-                    nodes[1] = zoneList[iZoneList+7];
-                    nodes[2] = zoneList[iZoneList+3];
-                    nodes[3] = zoneList[iZoneList+0];
-                    InsertFace(&st, nodes, 4, iZone);
-                    nodes[0] = zoneList[iZoneList+0];
-                    nodes[1] = zoneList[iZoneList+1];
-                    nodes[2] = zoneList[iZoneList+5];
-                    nodes[3] = zoneList[iZoneList+4];
-                    InsertFace(&st, nodes, 4, iZone);
-                    nodes[0] = zoneList[iZoneList+3];
-                    nodes[1] = zoneList[iZoneList+7];
-                    nodes[2] = zoneList[iZoneList+6];
-                    nodes[3] = zoneList[iZoneList+2];
-                    InsertFace(&st, nodes, 4, iZone);
-                    iZone++;
-                    iZoneList += 8;
-                }
-                break;
-            case DB_ZONETYPE_POLYHEDRON:
-                for (j = 0; j < shapeCnt[i]; j++)
-                {
-                    nFaces = zoneList[iZoneList++];
-                    for (k = 0; k < nFaces; k++)
-                    {
-                        nEdges = zoneList[iZoneList++];
-                        InsertFace(&st, &zoneList[iZoneList], nEdges, iZone);
-                        iZoneList += nEdges;
-                    }
-                    iZone++;
-                }
-                break;
-            case DB_ZONETYPE_QUAD_BEAM:
-                for (j = 0; j < shapeCnt[i]; j++)
-                {
-                    InsertFace(&st, &zoneList[iZoneList], 2, iZone);
-                    iZoneList += shapeSize[i];
-                    iZone++;
-                }
-                break;
-            case DB_ZONETYPE_QUAD_TRIANGLE:
-                for (j = 0; j < shapeCnt[i]; j++)
-                {
-                    InsertFace(&st, &zoneList[iZoneList], 3, iZone);
-                    iZoneList += shapeSize[i];
-                    iZone++;
-                }
-                break;
-            case DB_ZONETYPE_QUAD_QUAD:
-                for (j = 0; j < shapeCnt[i]; j++)
-                {
-                    InsertFace(&st, &zoneList[iZoneList], 4, iZone);
-                    iZoneList += shapeSize[i];
-                    iZone++;
-                }
-                break;
-            case DB_ZONETYPE_BEAM:
-            case DB_ZONETYPE_TRIANGLE:
-            case DB_ZONETYPE_QUAD:
-            case DB_ZONETYPE_POLYGON:
-                for (j = 0; j < shapeCnt[i]; j++)
-                {
-                    InsertFace(&st, &zoneList[iZoneList], shapeSize[i], iZone);
-                    iZoneList += shapeSize[i];
-                    iZone++;
-                }
-                break;
-            default:
-                iZone += shapeCnt[i];
-                iZoneList += shapeSize[i] * shapeCnt[i];
-                break;
+            int n = nZones / nThreads + (t < nZones % nThreads ? 1 : 0);
+            ranges[t].st = &st;
+            ranges[t].start = cur;
+            ranges[t].nZones = n;
+            if (t < nThreads - 1)
+                InsertZones(&st, 0, &cur, n);
+        }
+
+        for (t = 1; t < nThreads; t++)
+            started[t] = pthread_create(&threads[t], 0, InsertZoneRange,
+                                        &ranges[t]) == 0;
+        InsertZoneRange(&ranges[0]);
+        for (t = 1; t < nThreads; t++)
+        {
+            if (started[t])
+                pthread_join(threads[t], 0);
+            else
+                InsertZoneRange(&ranges[t]);
         }
+
+        /*
+         * Merge the faces left in each range. Faces on the boundaries
+         * between ranges cancel here.
+         */
+        InitFaceHash(&faceHash, 0);
+        for (t = 0; t < nThreads; t++)
+        {
+            MergeFaceHash(&st, &faceHash, &ranges[t].faceHash);
+            FreeFaceHash(&ranges[t].faceHash);
+        }
+
+        FREE(started);
+        FREE(threads);
+        FREE(ranges);
+    }
+    else
+#endif
+    {
+        /*
+         * Loop over all the zones, adding the faces for each zone,
+         * removing duplicates as they are encountered.
+         */
+        cur.iShape = 0;
+        cur.j = 0;
+        cur.iZone = 0;
+        cur.iZoneList = 0;
+        InitFaceHash(&faceHash, nZones / 8);
+        InsertZones(&st, &faceHash, &cur, nZones);
     }
 
     /*
      * Form a DBfacelist structure from the remaining faces.
      */
-    faceList = FormFaceList(&st);
+    faceList = FormFaceList(&st, &faceHash);
+    FreeFaceHash(&faceHash);
 
     return faceList;
 }
 
+/***********************************************************************
+ *
+ * Purpose:  Insert the faces of nZones zones, starting at the zone
+ *           given by the cursor, into the face hash table. The cursor
+ *           is advanced past those zones. If faceHash is NULL the
+ *           cursor is advanced without inserting anything.
+ *
+ **********************************************************************/
+
+PRIVATE void
+InsertZones(CalcExternalFacesState *st, FaceHash *faceHash,
+            ZoneCursor *cur, int nZones)
+{
+    int const *zoneList = st->zoneList;
+
+    while (nZones > 0 && cur->iShape < st->nShapes)
+    {
+        int iShape = cur->iShape;
+
+        if (cur->j >= st->shapeCnt[iShape])
+        {
+            cur->iShape++;
+            cur->j = 0;
+            continue;
+        }
+
+        if (faceHash)
+            cur->iZoneList += InsertZone(st, faceHash, iShape,
+                                  &zoneList[cur->iZoneList], cur->iZone);
+        else
+            cur->iZoneList += ZoneLength(st, iShape,
+                                  &zoneList[cur->iZoneList]);
+        cur->iZone++;
+        cur->j++;
+        nZones--;
+    }
+}
+
+/***********************************************************************
+ *
+ * Purpose:  Return the number of zonelist entries used by one zone of
+ *           the given shape.
+ *
+ **********************************************************************/
+
+PRIVATE int
+ZoneLength(CalcExternalFacesState *st, int iShape, int const *zoneNodes)
+{
+    int       k, n, nFaces;
+
+    switch (st->shapeType[iShape])
+    {
+        case DB_ZONETYPE_QUAD_TET:
+        case DB_ZONETYPE_TET:
+            return 4;
+        case DB_ZONETYPE_QUAD_PYRAMID:
+        case DB_ZONETYPE_PYRAMID:
+            return 5;
+        case DB_ZONETYPE_QUAD_PRISM:
+        case DB_ZONETYPE_PRISM:
+            return 6;
+        case DB_ZONETYPE_QUAD_HEX:
+        case DB_ZONETYPE_HEX:
+            return 8;
+        case DB_ZONETYPE_POLYHEDRON:
+            nFaces = zoneNodes[0];
+            n = 1;
+            for (k = 0; k < nFaces; k++)
+                n += zoneNodes[n] + 1;
+            return n;
+        default:
+            return st->shapeSize[iShape];
+    }
+}
+
+/***********************************************************************
+ *
+ * Purpose:  Insert the faces of one zone into the face hash table.
+ *
+ * Return:   The number of zonelist entries used by the zone.
+ *
+ **********************************************************************/
+
+PRIVATE int
+InsertZone(CalcExternalFacesState *st, FaceHash *faceHash, int iShape,
+           int const *zoneNodes, int zoneNo)
+{
+    int const (*faces)[5] = NULL;
+    int       nFaces = 0;
+    int       i, k, n;
+    int       nodes[4];
+
+    switch (st->shapeType[iShape])
+    {
+        case DB_ZONETYPE_QUAD_TET:
+        case DB_ZONETYPE_TET:
+            faces = tetFaces;
+            nFaces = 4;
+            break;
+        case DB_ZONETYPE_QUAD_PYRAMID:
+        case DB_ZONETYPE_PYRAMID:
+            faces = pyramidFaces;
+            nFaces = 5;
+            break;
+        case DB_ZONETYPE_QUAD_PRISM:
+        case DB_ZONETYPE_PRISM:
+            faces = prismFaces;
+            nFaces = 5;
+            break;
+        case DB_ZONETYPE_QUAD_HEX:
+        case DB_ZONETYPE_HEX:
+            faces = hexFaces;
+            nFaces = 6;
+            break;
+        case DB_ZONETYPE_POLYHEDRON:
+            nFaces = zoneNodes[0];
+            n = 1;
+            for (k = 0; k < nFaces; k++)
+            {
+                InsertFace(st, faceHash, &zoneNodes[n+1], zoneNodes[n],
+                           zoneNo, k);
+                n += zoneNodes[n] + 1;
+            }
+            return n;
+        case DB_ZONETYPE_QUAD_BEAM:
+            InsertFace(st, faceHash, zoneNodes, 2, zoneNo, 0);
+            return st->shapeSize[iShape];
+        case DB_ZONETYPE_QUAD_TRIANGLE:
+            InsertFace(st, faceHash, zoneNodes, 3, zoneNo, 0);
+            return st->shapeSize[iShape];
+        case DB_ZONETYPE_QUAD_QUAD:
+            InsertFace(st, faceHash, zoneNodes, 4, zoneNo, 0);
+            return st->shapeSize[iShape];
+        case DB_ZONETYPE_BEAM:
+        case DB_ZONETYPE_TRIANGLE:
+        case DB_ZONETYPE_QUAD:
+        case DB_ZONETYPE_POLYGON:
+            InsertFace(st, faceHash, zoneNodes, st->shapeSize[iShape],
+                       zoneNo, 0);
+            return st->shapeSize[iShape];
+        default:
+            return st->shapeSize[iShape];
+    }
+
+    for (k = 0; k < nFaces; k++)
+    {
+        for (i = 0; i < faces[k][0]; i++)
+            nodes[i] = zoneNodes[faces[k][i+1]];
+        InsertFace(st, faceHash, nodes, faces[k][0], zoneNo, k);
+    }
+
+    return ZoneLength(st, iShape, zoneNodes);
+}
+
+#ifdef HAVE_PTHREAD
+/***********************************************************************
+ *
+ * Purpose:  Thread entry point. Build a face hash table for a range
+ *           of zones.
+ *
+ **********************************************************************/
+
+PRIVATE void *
+InsertZoneRange(void *arg)
+{
+    ZoneRange *range = (ZoneRange *) arg;
+    ZoneCursor cur = range->start;
+
+    InitFaceHash(&range->faceHash, range->nZones / 8);
+    InsertZones(range->st, &range->faceHash, &cur, range->nZones);
+
+    return 0;
+}
+
+/***********************************************************************
+ *
+ * Purpose:  Insert the faces remaining in one face hash table into
+ *           another, in zone order.
+ *
+ **********************************************************************/
+
+PRIVATE void
+MergeFaceHash(CalcExternalFacesState *st, FaceHash *dst, FaceHash *src)
+{
+    int       i, n;
+    int       *order;
+
+    order = SortedFaces(src, 0, INT_MAX, 0, &n);
+    for (i = 0; i < n; i++)
+    {
+        Face *f = &src->faces[order[i]];
+        InsertFace(st, dst, FaceNodes(src, f), f->nNodes, f->zoneNo,
+                   f->faceNo);
+    }
+    FREE(order);
+}
+#endif
+
+/***********************************************************************
+ *
+ * Purpose:  Return the nodes of a face.
+ *
+ **********************************************************************/
+
+PRIVATE int *
+FaceNodes(FaceHash *faceHash, Face *face)
+{
+    if (face->nNodes <= FACE_INLINE_NODES)
+        return face->u.nodes;
+    return &faceHash->nodes[face->u.offset];
+}
+
+/***********************************************************************
+ *
+ * Purpose:  Return, in a newly allocated array, the indices of the
+ *           faces in the face hash table with zone numbers in the
+ *           range [minIndex,maxIndex]. If nBuckets is zero they are
+ *           ordered by zone number and then by the face's index within
+ *           its zone, the order in which they were inserted. Otherwise
+ *           they are ordered by their smallest node modulo nBuckets
+ *           and then in reverse insertion order.
+ *
+ **********************************************************************/
+
+typedef struct FaceKey
+{
+    int       bucket;
+    int       zoneNo;
+    int       faceNo;
+    int       idx;
+} FaceKey;
+
+static int
+CompareFaceKeys(void const *a, void const *b)
+{
+    FaceKey const *ka = (FaceKey const *) a;
+    FaceKey const *kb = (FaceKey const *) b;
+    int       sign;
+
+    if (ka->bucket != kb->bucket)
+        return ka->bucket < kb->bucket ? -1 : 1;
+
+    /*
+     * Within a bucket, the most recently inserted face comes first.
+     */
+    sign = ka->bucket >= 0 ? -1 : 1;
+    if (ka->zoneNo != kb->zoneNo)
+        return ka->zoneNo < kb->zoneNo ? -sign : sign;
+    if (ka->faceNo != kb->faceNo)
+        return ka->faceNo < kb->faceNo ? -sign : sign;
+    return ka->idx < kb->idx ? -1 : (ka->idx > kb->idx);
+}
+
+PRIVATE int *
+SortedFaces(FaceHash *faceHash, int minIndex, int maxIndex, int nBuckets,
+            int *nFaces)
+{
+    unsigned  i;
+    int       n = 0;
+    FaceKey   *keys;
+    int       *order;
+
+    keys = MALLOC_N(FaceKey, faceHash->nLive > 0 ? faceHash->nLive : 1);
+    for (i = 0; i < faceHash->size; i++)
+    {
+        int idx = faceHash->table[i];
+        Face *f;
+
+        if (idx < 0)
+            continue;
+        f = &faceHash->faces[idx];
+        if (f->zoneNo < minIndex || f->zoneNo > maxIndex)
+            continue;
+        keys[n].bucket = nBuckets > 0 ? FaceNodes(faceHash, f)[0] % nBuckets : -1;
+        keys[n].zoneNo = f->zoneNo;
+        keys[n].faceNo = f->faceNo;
+        keys[n].idx = idx;
+        n++;
+    }
+
+    qsort(keys, (size_t) n, sizeof(FaceKey), CompareFaceKeys);
+
+    order = MALLOC_N(int, n > 0 ? n : 1);
+    for (i = 0; i < (unsigned) n; i++)
+        order[i] = keys[i].idx;
+    FREE(keys);
+
+    *nFaces = n;
+    return order;
+}
+
 /***********************************************************************
  *
  * Purpose:  Form a DBfacelist structure from the remaining faces in
@@ -502,6 +810,7 @@ CalcExternalFaces(int *zoneList, int nNodes, int lowOffset, int highOffset,
  *
  * Input arguments:
  *    st       : The external facelist state.
+ *    faceHash : The face hash table.
  *
  * Output arguments:
  *    fl       : The resulting facelist.
@@ -526,10 +835,9 @@ CalcExternalFaces(int *zoneList, int nNodes, int lowOffset, int highOffset,
  **********************************************************************/
 
 PRIVATE DBfacelist *
-FormFaceList(CalcExternalFacesState *st)
+FormFaceList(CalcExternalFacesState *st, FaceHash *faceHash)
 {
-    int       i, j;
-    FaceHash  *faceHash=NULL;
+    int       i, j, s;
     int       origin;
     int       minIndex, maxIndex;
     int       nZones;
@@ -537,17 +845,13 @@ FormFaceList(CalcExternalFacesState *st)
     int       lFaceList;
     int       iFace;
     int       nFaces;
-    Face      firstFace;
-    Face      *prevFace=NULL, *curFace=NULL, *tmpFace=NULL;
-    int       zoneNoNext;
+    int       *order=NULL;
     int       *faceList=NULL, *zoneNo=NULL;
-    int       curSize;
     int       nShapes;
     int       lShapeList;
     int       *shapeCnt=NULL, *shapeSize=NULL;
     DBfacelist *fl=NULL;
 
-    faceHash = &(st->faceHash);
     origin = st->origin;
 
     /*
@@ -560,118 +864,74 @@ FormFaceList(CalcExternalFacesState *st)
     maxIndex = nZones - st->highOffset - 1;
 
     /*
-     * Link all the faces into a list and determine the total number
-     * faces and the total number of nodes in the resulting facelist.
-     * Faces that are associated with ghost elements are eliminated
-     * during the chaining process.  The first element in the list is
-     * an extra face that is allocated from the stack.  This eliminates
-     * special cases in the coding.  Once the faces have been linked
-     * together the hash table is no longer needed so it is freed.
+     * Gather the faces that came from real (non-ghost) zones, in
+     * order, and determine the shapes present in the order they first
+     * appear.
      */
-    firstFace.nNodes = 0;
-    firstFace.nodes  = NULL;
-    firstFace.zoneNo = 0;
-    firstFace.next   = NULL;
-    curFace = &firstFace;
-    nFaces = 0;
-    lFaceList = 0;
-    for (i = 0; i < faceHash->size; i++)
+    order = SortedFaces(faceHash, minIndex, maxIndex,
+                        MAX(MIN(st->nNodes, HASH_MAX), 1), &nFaces);
+
+    nShapes    = 0;
+    lShapeList = 10;
+    lFaceList  = 0;
+    if (nFaces > 0)
     {
-        if (faceHash->table[i] != NULL)
+        shapeSize  = MALLOC_N(int, lShapeList);
+        shapeCnt   = MALLOC_N(int, lShapeList);
+    }
+    for (i = 0; i < nFaces; i++)
+    {
+        int nn = faceHash->faces[order[i]].nNodes;
+
+        for (s = 0; s < nShapes && shapeSize[s] != nn; s++)
+            /* empty */;
+        if (s == nShapes)
         {
-            curFace->next = faceHash->table[i];
-            while (curFace->next != NULL)
+            /*
+             * Allocate more space for the shape structures if necessary.
+             */
+            if (nShapes >= lShapeList)
             {
-                /*
-                 * If the face came from a real zone, add it to
-                 * the list, otherwise delete it.
-                 */
-                zoneNoNext = curFace->next->zoneNo;
-                if (zoneNoNext >= minIndex && zoneNoNext <= maxIndex)
-                {
-                    nFaces++;
-                    lFaceList += curFace->nNodes;
-                    curFace = curFace->next;
-                }
-                else
-                {
-                    tmpFace = curFace->next;
-                    curFace->next = tmpFace->next;
-                    FreeFace(tmpFace);
-                }
+                lShapeList += 10;
+                shapeSize = REALLOC_N(shapeSize, int, lShapeList);
+                shapeCnt  = REALLOC_N(shapeCnt, int, lShapeList);
             }
+            shapeSize[nShapes] = nn;
+            shapeCnt[nShapes]  = 0;
+            nShapes++;
         }
+        shapeCnt[s]++;
+        lFaceList += nn;
     }
-    lFaceList += curFace->nNodes;
-    FREE(faceHash->table);
-    faceHash->size = 0;
 
     /*
-     * Build the arrays necessary for the DBfacelist structure.  Loop
-     * over all the faces, extracting all the faces of a particular type
-     * each time until all the faces have been extracted.
+     * Build the arrays necessary for the DBfacelist structure, all
+     * the faces of each shape together.
      */
-    nShapes    = 0;
-    lShapeList = 10;
-    if (nFaces != 0)
+    if (nFaces > 0)
     {
-        shapeSize  = MALLOC_N(int, lShapeList);
-        shapeCnt   = MALLOC_N(int, lShapeList);
         faceList   = MALLOC_N(int, lFaceList);
         zoneNo     = MALLOC_N(int, nFaces);
     }
     iFace      = 0;
     iFaceList  = 0;
-
-    while (firstFace.next != NULL)
+    for (s = 0; s < nShapes; s++)
     {
-        /*
-         * Allocate more space for the shape structures if necessary.
-         */
-        if (nShapes >= lShapeList)
+        for (i = 0; i < nFaces; i++)
         {
-            lShapeList += 10;
-            shapeSize = REALLOC_N(shapeSize, int, lShapeList);
-            shapeCnt  = REALLOC_N(shapeCnt, int, lShapeList);
-        }
+            Face *f = &faceHash->faces[order[i]];
+            int const *nodes;
 
-        /*
-         * Add an entry in the shape structure for the current shape
-         * type.
-         */
-        prevFace = &firstFace;
-        curFace  = firstFace.next;
-        curSize  = curFace->nNodes;
-        shapeSize[nShapes] = curSize;
-        shapeCnt[nShapes]  = 0;
-
-        /*
-         * Loop over all the faces, adding all the faces with the current
-         * size to the output face list and removing them from the input
-         * list of faces.
-         */
-        while (curFace != NULL)
-        {
-            if (curFace->nNodes == curSize)
-            {
-                shapeCnt[nShapes] += 1;
-                zoneNo[iFace] = curFace->zoneNo + origin;
-                iFace++;
-                for (j = 0; j < curSize; j++)
-                {
-                    faceList[iFaceList+j] = curFace->nodes[j];
-                }
-                iFaceList += curSize;
-                prevFace->next = curFace->next;
-                FreeFace(curFace);
-                curFace = prevFace;
-            }
-            prevFace = curFace;
-            curFace = curFace->next;
+            if (f->nNodes != shapeSize[s])
+                continue;
+            nodes = FaceNodes(faceHash, f);
+            zoneNo[iFace++] = f->zoneNo + origin;
+            for (j = 0; j < f->nNodes; j++)
+                faceList[iFaceList+j] = nodes[j];
+            iFaceList += f->nNodes;
         }
-
-        nShapes++;
     }
+    FREE(order);
 
     /*
      * Put all the pieces together into the DBfacelist structure.
@@ -691,6 +951,102 @@ FormFaceList(CalcExternalFacesState *st)
     return fl;
 }
 
+/***********************************************************************
+ *
+ * Purpose:  Initialize an empty face hash table sized for about
+ *           sizeHint zones.
+ *
+ **********************************************************************/
+
+PRIVATE void
+InitFaceHash(FaceHash *faceHash, int sizeHint)
+{
+    unsigned  size = 1024;
+
+    while (size < (unsigned) sizeHint && size < (1U<<30))
+        size <<= 1;
+
+    memset(faceHash, 0, sizeof(FaceHash));
+    faceHash->size     = size;
+    faceHash->table    = MALLOC_N(int, size);
+    memset(faceHash->table, 0xff, size * sizeof(int)); /* SLOT_EMPTY */
+    faceHash->maxFaces = (int) size / 2;
+    faceHash->faces    = MALLOC_N(Face, faceHash->maxFaces);
+    faceHash->freeFace = -1;
+}
+
+/***********************************************************************
+ *
+ * Purpose:  Free the memory held by a face hash table.
+ *
+ **********************************************************************/
+
+PRIVATE void
+FreeFaceHash(FaceHash *faceHash)
+{
+    FREE(faceHash->table);
+    FREE(faceHash->faces);
+    FREE(faceHash->nodes);
+    memset(faceHash, 0, sizeof(FaceHash));
+}
+
+/***********************************************************************
+ *
+ * Purpose:  Rebuild the face hash table with the given size, dropping
+ *           tombstones.
+ *
+ **********************************************************************/
+
+PRIVATE void
+RehashFaceHash(FaceHash *faceHash, unsigned size)
+{
+    unsigned  i, mask = size - 1;
+    int       *old = faceHash->table;
+    unsigned  oldSize = faceHash->size;
+
+    faceHash->table = MALLOC_N(int, size);
+    memset(faceHash->table, 0xff, size * sizeof(int)); /* SLOT_EMPTY */
+    faceHash->size = size;
+    faceHash->nTomb = 0;
+
+    for (i = 0; i < oldSize; i++)
+    {
+        unsigned h;
+
+        if (old[i] < 0)
+            continue;
+        h = FACE_SLOT(FaceNodes(faceHash, &faceHash->faces[old[i]])[0]) & mask;
+        while (faceHash->table[h] != SLOT_EMPTY)
+            h = (h + 1) & mask;
+        faceHash->table[h] = old[i];
+    }
+
+    FREE(old);
+}
+
+/***********************************************************************
+ *
+ * Purpose:  Hash of a face's nodes that does not depend on the face's
+ *           starting node or orientation.
+ *
+ **********************************************************************/
+
+static unsigned
+HashFaceNodes(int const *nodes, int nNodes)
+{
+    unsigned  h = 0;
+    int       i;
+
+    for (i = 0; i < nNodes; i++)
+    {
+        unsigned x = (unsigned) nodes[i] * 0x9E3779B1U;
+        h += x ^ (x >> 16);
+    }
+    h ^= h >> 16;
+    h *= 0x85EBCA6BU;
+    return h ^ (h >> 13);
+}
+
 /***********************************************************************
  *
  * Purpose:  Insert a face into the face hash table.  If the face is
@@ -702,9 +1058,11 @@ FormFaceList(CalcExternalFacesState *st)
  *
  * Input arguments:
  *    st       : The external facelist state.
+ *    faceHash : The face hash table.
  *    nodes    : The nodes making up the face.
  *    nNodes   : The number of nodes in the face.
  *    zoneNo   : The zone number associated with the face.
+ *    faceNo   : The index of the face within its zone.
  *
  * Output arguments:
  *
@@ -717,172 +1075,157 @@ FormFaceList(CalcExternalFacesState *st)
  **********************************************************************/
 
 PRIVATE void
-InsertFace(CalcExternalFacesState *st, int *nodes, int nNodes, int zoneNo)
+InsertFace(CalcExternalFacesState *st, FaceHash *faceHash,
+           int const *nodes, int nNodes, int zoneNo, int faceNo)
 {
     int       i, j;
-    FaceHash  *faceHash=NULL;
-    int       bndMethod;
-    int       *matList;
     int       iMin;
-    int       match;
-    int       deleteIt;
-    Face      *prevFace=NULL, *curFace=NULL;
-
-    faceHash  = &(st->faceHash);
-    bndMethod = st->bndMethod;
-    matList   = st->matList;
+    unsigned  hash, h, mask;
+    int       tomb = -1;
+    int       slot = -1;
+    int       found = -1;
+    int       iFace;
+    Face      *curFace=NULL;
+    int       *dst;
 
     /*
      * Find index of the minimum node number in the node list
-     * for the face.  Since it is used to index into the hash
-     * table and as the starting point for performing a match.
+     * for the face.  It is the starting point for performing a
+     * match and for storing the face.
      */
     iMin = 0;
     for (i = 1; i < nNodes; i++)
     {
         if (nodes[i] < nodes[iMin]) iMin = i;
     }
+    hash = HashFaceNodes(nodes, nNodes);
 
     /*
-     * Search the list of faces in the linked list of possible
-     * matches for a match.
+     * Probe the table for a face with the same nodes in the opposite
+     * orientation.
      */
-    curFace = faceHash->table[nodes[iMin] % faceHash->size];
-    match = 0;
-    while (match == 0 && curFace != NULL)
+    mask = faceHash->size - 1;
+    for (h = FACE_SLOT(nodes[iMin]) & mask; faceHash->table[h] != SLOT_EMPTY; h = (h + 1) & mask)
     {
-        if (curFace->nNodes == nNodes)
+        int       match;
+        int const *curNodes;
+
+        if (faceHash->table[h] == SLOT_TOMB)
         {
-            match = 1;
-            j = (iMin + nNodes - 1) % nNodes;
-            for (i = 1; i < nNodes && match == 1; i++)
-            {
-                match = (curFace->nodes[i] == nodes[j]);
-                j = (j + nNodes - 1) % nNodes;
-            }
+            if (tomb < 0) tomb = (int) h;
+            continue;
         }
 
-        if (match == 0)
+        curFace = &faceHash->faces[faceHash->table[h]];
+        if (curFace->hash != hash || curFace->nNodes != nNodes)
+            continue;
+        curNodes = FaceNodes(faceHash, curFace);
+        if (curNodes[0] != nodes[iMin])
+            continue;
+
+        match = 1;
+        j = (iMin + nNodes - 1) % nNodes;
+        for (i = 1; i < nNodes && match == 1; i++)
+        {
+            match = (curNodes[i] == nodes[j]);
+            j = (j + nNodes - 1) % nNodes;
+        }
+        if (match)
         {
-            prevFace = curFace;
-            curFace = curFace->next;
+            found = (int) h;
+            break;
         }
     }
 
     /*
-     * Determine if the face should be deleted based on getting
-     * a match and the bndMethod.
+     * If there is a match, delete it unless the bndMethod says faces
+     * between zones of different materials are to be kept.
      */
-    deleteIt = 0;
-    if (match == 1)
+    if (found >= 0 &&
+        (st->bndMethod == 0 || st->matList[curFace->zoneNo] == st->matList[zoneNo]))
     {
-        if (bndMethod == 0)
-        {
-            deleteIt = 1;
-        }
-        else if (matList[curFace->zoneNo] == matList[zoneNo])
-        {
-            deleteIt = 1;
-        }
+        iFace = faceHash->table[found];
+        faceHash->table[found] = SLOT_TOMB;
+        faceHash->nTomb++;
+        faceHash->nLive--;
+        faceHash->faces[iFace].next = faceHash->freeFace;
+        faceHash->freeFace = iFace;
+        return;
     }
-        
+
     /*
-     * Either delete the matching face or add the new one based on
-     * the deleteIt flag.
+     * Add the face. Keep the table no more than half full, counting
+     * tombstones, doubling its size only when live faces need it.
      */
-    if (deleteIt == 1)
+    if (found >= 0)
     {
-        /*
-         * Delete the face.
-         */
-        if (prevFace == NULL)
+        for (; faceHash->table[h] != SLOT_EMPTY; h = (h + 1) & mask)
+            if (tomb < 0 && faceHash->table[h] == SLOT_TOMB) tomb = (int) h;
+    }
+    if (tomb < 0 && (unsigned) (faceHash->nLive + faceHash->nTomb + 1) * 2 > faceHash->size)
+    {
+        unsigned size = faceHash->size;
+        if ((unsigned) (faceHash->nLive + 1) * 8 > size)
+            size <<= 1;
+        RehashFaceHash(faceHash, size);
+        mask = faceHash->size - 1;
+        for (h = FACE_SLOT(nodes[iMin]) & mask; faceHash->table[h] != SLOT_EMPTY; h = (h + 1) & mask)
+            /* empty */;
+        slot = (int) h;
+    }
+    else if (tomb >= 0)
+    {
+        slot = tomb;
+        faceHash->nTomb--;
+    }
+    else
+    {
+        slot = (int) h;
+    }
+
+    if (faceHash->freeFace >= 0)
+    {
+        iFace = faceHash->freeFace;
+        faceHash->freeFace = faceHash->faces[iFace].next;
+    }
+    else
+    {
+        if (faceHash->nFaces >= faceHash->maxFaces)
         {
-            /*
-             * The previous element is the beginning of the list.
-             */
-            faceHash->table[nodes[iMin] % faceHash->size] = curFace->next;
+            faceHash->maxFaces *= 2;
+            faceHash->faces = REALLOC_N(faceHash->faces, Face,
+                                        faceHash->maxFaces);
         }
-        else
-        {
-            /*
-             * The previous element is in the middle of the list.
-             */
-            prevFace->next = curFace->next;
-        } 
-        FreeFace(curFace);
+        iFace = faceHash->nFaces++;
+    }
+
+    curFace = &faceHash->faces[iFace];
+    curFace->nNodes = nNodes;
+    curFace->zoneNo = zoneNo;
+    curFace->faceNo = faceNo;
+    curFace->hash   = hash;
+    curFace->next   = -1;
+    if (nNodes <= FACE_INLINE_NODES)
+    {
+        dst = curFace->u.nodes;
     }
     else
     {
-        /*
-         * Add the face.
-         */
-        curFace = AllocFace();
-        curFace->nNodes = nNodes;
-        curFace->nodes = MALLOC_N(int, nNodes);
-        for (i = 0, j = iMin; i < nNodes; i++, j = (j + 1) % nNodes)
+        if (faceHash->nNodes + nNodes > faceHash->maxNodes)
         {
-            curFace->nodes[i] = nodes[j];
+            faceHash->maxNodes = 2 * (faceHash->maxNodes + nNodes);
+            faceHash->nodes = REALLOC_N(faceHash->nodes, int,
+                                        faceHash->maxNodes);
         }
-        curFace->zoneNo = zoneNo;
-        curFace->next = faceHash->table[nodes[iMin] % faceHash->size];
-        faceHash->table[nodes[iMin] % faceHash->size] = curFace;
+        curFace->u.offset = faceHash->nNodes;
+        dst = &faceHash->nodes[faceHash->nNodes];
+        faceHash->nNodes += nNodes;
+    }
+    for (i = 0, j = iMin; i < nNodes; i++, j = (j + 1) % nNodes)
+    {
+        dst[i] = nodes[j];
     }
-}
-
-/***********************************************************************
- *
- * Purpose:  Free a Face structure.
- *
- * Programmer: Eric Brugger
- * Date:       March 12, 1999
- *
- * Input arguments:
- *    face     : The face to free.
- *
- * Output arguments:
- *
- * Input/Output arguments:
- *
- * Notes
- *
- * Modifications:
- *
- **********************************************************************/
-
-PRIVATE void
-FreeFace(Face *face)
-{
-
-    FREE(face->nodes);
-    FREE(face);
-}
-
-/***********************************************************************
- *
- * Purpose:  Allocate a Face structure.
- *
- * Programmer: Eric Brugger
- * Date:       March 12, 1999
- *
- * Input arguments:
- *
- * Output arguments:
- *    face     : The newly allocated face.
- *
- * Input/Output arguments:
- *
- * Notes
- *
- * Modifications:
- *
- **********************************************************************/
-
-PRIVATE Face *
-AllocFace(void)
-{
-    Face      *face=NULL;
-
-    face = MALLOC_N(Face, 1);
 
-    return face;
+    faceHash->table[slot] = iFace;
+    faceHash->nLive++;
 }
@@ -120,6 +120,9 @@ be used for advertising or product endorsement purposes.
 #endif
 
 #include <stdarg.h>
+#ifdef SILO_THREADSAFE
+#include <pthread.h>
+#endif
 
 /* DB_MAIN must be defined before including silo_private.h. */
 #define DB_MAIN
@@ -148,6 +151,12 @@ int Silo_version_4_12_0_pre2 = 0;
 PUBLIC int     DBDebugAPI = 0;  /*file desc for API debug messages      */
 PUBLIC int     db_errno = 0;    /*last error number                     */
 PUBLIC char    db_errfunc[64];  /*name of erring function               */
+#ifdef SILO_THREADSAFE
+/* per-thread copies of the above returned by DBErrno() and DBErrFuncname() */
+INTERNAL SILO_THREAD_LOCAL int db_tls_errno = 0;
+PRIVATE SILO_THREAD_LOCAL char db_tls_errfunc[64];
+#endif
+INTERNAL SILO_THREAD_LOCAL jstk_t *SILO_Jstk = 0; /*error jump stack */
 PUBLIC char   *_db_err_list[] =
 {
     "No error",                               /*00 */
@@ -206,8 +215,9 @@ typedef struct reg_status_t {
     DBfile *f;
     unsigned int n;
     int w;
+    int wr;          /* multi-writer silo VFD writer, or -1 */
 } reg_status_t;
-PRIVATE reg_status_t _db_regstatus[DB_NFILES] = /* DB_NFILES triples of zeros */
+PRIVATE reg_status_t _db_regstatus[DB_NFILES] = /* DB_NFILES sets of zeros */
     {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -254,6 +264,7 @@ typedef struct db_silo_stat_t {
     DWORD fileindexlo;
     DWORD fileindexhi;
 #endif
+    int writer;      /* multi-writer silo VFD writer, or -1 */
 } db_silo_stat_t;
 
 /* Forward declarations */
@@ -305,6 +316,9 @@ SILO_Globals_t SILO_Globals = {
     0,     /* compressionErrmode (fallback) */
     0,     /* compatability mode */
     0,     /* evalNameschemes */
+    1,     /* extfaceThreads */
+    0,     /* readPrecision (all bit planes) */
+    16,    /* pdbObjectCacheSize */
     {      /* file options sets [32 of them] */
         0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0,
@@ -314,7 +328,6 @@ SILO_Globals_t SILO_Globals = {
     DB_TOP,/* _db_err_level */
     0,     /* _db_err_func */
     DB_NONE,/* _db_err_level_drvr */
-    0,     /* Jstk */
     DEFAULT_DRIVER_PRIORITIES
 };
 
@@ -360,7 +373,7 @@ INTERNAL int
 db_perror(char const *s, int errorno, char const *fname)
 {
     int            call_abort = 0;
-    static char    old_s[256] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    static SILO_THREAD_LOCAL char old_s[256] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
                                  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
                                  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
                                  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -377,6 +390,12 @@ db_perror(char const *s, int errorno, char const *fname)
     if (fname)
         strncpy(db_errfunc, fname, sizeof(db_errfunc) - 1);
     db_errfunc[sizeof(db_errfunc) - 1] = '\0';
+#ifdef SILO_THREADSAFE
+    db_tls_errno = errorno;
+    if (fname)
+        strncpy(db_tls_errfunc, fname, sizeof(db_tls_errfunc) - 1);
+    db_tls_errfunc[sizeof(db_tls_errfunc) - 1] = '\0';
+#endif
 
     /*
      * If `s' is an empty string, then use the same string
@@ -395,12 +414,12 @@ db_perror(char const *s, int errorno, char const *fname)
 
     switch (SILO_Globals._db_err_level) {
         case DB_NONE:
-            if (SILO_Globals.Jstk)
-                longjmp(SILO_Globals.Jstk->jbuf, -1);
+            if (SILO_Jstk)
+                longjmp(SILO_Jstk->jbuf, -1);
             return -1;
         case DB_TOP:
-            if (SILO_Globals.Jstk)
-                longjmp(SILO_Globals.Jstk->jbuf, -1);
+            if (SILO_Jstk)
+                longjmp(SILO_Jstk->jbuf, -1);
             break;
         case DB_ALL:
             break;
@@ -476,7 +495,7 @@ db_perror(char const *s, int errorno, char const *fname)
 INTERNAL char *
 db_strerror(int errorno)
 {
-    static char    s[32];
+    static SILO_THREAD_LOCAL char s[32];
 
     if (errorno < 0 || errorno >= NELMTS(_db_err_list)) {
         sprintf(s, "Error %d", errorno);
@@ -1894,6 +1913,121 @@ context_restore(DBfile *dbfile, context_t *old)
     return 0;
 }
 
+#ifdef SILO_THREADSAFE
+/*-------------------------------------------------------------------------
+ * Locks for thread-safe builds.
+ *
+ * _db_reglock protects the file registry (_db_fstatus, _db_regstatus). It
+ * is a leaf lock; nothing else is ever acquired while it is held.
+ *
+ * _db_globlock is a recursive lock serializing DBOpen/DBCreate and every
+ * operation on a file which does not get a lock of its own.
+ *
+ * _db_filelock[] are recursive locks, one per fileid slot, used for files
+ * that are opened read-only with a re-entrant driver (HDF5, when it was
+ * built thread-safe).
+ *
+ * Each thread keeps a stack of the locks it holds so that an error which
+ * longjmp's back to the top-level API function can unwind them.
+ *-------------------------------------------------------------------------*/
+#define DB_MAX_HELD_LOCKS 256
+PRIVATE pthread_mutex_t _db_reglock = PTHREAD_MUTEX_INITIALIZER;
+PRIVATE pthread_mutex_t _db_globlock;
+PRIVATE pthread_mutex_t _db_filelock[DB_NFILES];
+PRIVATE pthread_once_t  _db_locks_once = PTHREAD_ONCE_INIT;
+PRIVATE SILO_THREAD_LOCAL pthread_mutex_t *_db_held_locks[DB_MAX_HELD_LOCKS];
+PRIVATE SILO_THREAD_LOCAL int _db_nheld_locks = 0;
+
+PRIVATE void
+db_init_locks(void)
+{
+    int i;
+    pthread_mutexattr_t attr;
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&_db_globlock, &attr);
+    for (i = 0; i < DB_NFILES; i++)
+        pthread_mutex_init(&_db_filelock[i], &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+PRIVATE int
+db_push_lock(pthread_mutex_t *m)
+{
+    if (_db_nheld_locks >= DB_MAX_HELD_LOCKS)
+    {
+        fprintf(stderr, "Silo: lock stack overflow\n");
+        abort();
+    }
+    pthread_once(&_db_locks_once, db_init_locks);
+    pthread_mutex_lock(m);
+    _db_held_locks[_db_nheld_locks++] = m;
+    return 1;
+}
+
+INTERNAL int
+db_lock_depth(void)
+{
+    return _db_nheld_locks;
+}
+
+INTERNAL void
+db_unlock_to(int depth)
+{
+    if (depth < 0) depth = 0;
+    while (_db_nheld_locks > depth)
+        pthread_mutex_unlock(_db_held_locks[--_db_nheld_locks]);
+}
+
+INTERNAL int
+db_global_lock(void)
+{
+    return db_push_lock(&_db_globlock);
+}
+
+/* Only read-only HDF5 files are safe to operate on concurrently, and only
+   when HDF5 was built thread-safe, so that it serializes calls into it
+   itself. Otherwise every file shares the global lock. The read path of the
+   HDF5 driver keeps its scratch state per thread, the silo VFD's shared
+   block pool has its own lock and the ZFP filter's read precision and
+   execution policy are per thread, so reads of different files share no
+   mutable state outside HDF5. */
+INTERNAL int
+db_file_lock(DBfile *dbfile)
+{
+    int i;
+    int own = 0;
+
+    if (!dbfile)
+        return 0;
+
+    pthread_mutex_lock(&_db_reglock);
+    for (i = 0; i < DB_NFILES; i++)
+    {
+        if (_db_regstatus[i].f == dbfile)
+        {
+#ifdef HAVE_HDF5_THREADSAFE
+            own = _db_regstatus[i].w == 0 && dbfile->pub.type == DB_HDF5 &&
+                  dbfile->pub.fileid >= 0 && dbfile->pub.fileid < DB_NFILES;
+#endif
+            break;
+        }
+    }
+    pthread_mutex_unlock(&_db_reglock);
+
+    if (own)
+        return db_push_lock(&_db_filelock[dbfile->pub.fileid]);
+    return db_push_lock(&_db_globlock);
+}
+
+#define REGLOCK()   pthread_mutex_lock(&_db_reglock)
+#define REGUNLOCK() pthread_mutex_unlock(&_db_reglock)
+#else
+#define REGLOCK()
+#define REGUNLOCK()
+#endif
+
 /*-------------------------------------------------------------------------
  * Function:    db_get_fileid
  *
@@ -1915,17 +2049,30 @@ db_get_fileid ( int flags )
     static int     vhand = 0;
     int            i;
 
+    REGLOCK();
     for (i = 0; i < DB_NFILES; i++) {
         if (!_db_fstatus[(vhand + i) % DB_NFILES]) {
             i = (vhand + i) % DB_NFILES;
             _db_fstatus[i] = flags | DB_ISOPEN;
             vhand = (i + 1) % DB_NFILES;
+            REGUNLOCK();
             return i;
         }
     }
+    REGUNLOCK();
     return -1;
 }
 
+PRIVATE void
+db_release_fileid(int id)
+{
+    if (id < 0 || id >= DB_NFILES)
+        return;
+    REGLOCK();
+    _db_fstatus[id] = 0;
+    REGUNLOCK();
+}
+
 /*-------------------------------------------------------------------------
   Function: bjhash 
 
@@ -2024,6 +2171,7 @@ PRIVATE int
 db_register_file(DBfile *dbfile, const db_silo_stat_t *filestate, int writeable)
 {
     int i;
+    REGLOCK();
     for (i = 0; i < DB_NFILES; i++)
     {
         if (_db_regstatus[i].f == 0)
@@ -2039,9 +2187,12 @@ db_register_file(DBfile *dbfile, const db_silo_stat_t *filestate, int writeable)
             _db_regstatus[i].f = dbfile;
             _db_regstatus[i].n = hval; 
             _db_regstatus[i].w = writeable;
+            _db_regstatus[i].wr = filestate->writer;
+            REGUNLOCK();
             return i;
         }
     }
+    REGUNLOCK();
     return -1;
 }
 
@@ -2049,6 +2200,7 @@ PRIVATE int
 db_unregister_file(DBfile *dbfile)
 {
     int i;
+    REGLOCK();
     for (i = 0; i < DB_NFILES; i++)
     {
         if (_db_regstatus[i].f == dbfile)
@@ -2060,24 +2212,31 @@ db_unregister_file(DBfile *dbfile)
                 _db_regstatus[j].f = _db_regstatus[j+1].f;
                 _db_regstatus[j].n = _db_regstatus[j+1].n;
                 _db_regstatus[j].w = _db_regstatus[j+1].w;
+                _db_regstatus[j].wr = _db_regstatus[j+1].wr;
             }
             _db_regstatus[j].f = 0;
+            REGUNLOCK();
             return i;
         }
     }
+    REGUNLOCK();
     return -1;
 }
 
 PRIVATE int
 db_isregistered_file(DBfile *dbfile, const db_silo_stat_t *filestate)
 {
-    int i;
+    int i, retval = -1;
+    REGLOCK();
     if (dbfile)
     {
         for (i = 0; i < DB_NFILES; i++)
         {
             if (_db_regstatus[i].f == dbfile)
-                return i;
+            {
+                retval = i;
+                break;
+            }
         }
     }
     else if (filestate)
@@ -2090,14 +2249,22 @@ db_isregistered_file(DBfile *dbfile, const db_silo_stat_t *filestate)
         hval = bjhash((unsigned char *) &(filestate->fileindexlo), sizeof(filestate->fileindexlo), hval);
         hval = bjhash((unsigned char *) &(filestate->fileindexhi), sizeof(filestate->fileindexhi), hval);
 #endif
+        /* writers of one multi-writer file each have a file of their own
+           but an ordinary open of it conflicts with all of them */
         for (i = 0; i < DB_NFILES; i++)
         {
             if (_db_regstatus[i].f != 0 &&
-                _db_regstatus[i].n == hval)
-                return i;
+                _db_regstatus[i].n == hval &&
+                (_db_regstatus[i].wr == filestate->writer ||
+                 _db_regstatus[i].wr < 0 || filestate->writer < 0))
+            {
+                retval = i;
+                break;
+            }
         }
     }
-    return -1;
+    REGUNLOCK();
+    return retval;
 }
 
 INTERNAL int
@@ -2105,10 +2272,12 @@ db_num_registered_files()
 {
     int i;
     int cnt = 0;
+    REGLOCK();
     for (i = 0; i < DB_NFILES; i++)
     {
         if (_db_regstatus[i].f) cnt++;
     }
+    REGUNLOCK();
     return cnt;
 }
 
@@ -2130,6 +2299,7 @@ db_silo_stat_one_file(const char *name, db_silo_stat_t *statbuf)
     int retval;
     errno = 0;
     memset(&(statbuf->s), 0, sizeof(statbuf->s));
+    statbuf->writer = -1;
 
 #if SIZEOF_OFF64_T > 4 && (defined(HAVE_STAT64) || !defined(HAVE_STAT))
     retval = stat64(name, &(statbuf->s));
@@ -2186,11 +2356,26 @@ db_silo_stat(const char *name, db_silo_stat_t *statbuf, int opts_set_id)
             statbuf->s.st_mode |= S_IWUSR;
             statbuf->s.st_dev = (dev_t) n++;
             statbuf->s.st_ino = (ino_t) n++;
+            statbuf->writer = -1;
             return 0;
         }
     }
  
-    retval = db_silo_stat_one_file(name, statbuf); 
+    retval = db_silo_stat_one_file(name, statbuf);
+
+    /* writers sharing a multi-writer silo VFD file each have a file
+       of their own; the writer is part of its identity */
+    if (retval == 0 && opts_set_id > DB_FILE_OPTS_LAST)
+    {
+        const DBoptlist *opts = SILO_Globals.fileOptionsSets[opts_set_id-NUM_DEFAULT_FILE_OPTIONS_SETS];
+        void *p; int vfd = -1, writer = -1;
+        if ((p = DBGetOption(opts, DBOPT_H5_VFD)))
+            vfd = *((int*)p);
+        if ((p = DBGetOption(opts, DBOPT_H5_SILO_WRITER)))
+            writer = *((int*)p);
+        if (vfd == DB_H5VFD_SILO && writer >= 0)
+            statbuf->writer = writer;
+    }
 
     if (opts_set_id == -1 ||
         opts_set_id == DB_FILE_OPTS_H5_DEFAULT_SPLIT ||
@@ -2301,7 +2486,7 @@ db_filter_install ( DBfile *dbfile )
     char          *me = "db_filter_install";
     int            len, i;
     char          *var, *var2, *s, *filter_name;
-    static char    not_found[128];
+    static SILO_THREAD_LOCAL char not_found[128];
 
     /*
      * There should be a miscellaneous variable called `_filters' in
@@ -2567,6 +2752,8 @@ DB_SETGET(int, CompatibilityMode, compatibilityMode, DB_INTBOOL_NOT_SET)
 #warning WHAT ABOUT FORCESINGLE SHOWERRORS
 #endif
 DB_SETGET(int, EvalNameschemes, evalNameschemes, DB_INTBOOL_NOT_SET)
+DB_SETGET(int, ReadPrecision, readPrecision, DB_INTBOOL_NOT_SET)
+DB_SETGET(int, PDBObjectCacheSize, pdbObjectCacheSize, DB_INTBOOL_NOT_SET)
 
 /* The compression stuff has some custom initialization */
 static void _db_set_compression_params(char **dst, char const *s)
@@ -3681,26 +3868,30 @@ DBShowErrors(int level, void(*func)(char*))
 PUBLIC char const *
 DBErrString(void)
 {
-    static char    s[128];
+    static SILO_THREAD_LOCAL char s[128];
 
-    if (db_errno < 0 || db_errno >= NELMTS(_db_err_list)) {
-        sprintf(s, "Error %d", db_errno);
+    if (DB_ERRNO < 0 || DB_ERRNO >= NELMTS(_db_err_list)) {
+        sprintf(s, "Error %d", DB_ERRNO);
         return s;
     }
 
-    return _db_err_list[db_errno];
+    return _db_err_list[DB_ERRNO];
 }
 
 PUBLIC int
 DBErrno(void)
 {
-    return db_errno;
+    return DB_ERRNO;
 }
 
 PUBLIC char const *
 DBErrFuncname(void)
 {
+#ifdef SILO_THREADSAFE
+    return db_tls_errfunc;
+#else
     return db_errfunc;
+#endif
 }
 
 PUBLIC DBErrFunc_t
@@ -3980,7 +4171,7 @@ DBFileVersionGE(const DBfile *dbfile, int Maj, int Min, int Pat)
 PUBLIC char const *
 DBFileName(const DBfile *dbfile)
 {
-    static char name[256];
+    static SILO_THREAD_LOCAL char name[256];
     if (dbfile->pub.name)
         strcpy(name, dbfile->pub.name);
     else
@@ -4025,14 +4216,13 @@ db_InitFileGlobals(DBfile *dbfile, int mode)
 #endif
     dbfile->pub.file_scope_globals->compressionErrmode      = DB_INTBOOL_NOT_SET;
     dbfile->pub.file_scope_globals->compatibilityMode       = DB_INTBOOL_NOT_SET;
+    dbfile->pub.file_scope_globals->readPrecision           = DB_INTBOOL_NOT_SET;
+    dbfile->pub.file_scope_globals->pdbObjectCacheSize      = DB_INTBOOL_NOT_SET;
     dbfile->pub.file_scope_globals->compressionParams       = (char*) DB_CHAR_PTR_NOT_SET;
     dbfile->pub.file_scope_globals->_db_err_level           = DB_INTBOOL_NOT_SET;
     dbfile->pub.file_scope_globals->_db_err_func            = DB_VOID_PTR_NOT_SET;
     dbfile->pub.file_scope_globals->_db_err_level_drvr      = DB_INTBOOL_NOT_SET;
 
-    /* Jstk only relevant for lib as a whole, not specific to a file */
-    dbfile->pub.file_scope_globals->Jstk = 0;
-
     for (i = 0; i < MAX_FILE_OPTIONS_SETS; i++)
         dbfile->pub.file_scope_globals->fileOptionsSets[i] = 0;
 
@@ -4126,6 +4316,7 @@ DBOpenReal(const char *name, int type, int mode)
     db_silo_stat_t filestate;
 
     API_BEGIN("DBOpen", DBfile *, NULL) {
+        API_LOCK_GLOBAL();
         if (DB_NOBJ_TYPES != _db_nobj_types)
             API_ERROR("Silo TOC not configured corretly", E_INTERNAL);
 
@@ -4238,7 +4429,7 @@ DBOpenReal(const char *name, int type, int mode)
             API_ERROR((char *)name, E_MAXOPEN);
         if (NULL == (dbfile = (DBOpenCB[type]) (name, mode, opts_set_id)))
         {
-            _db_fstatus[fileid] = 0;
+            db_release_fileid(fileid);
             API_RETURN(NULL);
         }
         dbfile->pub.fileid = fileid;
@@ -4328,6 +4519,7 @@ DBCreateReal(const char *name, int mode, int target, const char *info, int type)
     db_silo_stat_t filestate;
 
     API_BEGIN("DBCreate", DBfile *, NULL) {
+        API_LOCK_GLOBAL();
         if (DB_NOBJ_TYPES != _db_nobj_types)
             API_ERROR("Silo TOC not configured corretly", E_INTERNAL);
 
@@ -4380,7 +4572,7 @@ DBCreateReal(const char *name, int mode, int target, const char *info, int type)
                                       info));
         if (!dbfile)
         {
-            _db_fstatus[fileid] = 0;
+            db_release_fileid(fileid);
             API_RETURN(NULL);
         }
         dbfile->pub.fileid = fileid;
@@ -4471,8 +4663,7 @@ DBClose(DBfile *dbfile)
 #warning IS ORDER OF OPS CORRECT HERE
 #endif
         id = dbfile->pub.fileid;
-        if (id >= 0 && id < DB_NFILES)
-            _db_fstatus[id] = 0;
+        db_release_fileid(id);
 
         if (dbfile->pub.file_lib_version)
             free(dbfile->pub.file_lib_version);
@@ -4517,6 +4708,68 @@ DBFlush(DBfile *dbfile)
     API_END_NOPOP; /*BEWARE: If API_RETURN above is removed use API_END */
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    DBGetIOStats
+ *
+ * Purpose:     Return the I/O counters accumulated so far for an open
+ *              file. The HDF5 driver using the silo VFD keeps the I/O
+ *              counters and the PDB driver its object cache counters.
+ *              Counters a driver does not keep are zero.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *-------------------------------------------------------------------------*/
+PUBLIC int
+DBGetIOStats(DBfile *dbfile, DBiostats *stats)
+{
+    int            retval;
+
+    API_BEGIN2("DBGetIOStats", int, -1, api_dummy) {
+        if (!dbfile)
+            API_ERROR(NULL, E_NOFILE);
+        if (!stats)
+            API_ERROR("stats", E_BADARGS);
+        if (NULL == dbfile->pub.g_iostats)
+            API_ERROR(dbfile->pub.name, E_NOTIMP);
+        memset(stats, 0, sizeof(*stats));
+        retval = (dbfile->pub.g_iostats) (dbfile, stats);
+        API_RETURN(retval);
+    }
+    API_END_NOPOP; /*BEWARE: If API_RETURN above is removed use API_END */
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    DBGetCompressionStats
+ *
+ * Purpose:     Return the compression results recorded for a dataset, the
+ *              datasets of an object or, when NAME is NULL, the whole
+ *              file. Only the HDF5 driver records them.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *-------------------------------------------------------------------------*/
+PUBLIC int
+DBGetCompressionStats(DBfile *dbfile, char const *name, DBcompressionstats *stats)
+{
+    int            retval;
+
+    API_BEGIN2("DBGetCompressionStats", int, -1, name) {
+        if (!dbfile)
+            API_ERROR(NULL, E_NOFILE);
+        if (!stats)
+            API_ERROR("stats", E_BADARGS);
+        if (name && !*name)
+            API_ERROR("name", E_BADARGS);
+        if (NULL == dbfile->pub.g_compstats)
+            API_ERROR(dbfile->pub.name, E_NOTIMP);
+        retval = (dbfile->pub.g_compstats) (dbfile, name, stats);
+        API_RETURN(retval);
+    }
+    API_END_NOPOP; /*BEWARE: If API_RETURN above is removed use API_END */
+}
+
 /*----------------------------------------------------------------------
  * Routine:  db_inq_file_has_silo_objects_r
  *
@@ -7304,7 +7557,7 @@ PUBLIC char
     int emptyCnt,                /* optional empty list size */
     int const *emptyLst)         /* optional list of empty block numbers */
 {
-    static char res[4096];
+    static SILO_THREAD_LOCAL char res[4096];
     int avail = (int) sizeof(res)-1;
 
     strcpy(res, "EMPTY");
@@ -11997,6 +12250,10 @@ db_ProcessOptlist(int objtype, DBoptlist const * const optlist)
                         _pm._alt_nodenum_vars = (char **) optlist->values[i];
                         break;
 
+                    case DBOPT_COMPRESSION:
+                        _pm._compression = (char *)optlist->values[i];
+                        break;
+
                     default:
                         unused++;
                         break;
@@ -12157,6 +12414,10 @@ db_ProcessOptlist(int objtype, DBoptlist const * const optlist)
                         _qm._alt_zonenum_vars = (char **) optlist->values[i];
                         break;
 
+                    case DBOPT_COMPRESSION:
+                        _qm._compression = (char *)optlist->values[i];
+                        break;
+
                     default:
                         unused++;
                         break;
@@ -12316,6 +12577,10 @@ db_ProcessOptlist(int objtype, DBoptlist const * const optlist)
                         _um._alt_nodenum_vars = (char **) optlist->values[i];
                         break;
 
+                    case DBOPT_COMPRESSION:
+                        _um._compression = (char *)optlist->values[i];
+                        break;
+
                     default:
                         unused++;
                         break;
@@ -12344,6 +12609,10 @@ db_ProcessOptlist(int objtype, DBoptlist const * const optlist)
                         _uzl._alt_zonenum_vars = (char **) optlist->values[i];
                         break;
 
+                    case DBOPT_COMPRESSION:
+                        _uzl._compression = (char *)optlist->values[i];
+                        break;
+
                     default:
                         unused++;
                         break;
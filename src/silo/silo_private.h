@@ -226,6 +226,7 @@ be used for advertising or product endorsement purposes.
  */
 typedef struct jstk_t {
     struct jstk_t *prev;
+    int            nlocks;      /*lock depth at time of push */
     jmp_buf        jbuf;
 } jstk_t;
 
@@ -234,8 +235,51 @@ typedef struct context_t {
     char          *name;
 } context_t;
 
-#define jstk_push()     {jstk_t*jt=ALLOC(jstk_t);jt->prev=SILO_Globals.Jstk;SILO_Globals.Jstk=jt;}
-#define jstk_pop()      if(SILO_Globals.Jstk){jstk_t*jt=SILO_Globals.Jstk;SILO_Globals.Jstk=SILO_Globals.Jstk->prev;FREE(jt);}
+/*
+ * Thread-safe builds...
+ *
+ * When Silo is configured with SILO_ENABLE_THREADSAFE, the jump stack,
+ * the error state (see DBErrno()) and a handful of scratch buffers
+ * become per-thread (SILO_THREAD_LOCAL) and each API function that
+ * takes a DBfile (API_BEGIN2) holds that file's lock for the duration
+ * of the call. Files opened read-only with a re-entrant driver (HDF5)
+ * get a lock of their own. All other files as well as DBOpen/DBCreate
+ * share a single, global lock. So, N threads can read N different
+ * files concurrently but writers and the PDB driver are serialized.
+ * Locks are recursive and are tracked on a per-thread stack so that
+ * an error which longjmp's back to the top-level API function can
+ * release any locks acquired below it. In non-threadsafe builds all
+ * of this compiles away to nothing.
+ */
+#ifdef SILO_THREADSAFE
+#ifdef _MSC_VER
+#define SILO_THREAD_LOCAL __declspec(thread)
+#else
+#define SILO_THREAD_LOCAL __thread
+#endif
+#define DB_LOCK_DEPTH()         db_lock_depth()
+#define DB_UNLOCK_TO(N)         db_unlock_to(N)
+#define DB_UNLOCK_N(N)          db_unlock_to(db_lock_depth()-(N))
+#define DB_FILE_LOCK(F)         db_file_lock(F)
+#define DB_GLOBAL_LOCK()        db_global_lock()
+#define DB_ERRNO                db_tls_errno
+#else
+#define SILO_THREAD_LOCAL
+#define DB_LOCK_DEPTH()         0
+#define DB_UNLOCK_TO(N)         ((void)(N))
+#define DB_UNLOCK_N(N)          ((void)(N))
+#define DB_FILE_LOCK(F)         0
+#define DB_GLOBAL_LOCK()        0
+#define DB_ERRNO                db_errno
+#endif
+
+extern SILO_THREAD_LOCAL jstk_t *SILO_Jstk; /*error jump stack  */
+#ifdef SILO_THREADSAFE
+extern SILO_THREAD_LOCAL int db_tls_errno;
+#endif
+
+#define jstk_push()     {jstk_t*jt=ALLOC(jstk_t);jt->prev=SILO_Jstk;jt->nlocks=DB_LOCK_DEPTH();SILO_Jstk=jt;}
+#define jstk_pop()      if(SILO_Jstk){jstk_t*jt=SILO_Jstk;SILO_Jstk=SILO_Jstk->prev;FREE(jt);}
 
 #define DEPRECATE_MSG(M,Maj,Min,Alt)                                          \
 {                                                                             \
@@ -257,9 +301,11 @@ typedef struct context_t {
 
 #define API_BEGIN(M,T,R) {                                                    \
                         char    *me = M ;                                     \
-                        static int     jstat ;                                \
-                        static context_t *jold ;                              \
+                        static SILO_THREAD_LOCAL int     jstat ;              \
+                        static SILO_THREAD_LOCAL context_t *jold ;            \
                         DBfile  *jdbfile = NULL ;                             \
+                        int      jdepth = DB_LOCK_DEPTH() ;                   \
+                        int      jlocked = 0 ;                                \
                         T jrv = R ;                                           \
                         jstat = 0 ;                                           \
                         jold = NULL ;                                         \
@@ -268,11 +314,12 @@ typedef struct context_t {
                            _nbyt = write (DBDebugAPI, M, strlen(M));          \
                            _nbyt = write (DBDebugAPI, "\n", 1);               \
                         }                                                     \
-                        if (!SILO_Globals.Jstk){                              \
+                        if (!SILO_Jstk){                                      \
                            jstk_push() ;                                      \
-                           if (setjmp(SILO_Globals.Jstk->jbuf)) {             \
-                              while (SILO_Globals.Jstk) jstk_pop () ;         \
-                              db_perror ("", db_errno, me) ;                  \
+                           if (setjmp(SILO_Jstk->jbuf)) {                     \
+                              while (SILO_Jstk) jstk_pop () ;                 \
+                              DB_UNLOCK_TO(jdepth) ;                          \
+                              db_perror ("", DB_ERRNO, me) ;                  \
                               return R ;                                      \
                            }                                                  \
                            jstat = 1 ;                                        \
@@ -284,9 +331,11 @@ typedef struct context_t {
 
 #define API_BEGIN2(M,T,R,NM) {                                                \
                         char    *me = M ;                                     \
-                        static int     jstat ;                                \
-                        static context_t *jold ;                              \
+                        static SILO_THREAD_LOCAL int     jstat ;              \
+                        static SILO_THREAD_LOCAL context_t *jold ;            \
                         DBfile  *jdbfile = dbfile ;                           \
+                        int      jdepth = DB_LOCK_DEPTH() ;                   \
+                        int      jlocked = 0 ;                                \
                         T jrv = R ;                                           \
                         jstat = 0 ;                                           \
                         jold = NULL ;                                         \
@@ -295,32 +344,38 @@ typedef struct context_t {
                             db_perror("", E_NOTREG, me);                      \
                             return R;                                         \
                         }                                                     \
+                        jlocked += DB_FILE_LOCK(jdbfile) ;                    \
                         if (DBDebugAPI>0) {                                   \
                            size_t _nbyt;                                      \
                            _nbyt = write (DBDebugAPI, M, strlen(M));          \
                            _nbyt = write (DBDebugAPI, "\n", 1);               \
                         }                                                     \
-                        if (!SILO_Globals.Jstk){                              \
+                        if (!SILO_Jstk){                                      \
                            jstk_push() ;                                      \
-                           if (setjmp(SILO_Globals.Jstk->jbuf)) {             \
+                           if (setjmp(SILO_Jstk->jbuf)) {                     \
                               if (jold) {                                     \
                                  context_restore (jdbfile, jold) ;            \
                               }                                               \
-                              while (SILO_Globals.Jstk) jstk_pop () ;         \
-                              db_perror ("", db_errno, me) ;                  \
+                              while (SILO_Jstk) jstk_pop () ;                 \
+                              DB_UNLOCK_TO(jdepth) ;                          \
+                              db_perror ("", DB_ERRNO, me) ;                  \
                               return R ;                                      \
                            }                                                  \
                            jstat = 1 ;                                        \
                            if (NM && jdbfile && !jdbfile->pub.pathok) {       \
                               char const *jr ;                                \
                               jold = context_switch (jdbfile,NM,&jr) ;        \
-                              if (!jold) longjmp (SILO_Globals.Jstk->jbuf, -1) ;\
+                              if (!jold) longjmp (SILO_Jstk->jbuf, -1) ;      \
                               NM = jr ;                                       \
                            }                                                  \
                         }
 
+/* Take the global lock for the remainder of an API_BEGIN function */
+#define API_LOCK_GLOBAL() jlocked += DB_GLOBAL_LOCK()
+
 #define API_END         if (jold) context_restore (jdbfile, jold) ;     \
                         if (jstat) jstk_pop() ;                         \
+                        DB_UNLOCK_N(jlocked) ;                          \
                      }                        /*API_BEGIN or API_BEGIN2 */
 
 #define API_END_NOPOP   }         /*API_BEGIN or API_BEGIN2 */
@@ -329,6 +384,7 @@ typedef struct context_t {
                            db_perror (S,N,me) ; /*might never return*/  \
                            if (jold) context_restore (jdbfile, jold) ;  \
                            if (jstat) jstk_pop() ;                      \
+                           DB_UNLOCK_N(jlocked) ;                       \
                            return jrv ;                                 \
                         }
 
@@ -336,13 +392,14 @@ typedef struct context_t {
                            jrv = R ; /*might be a calculation*/         \
                            if (jold) context_restore (jdbfile, jold) ;  \
                            if (jstat) jstk_pop() ;                      \
+                           DB_UNLOCK_N(jlocked) ;                       \
                            return jrv ;                                 \
                         }
 
-#define PROTECT         {jstk_push();if(!setjmp(SILO_Globals.Jstk->jbuf)){
-#define UNWIND()        longjmp(SILO_Globals.Jstk->jbuf,-1)
-#define CLEANUP         jstk_pop();}else{int jcan=0;
-#define END_PROTECT     jstk_pop();if(!jcan&&SILO_Globals.Jstk)longjmp(SILO_Globals.Jstk->jbuf,-1);}}
+#define PROTECT         {jstk_push();if(!setjmp(SILO_Jstk->jbuf)){
+#define UNWIND()        longjmp(SILO_Jstk->jbuf,-1)
+#define CLEANUP         jstk_pop();}else{int jcan=0;DB_UNLOCK_TO(SILO_Jstk->nlocks);
+#define END_PROTECT     jstk_pop();if(!jcan&&SILO_Jstk)longjmp(SILO_Jstk->jbuf,-1);}}
 #define CANCEL_UNWIND   jcan=1
 
 /*
@@ -491,6 +548,7 @@ struct _pm {
     double         _missing_value;
     char          *_ghost_node_labels;
     char         **_alt_nodenum_vars;
+    char          *_compression;
 
     /*These used only by NetCDF driver */
     int            _dim_ndims;
@@ -549,6 +607,7 @@ struct _qm {
     char          *_ghost_zone_labels;
     char         **_alt_nodenum_vars;
     char         **_alt_zonenum_vars;
+    char          *_compression;
 
     /* These are probably only used by the pdb driver */
     char           _nm_dims[64];
@@ -632,6 +691,7 @@ struct _um {
     double         _missing_value;
     char          *_ghost_node_labels;
     char         **_alt_nodenum_vars;
+    char          *_compression;
 };
 
 /*
@@ -681,6 +741,7 @@ struct _uzl {
     int            _llong_gzoneno;
     char          *_ghost_zone_labels;
     char         **_alt_zonenum_vars;
+    char          *_compression;
 };
 
 /*
@@ -847,11 +908,13 @@ typedef struct SILO_Globals_t {
     int compressionErrmode;
     int compatibilityMode;
     int evalNameschemes;
+    int extfaceThreads;
+    int readPrecision;
+    int pdbObjectCacheSize;
     const DBoptlist *fileOptionsSets[MAX_FILE_OPTIONS_SETS];
     int _db_err_level;
     void  (*_db_err_func)(char *);
     int _db_err_level_drvr;
-    jstk_t *Jstk;   /*error jump stack  */
     int unknownDriverPriorities[MAX_FILE_OPTIONS_SETS+10+1];
 } SILO_Globals_t;
 extern SILO_Globals_t SILO_Globals;
@@ -930,6 +993,12 @@ INTERNAL int   db_relative_path ( char *pathname );
 INTERNAL char *db_unsplit_path ( const db_Pathname *p );
 INTERNAL db_Pathname *db_split_path ( const char *pathname );
 INTERNAL const int *db_get_used_file_options_sets_ids();
+#ifdef SILO_THREADSAFE
+INTERNAL int db_lock_depth(void);
+INTERNAL void db_unlock_to(int depth);
+INTERNAL int db_file_lock(DBfile *);
+INTERNAL int db_global_lock(void);
+#endif
 //char   *_db_safe_strdup (const char *);
 #undef strdup /*prevent a warning for the following definition*/
 #define strdup(s) _db_safe_strdup(s)
@@ -0,0 +1,301 @@
+/*
+Copyright (C) 1994-2016 Lawrence Livermore National Security, LLC.
+LLNL-CODE-425250.
+All rights reserved.
+
+This file is part of Silo. For details, see silo.llnl.gov.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the disclaimer below.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the disclaimer (as noted
+     below) in the documentation and/or other materials provided with
+     the distribution.
+   * Neither the name of the LLNS/LLNL nor the names of its
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+THIS SOFTWARE  IS PROVIDED BY  THE COPYRIGHT HOLDERS  AND CONTRIBUTORS
+"AS  IS" AND  ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING,  BUT NOT
+LIMITED TO, THE IMPLIED  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A  PARTICULAR  PURPOSE ARE  DISCLAIMED.  IN  NO  EVENT SHALL  LAWRENCE
+LIVERMORE  NATIONAL SECURITY, LLC,  THE U.S.  DEPARTMENT OF  ENERGY OR
+CONTRIBUTORS BE LIABLE FOR  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR  CONSEQUENTIAL DAMAGES  (INCLUDING, BUT NOT  LIMITED TO,
+PROCUREMENT OF  SUBSTITUTE GOODS  OR SERVICES; LOSS  OF USE,  DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER  IN CONTRACT, STRICT LIABILITY,  OR TORT (INCLUDING
+NEGLIGENCE OR  OTHERWISE) ARISING IN  ANY WAY OUT  OF THE USE  OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+This work was produced at Lawrence Livermore National Laboratory under
+Contract No.  DE-AC52-07NA27344 with the DOE.
+
+Neither the  United States Government nor  Lawrence Livermore National
+Security, LLC nor any of  their employees, makes any warranty, express
+or  implied,  or  assumes  any  liability or  responsibility  for  the
+accuracy, completeness,  or usefulness of  any information, apparatus,
+product, or  process disclosed, or  represents that its use  would not
+infringe privately-owned rights.
+
+Any reference herein to  any specific commercial products, process, or
+services by trade name,  trademark, manufacturer or otherwise does not
+necessarily  constitute or imply  its endorsement,  recommendation, or
+favoring  by  the  United  States  Government  or  Lawrence  Livermore
+National Security,  LLC. The views  and opinions of  authors expressed
+herein do not necessarily state  or reflect those of the United States
+Government or Lawrence Livermore National Security, LLC, and shall not
+be used for advertising or product endorsement purposes.
+*/
+
+/*
+ * Slice-read latency benchmark for chunked compressed datasets.
+ *
+ * Writes a 3D double precision variable twice, once compressed as a
+ * single chunk (Silo's default) and once with "CHUNKSIZE=" so that it
+ * is split into many chunks. Then, times DBReadVarSlice reads of a
+ * single plane and of a single lineout from each and checks the values
+ * read back. Default size is small so it can run as part of the test
+ * suite. Use size=512 (1 GiB of doubles) for a meaningful comparison.
+ *
+ * With zfprate, the variables use ZFP's fixed-rate mode, whose slices
+ * are read by decoding only the ZFP blocks they touch. Slices, including
+ * a strided one, must then match the whole array read by DBReadVar
+ * exactly. Then, the whole array is read again with DBSetReadPrecision
+ * at a few bit plane counts, reporting the time and maximum error of each.
+ *
+ * Usage: chunked_slice [DB_HDF5] [gzip|zfp|zfprate] [size=<n>] [chunksize=<str>]
+ */
+
+#include <silo.h>
+#include <config.h> /* for HAVE_ZFP */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <std.c>
+
+static double
+func(int i, int j, int k)
+{
+    return sin(0.1*i) * cos(0.07*j) + 0.01*k;
+}
+
+static double
+time_slice(DBfile *dbfile, char const *vname, int const *offset,
+    int const *length, double *buf, int niters)
+{
+    int const stride[3] = {1,1,1};
+    double t0 = GetTime();
+    int it;
+
+    for (it = 0; it < niters; it++)
+        DBReadVarSlice(dbfile, vname, offset, length, stride, 3, buf);
+
+    return (GetTime() - t0) * 1e-6 / niters; /* GetTime is in micro-seconds */
+}
+
+static int
+check_slice(int const *offset, int const *length, double const *buf,
+    double tol)
+{
+    int i, j, k, n = 0, nerrors = 0;
+
+    for (k = offset[0]; k < offset[0] + length[0]; k++)
+        for (j = offset[1]; j < offset[1] + length[1]; j++)
+            for (i = offset[2]; i < offset[2] + length[2]; i++, n++)
+                if (fabs(buf[n] - func(i,j,k)) > tol)
+                    nerrors++;
+
+    return nerrors ? 1 : 0;
+}
+
+/* Compare a (possibly strided) slice with the same values of the whole
+   array, read back with DBReadVar, which must match exactly */
+static int
+check_slice_exact(DBfile *dbfile, char const *vname, int size,
+    int const *offset, int const *length, int const *stride, double *buf)
+{
+    double *whole = (double *) malloc((size_t) size * size * size * sizeof(double));
+    int i, j, k, n = 0, nerrors = 0;
+
+    if (DBReadVar(dbfile, vname, whole) != 0 ||
+        DBReadVarSlice(dbfile, vname, offset, length, stride, 3, buf) != 0)
+        nerrors++;
+    for (k = offset[0]; !nerrors && k < offset[0] + length[0]; k += stride[0])
+        for (j = offset[1]; j < offset[1] + length[1]; j += stride[1])
+            for (i = offset[2]; i < offset[2] + length[2]; i += stride[2], n++)
+                if (buf[n] != whole[((size_t) k * size + j) * size + i])
+                    nerrors++;
+    free(whole);
+
+    if (nerrors)
+        printf("slice of \"%s\" differs from the whole array\n", vname);
+    return nerrors ? 1 : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int            driver = DB_HDF5;
+    int            size = 64;
+    int            zfp = 0;
+    char const    *chunksize = "256K";
+    char           cstr[256];
+    char const    *method;
+    int            i, j, k, n, nerrors = 0;
+    int            dims[3];
+    double        *data, *buf;
+    double         tol;
+    DBfile        *dbfile;
+
+    for (i=1; i<argc; i++) {
+        if (!strncmp(argv[i], "DB_", 3)) {
+            driver = StringToDriver(argv[i]);
+        } else if (!strcmp(argv[i], "gzip")) {
+            zfp = 0;
+        } else if (!strcmp(argv[i], "zfp")) {
+            zfp = 1;
+        } else if (!strcmp(argv[i], "zfprate")) {
+            zfp = 2;
+        } else if (!strncmp(argv[i], "size=", 5)) {
+            size = (int) strtol(argv[i]+5, 0, 10);
+        } else if (!strncmp(argv[i], "chunksize=", 10)) {
+            chunksize = argv[i]+10;
+        } else if (argv[i][0] != '\0') {
+            fprintf(stderr, "%s: ignored argument `%s'\n", argv[0], argv[i]);
+        }
+    }
+
+    if ((driver&0xF) != DB_HDF5)
+    {
+        fprintf(stderr, "This test only applies to HDF5 driver\n");
+        CleanupDriverStuff();
+        return skip_retval;
+    }
+#ifndef HAVE_ZFP
+    if (zfp)
+    {
+        fprintf(stderr, "ZFP not available\n");
+        CleanupDriverStuff();
+        return skip_retval;
+    }
+#endif
+
+    dims[0] = dims[1] = dims[2] = size;
+    data = (double *) malloc((size_t) size * size * size * sizeof(double));
+    buf = (double *) malloc((size_t) size * size * sizeof(double));
+    for (k = 0, n = 0; k < size; k++)
+        for (j = 0; j < size; j++)
+            for (i = 0; i < size; i++, n++)
+                data[n] = func(i,j,k);
+
+    /* ZFP is lossy; gzip must be exact */
+    tol = zfp == 2 ? 1e-3 : zfp ? 1e-4 : 0;
+    method = zfp == 2 ? "METHOD=ZFP RATE=16" : zfp ? "METHOD=ZFP ACCURACY=0.00001" : "METHOD=GZIP";
+
+    dbfile = DBCreate("chunked_slice.h5", DB_CLOBBER, DB_LOCAL, "chunked slice test", driver);
+
+    snprintf(cstr, sizeof(cstr), "%s", method);
+    DBSetCompression(cstr);
+    nerrors += DBWrite(dbfile, "whole", data, dims, 3, DB_DOUBLE) != 0;
+
+    snprintf(cstr, sizeof(cstr), "%s CHUNKSIZE=%s", method, chunksize);
+    DBSetCompression(cstr);
+    nerrors += DBWrite(dbfile, "chunked", data, dims, 3, DB_DOUBLE) != 0;
+
+    DBSetCompression(0);
+    DBClose(dbfile);
+    free(data);
+
+    dbfile = DBOpen("chunked_slice.h5", DB_UNKNOWN, DB_READ);
+    {
+        int const niters = size > 256 ? 3 : 10;
+        int const plane_off[3] = {size/2, 0, 0};
+        int const plane_len[3] = {1, size, size};
+        int const line_off[3] = {size/3, size/2, 0};
+        int const line_len[3] = {1, 1, size};
+        double tw, tc;
+
+        printf("%d^3 doubles (%g MiB), %s, CHUNKSIZE=%s\n", size,
+            (double) size * size * size * sizeof(double) / (1<<20),
+            zfp == 2 ? "zfp fixed-rate" : zfp ? "zfp" : "gzip", chunksize);
+        printf("%-10s %14s %14s %10s\n", "slice", "whole (sec)", "chunked (sec)", "speedup");
+
+        tw = time_slice(dbfile, "whole", plane_off, plane_len, buf, niters);
+        nerrors += check_slice(plane_off, plane_len, buf, tol);
+        tc = time_slice(dbfile, "chunked", plane_off, plane_len, buf, niters);
+        nerrors += check_slice(plane_off, plane_len, buf, tol);
+        printf("%-10s %14.6f %14.6f %10.2f\n", "plane", tw, tc, tc > 0 ? tw / tc : 0);
+
+        tw = time_slice(dbfile, "whole", line_off, line_len, buf, niters);
+        nerrors += check_slice(line_off, line_len, buf, tol);
+        tc = time_slice(dbfile, "chunked", line_off, line_len, buf, niters);
+        nerrors += check_slice(line_off, line_len, buf, tol);
+        printf("%-10s %14.6f %14.6f %10.2f\n", "lineout", tw, tc, tc > 0 ? tw / tc : 0);
+
+        if (zfp == 2)
+        {
+            int const one[3] = {1, 1, 1};
+            int const sub_off[3] = {size/4+1, 3, size/5};
+            int const sub_len[3] = {size/2, size/3, size/2};
+            int const sub_str[3] = {3, 2, 5};
+
+            nerrors += check_slice_exact(dbfile, "whole", size, plane_off, plane_len, one, buf);
+            nerrors += check_slice_exact(dbfile, "chunked", size, line_off, line_len, one, buf);
+            nerrors += check_slice_exact(dbfile, "whole", size, sub_off, sub_len, sub_str, buf);
+            nerrors += check_slice_exact(dbfile, "chunked", size, sub_off, sub_len, sub_str, buf);
+        }
+    }
+
+    /* Reads decoding only the leading bit planes must be approximately
+       right, and slices must be exact parts of the same approximation */
+    if (zfp == 2)
+    {
+        int const planes[] = {8, 16, 0};
+        int const sub_off[3] = {size/4+1, 3, size/5};
+        int const sub_len[3] = {size/2, size/3, size/2};
+        int const sub_str[3] = {3, 2, 5};
+        double *whole = (double *) malloc((size_t) size * size * size * sizeof(double));
+        double maxerr[3];
+        int p;
+
+        printf("%-10s %14s %14s\n", "planes", "read (sec)", "max error");
+        for (p = 0; p < 3; p++)
+        {
+            double t0;
+
+            DBSetReadPrecision(planes[p]);
+            t0 = GetTime();
+            nerrors += DBReadVar(dbfile, "whole", whole) != 0;
+            t0 = (GetTime() - t0) * 1e-6;
+            maxerr[p] = 0;
+            for (k = 0, n = 0; k < size; k++)
+                for (j = 0; j < size; j++)
+                    for (i = 0; i < size; i++, n++)
+                        if (fabs(whole[n] - func(i,j,k)) > maxerr[p])
+                            maxerr[p] = fabs(whole[n] - func(i,j,k));
+            printf("%-10d %14.6f %14.3g\n", planes[p], t0, maxerr[p]);
+            nerrors += check_slice_exact(dbfile, "chunked", size, sub_off, sub_len, sub_str, buf);
+        }
+        DBSetReadPrecision(0);
+        free(whole);
+
+        /* Fewer planes, more error, but still in the ballpark */
+        if (!(maxerr[0] > maxerr[1] && maxerr[1] >= maxerr[2] && maxerr[0] < 0.5))
+        {
+            printf("unexpected reduced precision errors\n");
+            nerrors++;
+        }
+    }
+    DBClose(dbfile);
+    free(buf);
+
+    CleanupDriverStuff();
+    return nerrors;
+}
@@ -0,0 +1,249 @@
+/*
+Copyright (C) 1994-2016 Lawrence Livermore National Security, LLC.
+LLNL-CODE-425250.
+All rights reserved.
+
+This file is part of Silo. For details, see silo.llnl.gov.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the disclaimer below.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the disclaimer (as noted
+     below) in the documentation and/or other materials provided with
+     the distribution.
+   * Neither the name of the LLNS/LLNL nor the names of its
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+THIS SOFTWARE  IS PROVIDED BY  THE COPYRIGHT HOLDERS  AND CONTRIBUTORS
+"AS  IS" AND  ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING,  BUT NOT
+LIMITED TO, THE IMPLIED  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A  PARTICULAR  PURPOSE ARE  DISCLAIMED.  IN  NO  EVENT SHALL  LAWRENCE
+LIVERMORE  NATIONAL SECURITY, LLC,  THE U.S.  DEPARTMENT OF  ENERGY OR
+CONTRIBUTORS BE LIABLE FOR  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR  CONSEQUENTIAL DAMAGES  (INCLUDING, BUT NOT  LIMITED TO,
+PROCUREMENT OF  SUBSTITUTE GOODS  OR SERVICES; LOSS  OF USE,  DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER  IN CONTRACT, STRICT LIABILITY,  OR TORT (INCLUDING
+NEGLIGENCE OR  OTHERWISE) ARISING IN  ANY WAY OUT  OF THE USE  OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+This work was produced at Lawrence Livermore National Laboratory under
+Contract No.  DE-AC52-07NA27344 with the DOE.
+
+Neither the  United States Government nor  Lawrence Livermore National
+Security, LLC nor any of  their employees, makes any warranty, express
+or  implied,  or  assumes  any  liability or  responsibility  for  the
+accuracy, completeness,  or usefulness of  any information, apparatus,
+product, or  process disclosed, or  represents that its use  would not
+infringe privately-owned rights.
+
+Any reference herein to  any specific commercial products, process, or
+services by trade name,  trademark, manufacturer or otherwise does not
+necessarily  constitute or imply  its endorsement,  recommendation, or
+favoring  by  the  United  States  Government  or  Lawrence  Livermore
+National Security,  LLC. The views  and opinions of  authors expressed
+herein do not necessarily state  or reflect those of the United States
+Government or Lawrence Livermore National Security, LLC, and shall not
+be used for advertising or product endorsement purposes.
+*/
+
+/*
+ * Test generation of names of datasets in the HDF5 driver's /.silo link
+ * group. The counter used to generate these names is held in memory and
+ * written to the `nlinks' attribute only at flush/close. This test makes
+ * sure the counter is persisted at close and picked up again on re-open
+ * for append, that names remain unique when the attribute is stale and
+ * that the counter may go past the old limit of 999999.
+ */
+
+#include <silo.h>
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_HDF5_H
+#include <hdf5.h>
+#endif
+
+#include <std.c>
+
+#define NPTS 10
+
+static int
+put_curves(DBfile *dbfile, int first, int n)
+{
+    float x[NPTS], y[NPTS];
+    int i, j, nerrors = 0;
+
+    for (i = first; i < first + n; i++)
+    {
+        char name[32];
+        for (j = 0; j < NPTS; j++)
+        {
+            x[j] = (float) j;
+            y[j] = (float) (i * NPTS + j);
+        }
+        sprintf(name, "curve%d", i);
+        nerrors += DBPutCurve(dbfile, name, x, y, DB_FLOAT, NPTS, 0) != 0;
+    }
+
+    return nerrors;
+}
+
+#ifdef HAVE_HDF5_H
+static long long
+get_nlinks(char const *fname)
+{
+    long long nlinks = -1;
+    hid_t fid = H5Fopen(fname, H5F_ACC_RDONLY, H5P_DEFAULT);
+    hid_t grp = H5Gopen(fid, "/.silo", H5P_DEFAULT);
+    hid_t attr = H5Aopen_name(grp, "nlinks");
+    H5Aread(attr, H5T_NATIVE_LLONG, &nlinks);
+    H5Aclose(attr);
+    H5Gclose(grp);
+    H5Fclose(fid);
+    return nlinks;
+}
+
+static void
+set_nlinks(char const *fname, int nlinks)
+{
+    hid_t fid = H5Fopen(fname, H5F_ACC_RDWR, H5P_DEFAULT);
+    hid_t grp = H5Gopen(fid, "/.silo", H5P_DEFAULT);
+    hid_t attr = H5Aopen_name(grp, "nlinks");
+    H5Awrite(attr, H5T_NATIVE_INT, &nlinks);
+    H5Aclose(attr);
+    H5Gclose(grp);
+    H5Fclose(fid);
+}
+#endif
+
+static int
+check_curves(DBfile *dbfile, int n)
+{
+    int i, j, nerrors = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        char name[32];
+        DBcurve *c;
+
+        sprintf(name, "curve%d", i);
+        if (!(c = DBGetCurve(dbfile, name)) || c->npts != NPTS)
+        {
+            nerrors++;
+            DBFreeCurve(c);
+            continue;
+        }
+        for (j = 0; j < NPTS; j++)
+        {
+            if (((float*)c->x)[j] != (float) j ||
+                ((float*)c->y)[j] != (float) (i * NPTS + j))
+            {
+                nerrors++;
+                break;
+            }
+        }
+        DBFreeCurve(c);
+    }
+
+    return nerrors;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int            driver = DB_HDF5;
+    int            i, nerrors = 0;
+    int            show_all_errors = FALSE;
+    long long      nlinks;
+    DBfile        *dbfile;
+
+    for (i=1; i<argc; i++) {
+        if (!strncmp(argv[i], "DB_", 3)) {
+            driver = StringToDriver(argv[i]);
+        } else if (!strcmp(argv[i], "show-all-errors")) {
+            show_all_errors = TRUE;
+        } else if (argv[i][0] != '\0') {
+            fprintf(stderr, "%s: ignored argument `%s'\n", argv[0], argv[i]);
+        }
+    }
+
+#ifdef HAVE_HDF5_H
+    if ((driver&0xF) != DB_HDF5)
+#endif
+    {
+        fprintf(stderr, "This test only applies to HDF5 driver\n");
+        CleanupDriverStuff();
+        return skip_retval;
+    }
+
+#ifdef HAVE_HDF5_H
+    if (show_all_errors) DBShowErrors(DB_ALL_AND_DRVR, 0);
+
+    /* Each curve writes 2 datasets to the link group */
+    dbfile = DBCreate("compname.h5", DB_CLOBBER, DB_LOCAL, "compname test", driver);
+    nerrors += put_curves(dbfile, 0, 5);
+    DBClose(dbfile);
+
+    nlinks = get_nlinks("compname.h5");
+    if (nlinks < 10) /* 5 curves plus any TOC indices */
+    {
+        fprintf(stderr, "expected nlinks>=10, got %lld\n", nlinks);
+        nerrors++;
+    }
+
+    /* Append more and make sure the counter is reloaded and saved again */
+    dbfile = DBOpen("compname.h5", driver, DB_APPEND);
+    nerrors += put_curves(dbfile, 5, 5);
+    DBClose(dbfile);
+    if (get_nlinks("compname.h5") != nlinks + 10)
+    {
+        fprintf(stderr, "expected nlinks=%lld, got %lld\n", nlinks + 10,
+            get_nlinks("compname.h5"));
+        nerrors++;
+    }
+    nlinks += 10;
+
+    /* A stale attribute must not cause names to collide */
+    set_nlinks("compname.h5", 3);
+    dbfile = DBOpen("compname.h5", driver, DB_APPEND);
+    nerrors += put_curves(dbfile, 10, 5);
+    DBClose(dbfile);
+    if (get_nlinks("compname.h5") != nlinks + 10)
+    {
+        fprintf(stderr, "expected nlinks=%lld after stale attribute, got %lld\n",
+            nlinks + 10, get_nlinks("compname.h5"));
+        nerrors++;
+    }
+
+    /* Bump the counter near the old limit */
+    set_nlinks("compname.h5", 999998);
+
+    dbfile = DBOpen("compname.h5", driver, DB_APPEND);
+    nerrors += put_curves(dbfile, 15, 5);
+    DBClose(dbfile);
+
+    {
+        hid_t fid = H5Fopen("compname.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+        if (H5Lexists(fid, "/.silo/#1000008", H5P_DEFAULT) <= 0)
+        {
+            fprintf(stderr, "expected dataset /.silo/#1000008 not found\n");
+            nerrors++;
+        }
+        H5Fclose(fid);
+    }
+
+    dbfile = DBOpen("compname.h5", driver, DB_READ);
+    nerrors += check_curves(dbfile, 20);
+    DBClose(dbfile);
+#endif
+
+    CleanupDriverStuff();
+    return nerrors;
+}
@@ -68,12 +68,513 @@ be used for advertising or product endorsement purposes.
 #endif
 #include <stdlib.h>
 
+#include <hdf5.h>
+
 #define GNU_AUTOTEST_SKIP_CODE 77
 #define ONE_MEG 1048576
 #define ITERATE 50
 
 #include <std.c>
 
+/*-------------------------------------------------------------------------
+ * Function:        compare_raw_chunks
+ *
+ * Purpose:         Check that the 1D dataset name is stored the same in
+ *                  both files: the same size and, where HDF5 can read raw
+ *                  chunks, the same bytes and filter mask in every chunk.
+ *
+ * Return:          Number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+compare_raw_chunks(char const *files[2], char const *name)
+{
+    int nerrors = 0, pass;
+    hid_t fid[2] = {-1, -1}, dset[2] = {-1, -1};
+    hsize_t size[2] = {0, 0};
+
+    for (pass = 0; pass < 2; pass++)
+    {
+        if ((fid[pass] = H5Fopen(files[pass], H5F_ACC_RDONLY, H5P_DEFAULT)) < 0 ||
+            (dset[pass] = H5Dopen(fid[pass], name, H5P_DEFAULT)) < 0)
+        {
+            printf("Unable to open \"%s\" in `%s' with HDF5\n", name, files[pass]);
+            nerrors++;
+        }
+        else
+            size[pass] = H5Dget_storage_size(dset[pass]);
+    }
+    if (!nerrors && size[0] != size[1])
+    {
+        printf("\"%s\" takes %llu bytes threaded and %llu bytes unthreaded\n", name,
+            (unsigned long long) size[1], (unsigned long long) size[0]);
+        nerrors++;
+    }
+#if H5_VERSION_GE(1,10,3)
+    if (!nerrors)
+    {
+        hsize_t chunk, dims, off;
+        hid_t dcpl = H5Dget_create_plist(dset[0]), space = H5Dget_space(dset[0]);
+        char *raw[2] = {0, 0};
+
+        if (H5Pget_chunk(dcpl, 1, &chunk) != 1 || H5Sget_simple_extent_dims(space, &dims, 0) != 1)
+            nerrors++;
+        for (pass = 0; !nerrors && pass < 2; pass++)
+            raw[pass] = (char *) malloc(2 * chunk * sizeof(double));
+        for (off = 0; !nerrors && off < dims; off += chunk)
+        {
+            hsize_t nbytes[2];
+            uint32_t mask[2];
+
+            for (pass = 0; pass < 2; pass++)
+                if (H5Dget_chunk_storage_size(dset[pass], &off, &nbytes[pass]) < 0 ||
+                    nbytes[pass] > 2 * chunk * sizeof(double) ||
+                    H5Dread_chunk(dset[pass], H5P_DEFAULT, &off, &mask[pass], raw[pass]) < 0)
+                    nerrors++;
+            if (!nerrors && (nbytes[0] != nbytes[1] || mask[0] != mask[1] ||
+                             memcmp(raw[0], raw[1], (size_t) nbytes[0])))
+            {
+                printf("Chunk at %llu is stored differently threaded\n", (unsigned long long) off);
+                nerrors++;
+            }
+        }
+        free(raw[0]);
+        free(raw[1]);
+        H5Sclose(space);
+        H5Pclose(dcpl);
+    }
+#endif
+    for (pass = 0; pass < 2; pass++)
+    {
+        if (dset[pass] >= 0) H5Dclose(dset[pass]);
+        if (fid[pass] >= 0) H5Fclose(fid[pass]);
+    }
+    return nerrors;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:        compare_threaded_write
+ *
+ * Purpose:         Write the same large array with the current compression
+ *                  settings, first compressed by HDF5 alone and then with
+ *                  chunks compressed on nthreads threads, and report the
+ *                  write throughput of each. Both files are read back and
+ *                  must hold identical data. With GZIP, the first megabyte
+ *                  is random, so its chunk does not compress, and every
+ *                  chunk must be stored byte for byte as HDF5 stored it.
+ *
+ * Return:          Number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+compare_threaded_write(int driver, int nthreads, int verbose)
+{
+    int            nerrors = 0;
+    int            i, pass;
+    int            dims[] = {32*ONE_MEG/sizeof(double)};
+    double        *val = (double*) malloc(dims[0] * sizeof(double));
+    double        *rval[2];
+    double         mbps[2] = {0, 0};
+    char const    *files[2] = {"compression_st.h5", "compression_mt.h5"};
+    char           cstr[256], mtcstr[256];
+
+    if (!DBGetCompression())
+        DBSetCompression("METHOD=GZIP");
+    /* Same chunking both ways; threads need more than one chunk */
+    snprintf(cstr, sizeof(cstr), "%s%s", DBGetCompression(),
+        strstr(DBGetCompression(), "CHUNKSIZE=") ? "" : " CHUNKSIZE=1M");
+    snprintf(mtcstr, sizeof(mtcstr), "%s NTHREADS=%d", cstr, nthreads);
+
+    srandom(0xDeadBeef);
+    for (i = 0; i < dims[0]; i++)
+    {
+        double x = 2 * M_PI * (double) i / (double) (dims[0]-1);
+        val[i] = 1 + sin(x) + 0.3 * ((double) random() / ((double)((long long)1<<31)-1) - 0.5);
+    }
+    if (strstr(cstr, "METHOD=GZIP"))
+        for (i = 0; i < ONE_MEG; i++)
+            ((unsigned char *) val)[i] = (unsigned char) (random() >> 8);
+
+    for (pass = 0; pass < 2; pass++)
+    {
+        DBfile *dbfile;
+#if !defined(_WIN32)
+        struct timeval tim;
+        double t1, t2;
+#endif
+
+        DBSetCompression(pass ? mtcstr : cstr);
+        if (verbose)
+            printf("Writing `%s' with \"%s\"\n", files[pass], DBGetCompression());
+        dbfile = DBCreate(files[pass], DB_CLOBBER, DB_LOCAL, "Threaded Compression Test", driver);
+#if !defined(_WIN32)
+        gettimeofday(&tim, NULL);
+        t1=tim.tv_sec+(tim.tv_usec/1000000.0);
+#endif
+        if (!dbfile || DBWrite(dbfile, "bigvar", val, dims, 1, DB_DOUBLE) < 0)
+        {
+            if (DBErrno() == E_COMPRESSION)
+            {
+                free(val);
+                return GNU_AUTOTEST_SKIP_CODE;
+            }
+            nerrors++;
+        }
+#if !defined(_WIN32)
+        gettimeofday(&tim, NULL);
+        t2=tim.tv_sec+(tim.tv_usec/1000000.0);
+        mbps[pass] = dims[0] * sizeof(double) / (t2-t1) / ONE_MEG;
+#endif
+        if (dbfile) DBClose(dbfile);
+    }
+    DBSetCompression(cstr);
+
+    printf("%d thread(s): %.1f MB/s, %d threads: %.1f MB/s, speedup %.2f\n",
+        1, mbps[0], nthreads, mbps[1], mbps[0] > 0 ? mbps[1] / mbps[0] : 0);
+
+    /* Threaded compression must produce the same data HDF5 does */
+    for (pass = 0; pass < 2; pass++)
+    {
+        DBfile *dbfile = DBOpen(files[pass], driver, DB_READ);
+        rval[pass] = (double*) calloc(dims[0], sizeof(double));
+        if (!dbfile || DBReadVar(dbfile, "bigvar", rval[pass]) < 0)
+        {
+            printf("Unable to read \"bigvar\" from `%s'\n", files[pass]);
+            nerrors++;
+        }
+        if (dbfile) DBClose(dbfile);
+    }
+    if (memcmp(rval[0], rval[1], dims[0] * sizeof(double)))
+    {
+        printf("Threaded and unthreaded writes read back differently\n");
+        nerrors++;
+    }
+    nerrors += compare_raw_chunks(files, "bigvar");
+
+    free(val);
+    free(rval[0]);
+    free(rval[1]);
+    return nerrors;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:        compare_zfp_execution
+ *
+ * Purpose:         Write one large 3D array compressed by ZFP as a single
+ *                  chunk, serially and then with ZFP's OpenMP encoder on
+ *                  1, 2, 4, ... maxthreads threads, and report the write
+ *                  throughput of each. Every file must read back the same
+ *                  data as the serial one.
+ *
+ * Return:          Number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+compare_zfp_execution(int driver, int maxthreads, int verbose)
+{
+    int            nerrors = 0;
+    int            i, j, k, n, nthreads;
+    int            dims[] = {160, 160, 160};
+    size_t         nvals = (size_t) dims[0] * dims[1] * dims[2];
+    double        *val = (double*) malloc(nvals * sizeof(double));
+    double        *rval0 = (double*) calloc(nvals, sizeof(double));
+    double        *rval = (double*) calloc(nvals, sizeof(double));
+    double         mbps0 = 0;
+    char const    *filename = "compression_zfpexec.h5";
+    char           cstr[256];
+
+    for (k = n = 0; k < dims[2]; k++)
+        for (j = 0; j < dims[1]; j++)
+            for (i = 0; i < dims[0]; i++, n++)
+                val[n] = sin(0.1 * i) * cos(0.07 * j) + 0.01 * k;
+
+    /* nthreads of -1 is the serial pass everything is compared against */
+    for (nthreads = -1; nthreads <= maxthreads; nthreads = nthreads < 1 ? 1 : 2 * nthreads)
+    {
+        DBfile *dbfile;
+        double mbps = 0;
+#if !defined(_WIN32)
+        struct timeval tim;
+        double t1, t2;
+#endif
+
+        if (nthreads < 0)
+            snprintf(cstr, sizeof(cstr), "METHOD=ZFP RATE=8 EXEC=SERIAL");
+        else
+            snprintf(cstr, sizeof(cstr), "METHOD=ZFP RATE=8 EXEC=OMP OMP_THREADS=%d", nthreads);
+        DBSetCompression(cstr);
+        if (verbose)
+            printf("Writing `%s' with \"%s\"\n", filename, DBGetCompression());
+        dbfile = DBCreate(filename, DB_CLOBBER, DB_LOCAL, "ZFP Execution Test", driver);
+#if !defined(_WIN32)
+        gettimeofday(&tim, NULL);
+        t1=tim.tv_sec+(tim.tv_usec/1000000.0);
+#endif
+        if (!dbfile || DBWrite(dbfile, "bigvar", val, dims, 3, DB_DOUBLE) < 0)
+        {
+            if (DBErrno() == E_COMPRESSION)
+            {
+                nerrors = GNU_AUTOTEST_SKIP_CODE;
+                break;
+            }
+            nerrors++;
+        }
+#if !defined(_WIN32)
+        gettimeofday(&tim, NULL);
+        t2=tim.tv_sec+(tim.tv_usec/1000000.0);
+        mbps = nvals * sizeof(double) / (t2-t1) / ONE_MEG;
+#endif
+        if (dbfile) DBClose(dbfile);
+
+        if (nthreads < 0)
+        {
+            mbps0 = mbps;
+            printf("serial: %.1f MB/s\n", mbps);
+        }
+        else
+        {
+            printf("%d OpenMP thread(s): %.1f MB/s, speedup %.2f\n",
+                nthreads, mbps, mbps0 > 0 ? mbps / mbps0 : 0);
+        }
+
+        /* The parallel encoder must produce the data the serial one does */
+        dbfile = DBOpen(filename, driver, DB_READ);
+        if (!dbfile || DBReadVar(dbfile, "bigvar", nthreads < 0 ? rval0 : rval) < 0)
+        {
+            printf("Unable to read \"bigvar\" from `%s'\n", filename);
+            nerrors++;
+        }
+        if (dbfile) DBClose(dbfile);
+        if (nthreads >= 0 && memcmp(rval0, rval, nvals * sizeof(double)))
+        {
+            printf("%d OpenMP thread(s) and serial writes read back differently\n", nthreads);
+            nerrors++;
+        }
+    }
+    DBSetCompression(0);
+
+    free(val);
+    free(rval0);
+    free(rval);
+    return nerrors;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:        check_object_compression
+ *
+ * Purpose:         Write objects whose DBOPT_COMPRESSION overrides the
+ *                  file's compression string and check each array was
+ *                  compressed as its object asked and reads back intact.
+ *
+ * Return:          Number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+check_object_compression(int driver, int verbose)
+{
+    char const    *filecstr = "METHOD=GZIP LEVEL=1";
+    char const    *varnames[] = {"qv_default", "qv_none", "qv_gzip9"};
+    char const    *varcstrs[] = {0, "", "METHOD=GZIP LEVEL=9"};
+    char const    *coordnames[] = {"x", "y"};
+    int            nerrors = 0, i, j, k;
+    int            dims[] = {256, 256}, zdims[] = {255, 255};
+    int            nzones = zdims[0] * zdims[1], lnodelist = 4 * nzones;
+    int            shapetype = DB_ZONETYPE_QUAD, shapesize = 4;
+    int            adims[] = {65536};
+    float          x[256], y[256], *coords[2] = {x, y};
+    float         *var = (float*) malloc(dims[0] * dims[1] * sizeof(float));
+    float         *rvar = (float*) malloc(dims[0] * dims[1] * sizeof(float));
+    int           *nodelist = (int*) malloc(lnodelist * sizeof(int));
+    DBcompressionstats cs;
+    DBfile        *dbfile;
+
+    DBSetCompression(filecstr);
+    dbfile = DBCreate("compression_obj.h5", DB_CLOBBER, DB_LOCAL,
+        "Per-object Compression Test", driver);
+    for (i = 0; i < dims[0]; i++)
+        x[i] = y[i] = (float) i;
+    for (j = 0; j < dims[1]; j++)
+        for (i = 0; i < dims[0]; i++)
+            var[j*dims[0]+i] = (float) ((i % 17) * (j % 13));
+    DBPutQuadmesh(dbfile, "qmesh", coordnames, coords, dims, 2, DB_FLOAT,
+        DB_COLLINEAR, 0);
+    for (k = 0; k < 3; k++)
+    {
+        DBoptlist *opts = DBMakeOptlist(1);
+        if (varcstrs[k])
+            DBAddOption(opts, DBOPT_COMPRESSION, (void*) varcstrs[k]);
+        DBPutQuadvar1(dbfile, varnames[k], "qmesh", var, dims, 2, 0, 0,
+            DB_FLOAT, DB_NODECENT, opts);
+        DBFreeOptlist(opts);
+    }
+    for (j = 0, k = 0; j < zdims[1]; j++)
+    {
+        for (i = 0; i < zdims[0]; i++)
+        {
+            nodelist[k++] = j*dims[0]+i;
+            nodelist[k++] = j*dims[0]+i+1;
+            nodelist[k++] = (j+1)*dims[0]+i+1;
+            nodelist[k++] = (j+1)*dims[0]+i;
+        }
+    }
+    {
+        DBoptlist *opts = DBMakeOptlist(1);
+        DBAddOption(opts, DBOPT_COMPRESSION, (void*) "METHOD=GZIP LEVEL=5");
+        DBPutZonelist2(dbfile, "zl", nzones, 2, nodelist, lnodelist, 0, 0, 0,
+            &shapetype, &shapesize, &nzones, 1, opts);
+        DBFreeOptlist(opts);
+    }
+    /* the file's string applies again once the objects are written */
+    DBWrite(dbfile, "after", var, adims, 1, DB_FLOAT);
+
+    for (k = 0; k < 5; k++)
+    {
+        char const *name = k < 3 ? varnames[k] : k == 3 ? "zl" : "after";
+        char const *want = k < 3 ? varcstrs[k] : k == 3 ? "METHOD=GZIP LEVEL=5" : 0;
+        if (!want) want = filecstr;
+        if (DBGetCompressionStats(dbfile, name, &cs) < 0 ||
+            (*want ? (cs.ncompressed != cs.ndatasets || strcmp(cs.method, want))
+                   : (cs.ncompressed != 0 || cs.stored_bytes != cs.original_bytes)))
+        {
+            printf("\"%s\" not compressed with \"%s\" (got \"%s\", %d of %d)\n",
+                name, want, cs.method, cs.ncompressed, cs.ndatasets);
+            nerrors++;
+        }
+        else if (verbose)
+            printf("%s: %lld bytes stored as %lld, \"%s\"\n", name,
+                cs.original_bytes, cs.stored_bytes, cs.method);
+    }
+
+    /* later writes to an array bring its statistics up to date */
+    for (k = 0; k < 2; k++)
+    {
+        int offset = k * adims[0] / 2, length = adims[0] / 2, stride = 1;
+        DBcompressionstats cs0 = cs;
+        DBWriteSlice(dbfile, "sliced", var + offset, DB_FLOAT, &offset, &length,
+            &stride, adims, 1);
+        if (DBGetCompressionStats(dbfile, "sliced", &cs) < 0 ||
+            cs.ncompressed != 1 || cs.original_bytes != adims[0] * (long long) sizeof(float) ||
+            (k && (cs.stored_bytes <= cs0.stored_bytes || cs.write_time <= cs0.write_time)))
+        {
+            printf("\"sliced\" statistics not updated by slice %d\n", k);
+            nerrors++;
+        }
+        else if (verbose)
+            printf("sliced: %lld bytes stored as %lld after slice %d\n",
+                cs.original_bytes, cs.stored_bytes, k);
+    }
+    DBClose(dbfile);
+
+    dbfile = DBOpen("compression_obj.h5", driver, DB_READ);
+    for (k = 0; dbfile && k < 3; k++)
+    {
+        DBquadvar *qv = DBGetQuadvar(dbfile, varnames[k]);
+        if (!qv || memcmp(qv->vals[0], var, dims[0] * dims[1] * sizeof(float)))
+        {
+            printf("\"%s\" reads back differently\n", varnames[k]);
+            nerrors++;
+        }
+        DBFreeQuadvar(qv);
+    }
+    if (!dbfile || DBReadVar(dbfile, "after", rvar) < 0 ||
+        memcmp(rvar, var, adims[0] * sizeof(float)))
+    {
+        printf("\"after\" reads back differently\n");
+        nerrors++;
+    }
+    if (dbfile) DBClose(dbfile);
+
+    free(var);
+    free(rvar);
+    free(nodelist);
+    return nerrors;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:        check_auto_choices
+ *
+ * Purpose:         Under METHOD=AUTO, check that each array written records
+ *                  the codec chosen for it in its "silo_compression"
+ *                  attribute.
+ *
+ * Return:          Number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+check_auto_choices(char const *filename, int verbose)
+{
+    int nerrors = 0, j;
+    hid_t fid = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT);
+
+    for (j = 0; fid >= 0 && j < ITERATE; j++)
+    {
+        char tmpname[64], choice[256] = "";
+        hid_t dset, attr = -1, atype = -1;
+
+        sprintf(tmpname, "compression_%04d", j);
+        if ((dset = H5Dopen(fid, tmpname, H5P_DEFAULT)) >= 0 &&
+            (attr = H5Aopen(dset, "silo_compression", H5P_DEFAULT)) >= 0 &&
+            (atype = H5Aget_type(attr)) >= 0 && H5Tget_size(atype) < sizeof(choice))
+            H5Aread(attr, atype, choice);
+        if (strncmp(choice, "METHOD=", 7) || strstr(choice, "METHOD=AUTO"))
+        {
+            printf("No codec recorded for \"%s\"\n", tmpname);
+            nerrors++;
+        }
+        else if (verbose || j == 0)
+            printf("%s: %s\n", tmpname, choice);
+        if (atype >= 0) H5Tclose(atype);
+        if (attr >= 0) H5Aclose(attr);
+        if (dset >= 0) H5Dclose(dset);
+    }
+    if (fid < 0)
+        nerrors++;
+    else
+        H5Fclose(fid);
+    return nerrors;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:        check_compression_stats
+ *
+ * Purpose:         Check the compression statistics DBGetCompressionStats
+ *                  returns for one array and for the whole file.
+ *
+ * Return:          Number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+check_compression_stats(DBfile *dbfile, long long nbytes, int verbose)
+{
+    DBcompressionstats cs;
+    int nerrors = 0;
+
+    if (DBGetCompressionStats(dbfile, "compression_0000", &cs) < 0 ||
+        cs.ndatasets != 1 || cs.ncompressed != 1 ||
+        cs.original_bytes != nbytes || cs.stored_bytes <= 0 ||
+        strncmp(cs.method, "METHOD=", 7))
+    {
+        printf("Bad compression statistics for \"compression_0000\"\n");
+        nerrors++;
+    }
+    if (DBGetCompressionStats(dbfile, 0, &cs) < 0 ||
+        cs.ncompressed != ITERATE || cs.original_bytes < ITERATE * nbytes)
+    {
+        printf("Bad compression statistics for the file\n");
+        nerrors++;
+    }
+    else if (verbose)
+        printf("%lld bytes stored as %lld in %g seconds, %s\n", cs.original_bytes,
+            cs.stored_bytes, cs.write_time, cs.method);
+    return nerrors;
+}
+
 /*-------------------------------------------------------------------------
  * Function:        main
  *
@@ -119,6 +620,10 @@ main(int argc, char *argv[])
     int            show_errors = DB_TOP;
     double         noise = 0.3;
     int            compat = DB_COMPAT_OVER_PERF;
+    int            nthreads = 0;
+    int            mtcompare = 0;
+    int            optlist = 0;
+    int            zfpexec = 0;
 
     /* Parse command-line */
     for (i=1; i<argc; i++) {
@@ -144,6 +649,10 @@ main(int argc, char *argv[])
           DBSetCompression("METHOD=GZIP LEVEL=9");
        } else if (!strcmp(argv[i], "fpzip")) {
           DBSetCompression("METHOD=FPZIP");
+       } else if (!strcmp(argv[i], "auto")) {
+          DBSetCompression("METHOD=AUTO");
+       } else if (!strcmp(argv[i], "autospeed")) {
+          DBSetCompression("METHOD=AUTO GOAL=SPEED MINRATIO=1.1");
        } else if (!strcmp(argv[i], "zfp")) {
           DBSetCompression("METHOD=ZFP RATE=8.5");
           has_loss = 1;
@@ -168,13 +677,26 @@ main(int argc, char *argv[])
           DBSetCompression("ERRMODE=FALLBACK MINRATIO=1000 METHOD=FPZIP");
        } else if (!strcmp(argv[i], "readonly")) {
           readonly = 1;
+       } else if (!strncmp(argv[i], "threads=", 8)) {
+          nthreads = (int) strtol(argv[i]+8, 0, 10);
+       } else if (!strcmp(argv[i], "mtcompare")) {
+          mtcompare = 1;
+       } else if (!strcmp(argv[i], "optlist")) {
+          optlist = 1;
+       } else if (!strcmp(argv[i], "zfpexec")) {
+          zfpexec = 1;
        } else if (!strcmp(argv[i], "help")) {
           printf("Usage: %s [compress [\"METHOD=...\"]|single|verbose|readonly]\n",argv[0]);
           printf("Where: compress - enables compression, followed by compression information string\n");
           printf("                  default is compress \"METHOD=GZIP LEVEL=1\"\n");
           printf("       single   - writes data as floats not doubles\n");
+          printf("       auto     - lets Silo pick the codec for each array (METHOD=AUTO)\n");
+          printf("       optlist  - checks objects' own DBOPT_COMPRESSION strings\n");
           printf("       verbose  - displays more feedback\n");
           printf("       readonly - checks an existing file (used for cross platform test)\n");
+          printf("       threads=<n> - compress chunks on n threads (128K chunks)\n");
+          printf("       mtcompare   - compare write throughput with and without threads\n");
+          printf("       zfpexec     - compare ZFP write throughput, serial and on 1..n OpenMP threads\n");
           printf("       DB_HDF5  - enable HDF5 driver, the default\n");
           return (0);
        } else if (!strcmp(argv[i], "perf-over-compat")) {
@@ -186,6 +708,38 @@ main(int argc, char *argv[])
        }
     }
 
+    if (mtcompare)
+    {
+        nerrors = compare_threaded_write(driver, nthreads ? nthreads : 4, verbose);
+        DBSetCompression(0);
+        CleanupDriverStuff();
+        return nerrors;
+    }
+
+    if (zfpexec)
+    {
+        nerrors = compare_zfp_execution(driver, nthreads ? nthreads : 4, verbose);
+        CleanupDriverStuff();
+        return nerrors;
+    }
+
+    if (optlist)
+    {
+        nerrors = check_object_compression(driver, verbose);
+        DBSetCompression(0);
+        CleanupDriverStuff();
+        return nerrors;
+    }
+
+    /* Arrays here are 1 megabyte; use smaller chunks so there are several */
+    if (nthreads && DBGetCompression())
+    {
+        char mtcstr[256];
+        snprintf(mtcstr, sizeof(mtcstr), "%s NTHREADS=%d%s", DBGetCompression(), nthreads,
+            strstr(DBGetCompression(), "CHUNKSIZE=") ? "" : " CHUNKSIZE=128K");
+        DBSetCompression(mtcstr);
+    }
+
     /* get some temporary memory */
     fval = (float*) malloc(ONE_MEG);
     frval = (float*) malloc(ONE_MEG);
@@ -282,7 +836,15 @@ main(int argc, char *argv[])
          t2-t1,fsize/(t2-t1));
 #endif
 
+      if (!nerrors && DBGetCompression())
+          nerrors += check_compression_stats(dbfile, usefloat ?
+              fdims[0] * (long long) sizeof(float) : ddims[0] * (long long) sizeof(double),
+              verbose);
+
       DBClose(dbfile);
+
+      if (DBGetCompression() && strstr(DBGetCompression(), "METHOD=AUTO"))
+          nerrors += check_auto_choices(filename, verbose);
     }
     else
     {
@@ -341,7 +903,7 @@ main(int argc, char *argv[])
              fval[i] = (float) ((j+1) * (1 + sin(x)) + n);
              if (fval[i] != frval[i])
              {
-                if (!strcmp(DBGetCompression(), "METHOD=ZFP RATE=8.5"))
+                if (DBGetCompression() && strstr(DBGetCompression(), "METHOD=ZFP RATE=8.5"))
                 {
                     double rel_err = 0;
                     if (fval[i] != 0) rel_err = (fval[i] - frval[i]) / fval[i];
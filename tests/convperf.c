@@ -0,0 +1,157 @@
+/*
+Copyright (C) 1994-2016 Lawrence Livermore National Security, LLC.
+LLNL-CODE-425250.
+All rights reserved.
+
+This file is part of Silo. For details, see silo.llnl.gov.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the disclaimer below.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the disclaimer (as noted
+     below) in the documentation and/or other materials provided with
+     the distribution.
+   * Neither the name of the LLNS/LLNL nor the names of its
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+THIS SOFTWARE  IS PROVIDED BY  THE COPYRIGHT HOLDERS  AND CONTRIBUTORS
+"AS  IS" AND  ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING,  BUT NOT
+LIMITED TO, THE IMPLIED  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A  PARTICULAR  PURPOSE ARE  DISCLAIMED.  IN  NO  EVENT SHALL  LAWRENCE
+LIVERMORE  NATIONAL SECURITY, LLC,  THE U.S.  DEPARTMENT OF  ENERGY OR
+CONTRIBUTORS BE LIABLE FOR  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR  CONSEQUENTIAL DAMAGES  (INCLUDING, BUT NOT  LIMITED TO,
+PROCUREMENT OF  SUBSTITUTE GOODS  OR SERVICES; LOSS  OF USE,  DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER  IN CONTRACT, STRICT LIABILITY,  OR TORT (INCLUDING
+NEGLIGENCE OR  OTHERWISE) ARISING IN  ANY WAY OUT  OF THE USE  OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+This work was produced at Lawrence Livermore National Laboratory under
+Contract No.  DE-AC52-07NA27344 with the DOE.
+
+Neither the  United States Government nor  Lawrence Livermore National
+Security, LLC nor any of  their employees, makes any warranty, express
+or  implied,  or  assumes  any  liability or  responsibility  for  the
+accuracy, completeness,  or usefulness of  any information, apparatus,
+product, or  process disclosed, or  represents that its use  would not
+infringe privately-owned rights.
+
+Any reference herein to  any specific commercial products, process, or
+services by trade name,  trademark, manufacturer or otherwise does not
+necessarily  constitute or imply  its endorsement,  recommendation, or
+favoring  by  the  United  States  Government  or  Lawrence  Livermore
+National Security,  LLC. The views  and opinions of  authors expressed
+herein do not necessarily state  or reflect those of the United States
+Government or Lawrence Livermore National Security, LLC, and shall not
+be used for advertising or product endorsement purposes.
+*/
+
+/*
+ * Micro-benchmark and check of PDB data conversion. Writes arrays of
+ * shorts, ints, floats and doubles to a file in the host's format and
+ * to one in big-endian IEEE format, reads them back and checks them.
+ * Conversion throughput is printed for each type and format.
+ *
+ *     convperf [n=<values>]
+ */
+#ifdef PDB_LITE
+#include <lite_pdb.h>
+#else
+#include <pdb.h>
+#endif
+
+#include <silo.h>
+#include <std.c>
+
+static void
+report(char const *fmt, char const *what, char const *type, long nbytes, double t0)
+{
+    double dt = (GetTime() - t0) * 1e-6;
+    printf("%-6s %-5s %-6s %8.1f MB in %7.3f s, %8.1f MB/s\n", fmt, what, type,
+        nbytes / 1e6, dt, dt > 0 ? nbytes / 1e6 / dt : 0);
+}
+
+int
+main(int argc, char **argv)
+{
+    static char *types[] = {"short", "int", "float", "double"};
+    static int sizes[] = {sizeof(short), sizeof(int), sizeof(float), sizeof(double)};
+    long i, n = 4000000, nerr = 0;
+    int f, t;
+    char *src[4], *dst;
+    PDBfile *file;
+    double t0;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strncmp(argv[i], "n=", 2))
+            n = strtol(argv[i]+2, 0, 10);
+    }
+
+    for (t = 0; t < 4; t++)
+        src[t] = (char *) malloc(n * sizeof(double));
+    dst = (char *) malloc(n * sizeof(double));
+    for (i = 0; i < n; i++)
+    {
+        ((short *) src[0])[i] = (short) (i - 16384);
+        ((int *) src[1])[i] = (int) (i * 2654435761u);
+        ((float *) src[2])[i] = (float) (i - n/2) / 3;
+        ((double *) src[3])[i] = (double) (i - n/2) / 7 * 1e-300;
+    }
+
+    for (f = 0; f < 2; f++)
+    {
+        char const *fmt = f ? "ieee" : "native";
+        char dims[32];
+
+        if (f)
+            PD_target(&IEEEA_STD, &M68000_ALIGNMENT);
+        if ((file = PD_open("convperf.pdb", "w")) == NULL)
+        {
+            printf("can't create convperf.pdb\n");
+            return 1;
+        }
+        for (t = 0; t < 4; t++)
+        {
+            sprintf(dims, "a_%s(%ld)", types[t], n);
+            t0 = GetTime();
+            if (!PD_write(file, dims, types[t], src[t])) nerr++;
+            report(fmt, "write", types[t], n * sizes[t], t0);
+        }
+        PD_close(file);
+
+        if ((file = PD_open("convperf.pdb", "r")) == NULL)
+        {
+            printf("can't open convperf.pdb\n");
+            return 1;
+        }
+        for (t = 0; t < 4; t++)
+        {
+            sprintf(dims, "a_%s", types[t]);
+            memset(dst, 0, n * sizes[t]);
+            t0 = GetTime();
+            if (!PD_read(file, dims, dst)) nerr++;
+            report(fmt, "read", types[t], n * sizes[t], t0);
+            if (memcmp(dst, src[t], n * sizes[t]))
+            {
+                printf("%s %s values differ\n", fmt, types[t]);
+                nerr++;
+            }
+        }
+        PD_close(file);
+    }
+
+    for (t = 0; t < 4; t++)
+        free(src[t]);
+    free(dst);
+
+    if (nerr)
+        printf("%ld errors\n", nerr);
+    return nerr ? 1 : 0;
+}
@@ -0,0 +1,211 @@
+/*
+Copyright (C) 1994-2016 Lawrence Livermore National Security, LLC.
+LLNL-CODE-425250.
+All rights reserved.
+
+This file is part of Silo. For details, see silo.llnl.gov.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the disclaimer below.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the disclaimer (as noted
+     below) in the documentation and/or other materials provided with
+     the distribution.
+   * Neither the name of the LLNS/LLNL nor the names of its
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+THIS SOFTWARE  IS PROVIDED BY  THE COPYRIGHT HOLDERS  AND CONTRIBUTORS
+"AS  IS" AND  ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING,  BUT NOT
+LIMITED TO, THE IMPLIED  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A  PARTICULAR  PURPOSE ARE  DISCLAIMED.  IN  NO  EVENT SHALL  LAWRENCE
+LIVERMORE  NATIONAL SECURITY, LLC,  THE U.S.  DEPARTMENT OF  ENERGY OR
+CONTRIBUTORS BE LIABLE FOR  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR  CONSEQUENTIAL DAMAGES  (INCLUDING, BUT NOT  LIMITED TO,
+PROCUREMENT OF  SUBSTITUTE GOODS  OR SERVICES; LOSS  OF USE,  DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER  IN CONTRACT, STRICT LIABILITY,  OR TORT (INCLUDING
+NEGLIGENCE OR  OTHERWISE) ARISING IN  ANY WAY OUT  OF THE USE  OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+This work was produced at Lawrence Livermore National Laboratory under
+Contract No.  DE-AC52-07NA27344 with the DOE.
+
+Neither the  United States Government nor  Lawrence Livermore National
+Security, LLC nor any of  their employees, makes any warranty, express
+or  implied,  or  assumes  any  liability or  responsibility  for  the
+accuracy, completeness,  or usefulness of  any information, apparatus,
+product, or  process disclosed, or  represents that its use  would not
+infringe privately-owned rights.
+
+Any reference herein to  any specific commercial products, process, or
+services by trade name,  trademark, manufacturer or otherwise does not
+necessarily  constitute or imply  its endorsement,  recommendation, or
+favoring  by  the  United  States  Government  or  Lawrence  Livermore
+National Security,  LLC. The views  and opinions of  authors expressed
+herein do not necessarily state  or reflect those of the United States
+Government or Lawrence Livermore National Security, LLC, and shall not
+be used for advertising or product endorsement purposes.
+*/
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <silo.h>
+#include <std.c>
+
+/*
+ * Compute the external faces of large hex, tet and polyhedral meshes,
+ * first with one thread and then with several, and check the results
+ * are identical and have the expected number of faces.
+ */
+
+static int
+SameFacelist(DBfacelist const *a, DBfacelist const *b)
+{
+    if (a->nfaces != b->nfaces || a->lnodelist != b->lnodelist ||
+        a->nshapes != b->nshapes)
+        return 0;
+    if (memcmp(a->shapesize, b->shapesize, a->nshapes * sizeof(int)) ||
+        memcmp(a->shapecnt, b->shapecnt, a->nshapes * sizeof(int)) ||
+        memcmp(a->zoneno, b->zoneno, a->nfaces * sizeof(int)) ||
+        memcmp(a->nodelist, b->nodelist, a->lnodelist * sizeof(int)))
+        return 0;
+    return 1;
+}
+
+#define NODE(i,j,k) (((k)*(n+1)+(j))*(n+1)+(i))
+
+static int
+HexCorners(int n, int i, int j, int k, int *c)
+{
+    c[0] = NODE(i,  j,  k  ); c[1] = NODE(i+1,j,  k  );
+    c[2] = NODE(i+1,j+1,k  ); c[3] = NODE(i,  j+1,k  );
+    c[4] = NODE(i,  j,  k+1); c[5] = NODE(i+1,j,  k+1);
+    c[6] = NODE(i+1,j+1,k+1); c[7] = NODE(i,  j+1,k+1);
+    return 8;
+}
+
+static int
+TestMesh(char const *name, int *zonelist, int nnodes, int shapetype,
+    int shapesize, int nzones, int nthreads, int expected)
+{
+    double t0, t1, t2;
+    DBfacelist *fl1, *fl2;
+    int ok;
+
+    DBSetExternalFacelistThreads(1);
+    t0 = GetTime();
+    fl1 = DBCalcExternalFacelist2(zonelist, nnodes, 0, 0, 0, &shapetype,
+              &shapesize, &nzones, 1, NULL, 0);
+    t1 = GetTime();
+    DBSetExternalFacelistThreads(nthreads);
+    fl2 = DBCalcExternalFacelist2(zonelist, nnodes, 0, 0, 0, &shapetype,
+              &shapesize, &nzones, 1, NULL, 0);
+    t2 = GetTime();
+    DBSetExternalFacelistThreads(1);
+
+    ok = fl1 && fl2 && fl1->nfaces == expected && SameFacelist(fl1, fl2);
+    printf("%-5s %8d zones %7d faces: 1 thread %7.3f s, %d threads %7.3f s %s\n",
+        name, nzones, fl1 ? fl1->nfaces : -1, (t1-t0)*1e-6, nthreads,
+        (t2-t1)*1e-6, ok ? "" : "MISMATCH");
+
+    DBFreeFacelist(fl1);
+    DBFreeFacelist(fl2);
+    return ok ? 0 : 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int n = 60;
+    int nthreads = 4;
+    int i, j, k, t, nerrors = 0;
+    int driver = DB_PDB;
+    int nnodes, nhex;
+    int *zl;
+    static int const tets[6][4] = {
+        {0,1,2,6}, {0,2,3,6}, {0,3,7,6}, {0,7,4,6}, {0,4,5,6}, {0,5,1,6}
+    };
+    static int const hexfaces[6][4] = {
+        {0,3,2,1}, {1,2,6,5}, {5,6,7,4}, {4,7,3,0}, {0,1,5,4}, {3,7,6,2}
+    };
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strncmp(argv[i], "DB_", 3))
+            driver = StringToDriver(argv[i]);
+        else if (!strncmp(argv[i], "n=", 2))
+            n = (int) strtol(argv[i]+2, 0, 10);
+        else if (!strncmp(argv[i], "nthreads=", 9))
+            nthreads = (int) strtol(argv[i]+9, 0, 10);
+        else if (argv[i][0] != '\0')
+            fprintf(stderr, "%s: ignored argument `%s'\n", argv[0], argv[i]);
+    }
+    (void) driver;
+
+    if (DBGetExternalFacelistThreads() != 1)
+    {
+        fprintf(stderr, "Default number of external facelist threads is not 1\n");
+        nerrors++;
+    }
+
+    nnodes = (n+1)*(n+1)*(n+1);
+    nhex = n*n*n;
+
+    /* Hexes */
+    zl = (int *) malloc(nhex * 8 * sizeof(int));
+    for (k = 0; k < n; k++)
+        for (j = 0; j < n; j++)
+            for (i = 0; i < n; i++)
+                HexCorners(n, i, j, k, &zl[((k*n+j)*n+i)*8]);
+    nerrors += TestMesh("hex", zl, nnodes, DB_ZONETYPE_HEX, 8, nhex,
+                   nthreads, 6*n*n);
+    free(zl);
+
+    /* Each hex split into 6 tets around its main diagonal */
+    zl = (int *) malloc(nhex * 24 * sizeof(int));
+    for (k = 0; k < n; k++)
+        for (j = 0; j < n; j++)
+            for (i = 0; i < n; i++)
+            {
+                int c[8], *z = &zl[((k*n+j)*n+i)*24];
+                HexCorners(n, i, j, k, c);
+                for (t = 0; t < 6; t++)
+                {
+                    z[4*t+0] = c[tets[t][0]]; z[4*t+1] = c[tets[t][1]];
+                    z[4*t+2] = c[tets[t][2]]; z[4*t+3] = c[tets[t][3]];
+                }
+            }
+    nerrors += TestMesh("tet", zl, nnodes, DB_ZONETYPE_TET, 4, 6*nhex,
+                   nthreads, 12*n*n);
+    free(zl);
+
+    /* The hexes again, as polyhedra */
+    zl = (int *) malloc(nhex * 31 * sizeof(int));
+    for (k = 0; k < n; k++)
+        for (j = 0; j < n; j++)
+            for (i = 0; i < n; i++)
+            {
+                int c[8], *z = &zl[((k*n+j)*n+i)*31];
+                HexCorners(n, i, j, k, c);
+                *z++ = 6;
+                for (t = 0; t < 6; t++)
+                {
+                    *z++ = 4;
+                    *z++ = c[hexfaces[t][0]]; *z++ = c[hexfaces[t][1]];
+                    *z++ = c[hexfaces[t][2]]; *z++ = c[hexfaces[t][3]];
+                }
+            }
+    nerrors += TestMesh("poly", zl, nnodes, DB_ZONETYPE_POLYHEDRON, 31, nhex,
+                   nthreads, 6*n*n);
+    free(zl);
+
+    CleanupDriverStuff();
+    return nerrors;
+}
@@ -0,0 +1,147 @@
+/*
+Copyright (C) 1994-2016 Lawrence Livermore National Security, LLC.
+LLNL-CODE-425250.
+All rights reserved.
+
+This file is part of Silo. For details, see silo.llnl.gov.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the disclaimer below.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the disclaimer (as noted
+     below) in the documentation and/or other materials provided with
+     the distribution.
+   * Neither the name of the LLNS/LLNL nor the names of its
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+THIS SOFTWARE  IS PROVIDED BY  THE COPYRIGHT HOLDERS  AND CONTRIBUTORS
+"AS  IS" AND  ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING,  BUT NOT
+LIMITED TO, THE IMPLIED  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A  PARTICULAR  PURPOSE ARE  DISCLAIMED.  IN  NO  EVENT SHALL  LAWRENCE
+LIVERMORE  NATIONAL SECURITY, LLC,  THE U.S.  DEPARTMENT OF  ENERGY OR
+CONTRIBUTORS BE LIABLE FOR  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR  CONSEQUENTIAL DAMAGES  (INCLUDING, BUT NOT  LIMITED TO,
+PROCUREMENT OF  SUBSTITUTE GOODS  OR SERVICES; LOSS  OF USE,  DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER  IN CONTRACT, STRICT LIABILITY,  OR TORT (INCLUDING
+NEGLIGENCE OR  OTHERWISE) ARISING IN  ANY WAY OUT  OF THE USE  OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+This work was produced at Lawrence Livermore National Laboratory under
+Contract No.  DE-AC52-07NA27344 with the DOE.
+
+Neither the  United States Government nor  Lawrence Livermore National
+Security, LLC nor any of  their employees, makes any warranty, express
+or  implied,  or  assumes  any  liability or  responsibility  for  the
+accuracy, completeness,  or usefulness of  any information, apparatus,
+product, or  process disclosed, or  represents that its use  would not
+infringe privately-owned rights.
+
+Any reference herein to  any specific commercial products, process, or
+services by trade name,  trademark, manufacturer or otherwise does not
+necessarily  constitute or imply  its endorsement,  recommendation, or
+favoring  by  the  United  States  Government  or  Lawrence  Livermore
+National Security,  LLC. The views  and opinions of  authors expressed
+herein do not necessarily state  or reflect those of the United States
+Government or Lawrence Livermore National Security, LLC, and shall not
+be used for advertising or product endorsement purposes.
+*/
+
+/*
+ * Micro-benchmark and check of the score hash table used for PDB symbol
+ * tables. Installs N names into a table created at the default PDB
+ * symbol table size, looks every one up, misses N more, removes every
+ * other one and checks what remains. Rates are printed for each phase.
+ *
+ *     hashperf [n=<entries>]
+ */
+#ifdef PDB_LITE
+#include <lite_score.h>
+#else
+#include <score.h>
+#endif
+
+#include <silo.h>
+#include <std.c>
+
+static void
+report(char const *what, long n, double t0)
+{
+    double dt = (GetTime() - t0) * 1e-6;
+    printf("%-8s %9ld in %7.3f s, %10.0f/s\n", what, n, dt, dt > 0 ? n / dt : 0);
+}
+
+int
+main(int argc, char **argv)
+{
+    long i, n = 1000000, nerr = 0;
+    char name[64];
+    HASHTAB *tab;
+    hashel *hp;
+    double t0;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strncmp(argv[i], "n=", 2))
+            n = strtol(argv[i]+2, 0, 10);
+    }
+
+    tab = SC_make_hash_table(HSZMEDIUM, NODOC);
+
+    t0 = GetTime();
+    for (i = 0; i < n; i++)
+    {
+        sprintf(name, "/domain_%ld/var_%ld", i % 1000, i);
+        SC_install(name, NULL, NULL, tab);
+    }
+    report("insert", n, t0);
+    if (tab->nelements != n)
+    {
+        printf("expected %ld elements, got %d\n", n, tab->nelements);
+        nerr++;
+    }
+
+    t0 = GetTime();
+    for (i = 0; i < n; i++)
+    {
+        sprintf(name, "/domain_%ld/var_%ld", i % 1000, i);
+        hp = SC_lookup(name, tab);
+        if (!hp || strcmp(hp->name, name)) nerr++;
+    }
+    report("lookup", n, t0);
+
+    t0 = GetTime();
+    for (i = 0; i < n; i++)
+    {
+        sprintf(name, "/domain_%ld/nil_%ld", i % 1000, i);
+        if (SC_lookup(name, tab)) nerr++;
+    }
+    report("miss", n, t0);
+
+    t0 = GetTime();
+    for (i = 0; i < n; i += 2)
+    {
+        sprintf(name, "/domain_%ld/var_%ld", i % 1000, i);
+        if (!SC_hash_rem(name, tab)) nerr++;
+    }
+    report("remove", (n+1)/2, t0);
+
+    for (i = 0; i < n; i++)
+    {
+        sprintf(name, "/domain_%ld/var_%ld", i % 1000, i);
+        hp = SC_lookup(name, tab);
+        if ((i % 2 == 0) != (hp == NULL)) nerr++;
+    }
+    if (tab->nelements != n/2) nerr++;
+
+    SC_rl_hash_table(tab);
+
+    if (nerr)
+        printf("%ld errors\n", nerr);
+    return nerr ? 1 : 0;
+}
@@ -72,6 +72,47 @@ be used for advertising or product endorsement purposes.
 
 #include <std.c>
 
+/* Sanity check the silo VFD's I/O counters against what we asked of it */
+static int
+check_iostats(DBfile *dbfile, int writing, int nvars)
+{
+    DBiostats st;
+    long long nbytes = (long long) nvars * ONE_MEG;
+    int nerrors = 0;
+
+    if (DBGetIOStats(dbfile, &st) != 0)
+    {
+        printf("DBGetIOStats failed\n");
+        return 1;
+    }
+
+    printf("%s: %lld bytes in %lld calls (%g s), %lld hits, %lld misses, %lld evictions\n",
+        writing ? "wrote" : "read",
+        writing ? st.bytes_written : st.bytes_read,
+        writing ? st.write_calls : st.read_calls,
+        writing ? st.write_time : st.read_time,
+        st.block_hits, st.block_misses, st.block_evictions);
+
+    if (writing)
+    {
+        if (st.raw_writes < nvars || st.raw_bytes_written < nbytes) nerrors++;
+        if (st.meta_writes <= 0) nerrors++;
+        if (st.block_evictions <= 0 || st.write_calls <= 0) nerrors++;
+        if (st.bytes_written < nbytes - (long long) st.block_size * st.block_count) nerrors++;
+    }
+    else
+    {
+        if (st.raw_reads < nvars || st.raw_bytes_read < nbytes) nerrors++;
+        if (st.meta_reads <= 0 || st.block_misses <= 0) nerrors++;
+        if (st.read_calls <= 0 || st.bytes_read < nbytes) nerrors++;
+    }
+    if (st.read_time < 0 || st.write_time < 0) nerrors++;
+
+    if (nerrors)
+        printf("unexpected %s I/O statistics\n", writing ? "write" : "read");
+    return nerrors;
+}
+
 static void
 build_curve (DBfile *dbfile, int driver)
 {
@@ -142,6 +183,7 @@ main(int argc, char *argv[])
     int            driver=DB_PDB;
     char          *filename="largefile.silo";
     int            show_all_errors = FALSE;
+    int            iostats = FALSE;
     DBfile        *dbfile;
     int            nIters = 2500, cIters;
 
@@ -158,6 +200,8 @@ main(int argc, char *argv[])
             driver = StringToDriver(argv[i]);
         } else if (!strcmp(argv[i], "show-all-errors")) {
             show_all_errors = 1;
+        } else if (!strcmp(argv[i], "-iostats")) {
+            iostats = 1;
         } else if (!strcmp(argv[i], "-niters")) {
             nIters = strtol(argv[i+1],0,10);
             i++;
@@ -199,6 +243,9 @@ main(int argc, char *argv[])
     */
     build_curve(dbfile, driver);
 
+    if (iostats)
+        nerrors += check_iostats(dbfile, 1, nIters);
+
     DBClose(dbfile);
 
     /*
@@ -249,6 +296,9 @@ main(int argc, char *argv[])
         }
     }
 
+    if (iostats)
+        nerrors += check_iostats(dbfile, 0, cIters);
+
     DBClose(dbfile);
 
     exit(nerrors > 0);
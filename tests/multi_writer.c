@@ -0,0 +1,320 @@
+/*
+Copyright (C) 1994-2016 Lawrence Livermore National Security, LLC.
+LLNL-CODE-425250.
+All rights reserved.
+
+This file is part of Silo. For details, see silo.llnl.gov.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the disclaimer below.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the disclaimer (as noted
+     below) in the documentation and/or other materials provided with
+     the distribution.
+   * Neither the name of the LLNS/LLNL nor the names of its
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+THIS SOFTWARE  IS PROVIDED BY  THE COPYRIGHT HOLDERS  AND CONTRIBUTORS
+"AS  IS" AND  ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING,  BUT NOT
+LIMITED TO, THE IMPLIED  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A  PARTICULAR  PURPOSE ARE  DISCLAIMED.  IN  NO  EVENT SHALL  LAWRENCE
+LIVERMORE  NATIONAL SECURITY, LLC,  THE U.S.  DEPARTMENT OF  ENERGY OR
+CONTRIBUTORS BE LIABLE FOR  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR  CONSEQUENTIAL DAMAGES  (INCLUDING, BUT NOT  LIMITED TO,
+PROCUREMENT OF  SUBSTITUTE GOODS  OR SERVICES; LOSS  OF USE,  DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER  IN CONTRACT, STRICT LIABILITY,  OR TORT (INCLUDING
+NEGLIGENCE OR  OTHERWISE) ARISING IN  ANY WAY OUT  OF THE USE  OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+This work was produced at Lawrence Livermore National Laboratory under
+Contract  No.   DE-AC52-07NA27344 with  the  DOE.  Neither the  United
+States Government  nor Lawrence  Livermore National Security,  LLC nor
+any of  their employees,  makes any warranty,  express or  implied, or
+assumes   any   liability   or   responsibility  for   the   accuracy,
+completeness, or usefulness of any information, apparatus, product, or
+process  disclosed, or  represents  that its  use  would not  infringe
+privately-owned   rights.  Any  reference   herein  to   any  specific
+commercial products,  process, or  services by trade  name, trademark,
+manufacturer or otherwise does not necessarily constitute or imply its
+endorsement,  recommendation,   or  favoring  by   the  United  States
+Government or Lawrence Livermore National Security, LLC. The views and
+opinions  of authors  expressed  herein do  not  necessarily state  or
+reflect those  of the United  States Government or  Lawrence Livermore
+National  Security, LLC,  and shall  not  be used  for advertising  or
+product endorsement purposes.
+*/
+
+
+/*
+ * Tests the silo VFD's multi-writer mode, in which each of several
+ * writers puts an independent Silo file into disjoint blocks of one
+ * physical file. Built with -DHAVE_MPI, each MPI rank is a writer.
+ * Otherwise, one process opens all the writers' files at once and
+ * interleaves writes to them or, given the "threads" argument, two
+ * threads each write half of the writers' files at the same time. Either
+ * way, every writer's file is then read back and checked. The threads
+ * mode is skipped unless the library is built thread-safe
+ * (SILO_THREADSAFE).
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include <silo.h>
+#include <config.h>
+#if defined(SILO_THREADSAFE) && defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+#include <std.c>
+
+#ifdef HAVE_MPI
+#include <mpi.h>
+#endif
+
+#define FILENAME "multi_writer.silo"
+#define NVALS    50000
+#define NARRAYS  8
+
+static int comm_rank = 0;
+
+#ifdef HAVE_MPI
+#define ASSERT(A) \
+{ \
+    if (!(A)) \
+    { \
+        fprintf(stderr, "%s:%d[rank=%d]: %s: Assertion \"%s\" failed.\n", \
+            __FILE__, __LINE__, comm_rank, __func__, #A); \
+        MPI_Abort(MPI_COMM_WORLD, 1); \
+    } \
+}
+#else
+#define ASSERT(A) \
+{ \
+    if (!(A)) \
+    { \
+        fprintf(stderr, "%s:%d[rank=%d]: %s: Assertion \"%s\" failed.\n", \
+            __FILE__, __LINE__, comm_rank, __func__, #A); \
+        abort(); \
+    } \
+}
+#endif
+
+/* Register options selecting writer (or, to read, nwriters=0) */
+static int writer_opts(DBoptlist **opts, int *vfd, int *nwriters, int *writer, int *nblocks)
+{
+    *opts = DBMakeOptlist(5);
+    DBAddOption(*opts, DBOPT_H5_VFD, vfd);
+    DBAddOption(*opts, DBOPT_H5_SILO_NWRITERS, nwriters);
+    DBAddOption(*opts, DBOPT_H5_SILO_WRITER, writer);
+    DBAddOption(*opts, DBOPT_H5_SILO_BLOCK_COUNT, nblocks);
+    return DBRegisterFileOptionsSet(*opts);
+}
+
+static double value(int writer, int array, int i)
+{
+    return writer * 1000000.0 + array * 100000.0 + i;
+}
+
+static void write_array(DBfile *dbfile, int writer, int array, double *buf)
+{
+    char name[32];
+    int i, dims = NVALS;
+
+    for (i = 0; i < NVALS; i++)
+        buf[i] = value(writer, array, i);
+    sprintf(name, "array_%d", array);
+    ASSERT(DBWrite(dbfile, name, buf, &dims, 1, DB_DOUBLE) == 0);
+}
+
+#if !defined(HAVE_MPI) && defined(SILO_THREADSAFE) && defined(HAVE_PTHREAD)
+/* Thread body for the threads mode. Writes the files of every other
+   writer, starting with *arg, so that two threads claim segments of the
+   physical file concurrently. */
+static void *write_writers(void *arg)
+{
+    int first = *(int *) arg, vfd = DB_H5VFD_SILO, nwriters = 4, nblocks = 4, one = 1;
+    int writers[2], optsets[2], n, w, j;
+    DBoptlist *opts[2];
+    DBfile *dbfiles[2];
+    double *buf;
+
+    ASSERT(buf = (double *) malloc(NVALS * sizeof(double)));
+    for (n = 0, w = first; w < nwriters; n++, w += 2)
+    {
+        writers[n] = w;
+        optsets[n] = writer_opts(&opts[n], &vfd, &nwriters, &writers[n], &nblocks);
+        ASSERT(dbfiles[n] = DBCreate(FILENAME, DB_CLOBBER, DB_LOCAL, "multi-writer test", DB_HDF5_OPTS(optsets[n])));
+    }
+    for (j = 0; j < NARRAYS; j++)
+        for (w = 0; w < n; w++)
+            write_array(dbfiles[w], writers[w], j, buf);
+    for (w = 0; w < n; w++)
+    {
+        ASSERT(DBWrite(dbfiles[w], "writer", &writers[w], &one, 1, DB_INT) == 0);
+        DBClose(dbfiles[w]);
+        DBUnregisterFileOptionsSet(optsets[w]);
+        DBFreeOptlist(opts[w]);
+    }
+    free(buf);
+    return 0;
+}
+#endif
+
+static void check_writer(int writer, double *buf)
+{
+    DBoptlist *opts;
+    int vfd = DB_H5VFD_SILO, nwriters = 0, nblocks = 4, optset, i, j;
+    int nread = 0;
+    DBfile *dbfile;
+
+    optset = writer_opts(&opts, &vfd, &nwriters, &writer, &nblocks);
+    ASSERT(dbfile = DBOpen(FILENAME, DB_HDF5_OPTS(optset), DB_READ));
+    for (j = 0; j < NARRAYS; j++)
+    {
+        char name[32];
+        sprintf(name, "array_%d", j);
+        ASSERT(DBGetVarLength(dbfile, name) == NVALS);
+        ASSERT(DBReadVar(dbfile, name, buf) == 0);
+        for (i = 0; i < NVALS; i++)
+            if (buf[i] != value(writer, j, i)) break;
+        ASSERT(i == NVALS);
+        nread++;
+    }
+    ASSERT(DBReadVar(dbfile, "writer", &i) == 0 && i == writer);
+    DBClose(dbfile);
+    DBUnregisterFileOptionsSet(optset);
+    DBFreeOptlist(opts);
+    ASSERT(nread == NARRAYS);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int comm_size = 4, vfd = DB_H5VFD_SILO, nblocks = 4, one = 1;
+    int optsets[4], w, j, threads = 0;
+    DBoptlist *opts[4];
+    DBfile *dbfiles[4];
+    double *buf;
+
+#ifdef HAVE_MPI
+    MPI_Init(&argc, &argv);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank);
+#endif
+
+    for (j = 1; j < argc; j++)
+    {
+        if (!strcmp(argv[j], "threads"))
+            threads = 1;
+        else if (!strcmp(argv[j], "DB_HDF5"))
+            ;
+        else if (argv[j][0] != '\0')
+            fprintf(stderr, "%s: ignored argument `%s'\n", argv[0], argv[j]);
+    }
+
+#if defined(HAVE_MPI) || !defined(SILO_THREADSAFE) || !defined(HAVE_PTHREAD)
+    if (threads)
+    {
+        fprintf(stderr, "Silo was not built thread-safe; skipping.\n");
+        CleanupDriverStuff();
+        return skip_retval;
+    }
+#endif
+
+    ASSERT(buf = (double *) malloc(NVALS * sizeof(double)));
+    DBShowErrors(DB_ALL_AND_DRVR, 0);
+
+    /* writers never truncate a shared file; start from scratch */
+    if (comm_rank == 0)
+        unlink(FILENAME);
+#ifdef HAVE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+#ifdef HAVE_MPI
+    w = comm_rank;
+    optsets[0] = writer_opts(&opts[0], &vfd, &comm_size, &w, &nblocks);
+    ASSERT(dbfiles[0] = DBCreate(FILENAME, DB_CLOBBER, DB_LOCAL, "multi-writer test", DB_HDF5_OPTS(optsets[0])));
+    for (j = 0; j < NARRAYS; j++)
+        write_array(dbfiles[0], comm_rank, j, buf);
+    ASSERT(DBWrite(dbfiles[0], "writer", &comm_rank, &one, 1, DB_INT) == 0);
+    DBClose(dbfiles[0]);
+    DBUnregisterFileOptionsSet(optsets[0]);
+    DBFreeOptlist(opts[0]);
+    MPI_Barrier(MPI_COMM_WORLD);
+#else
+#if defined(SILO_THREADSAFE) && defined(HAVE_PTHREAD)
+    if (threads)
+    {
+        pthread_t tids[2];
+        int firsts[2] = {0, 1};
+
+        for (w = 0; w < 2; w++)
+            ASSERT(pthread_create(&tids[w], 0, write_writers, &firsts[w]) == 0);
+        for (w = 0; w < 2; w++)
+            pthread_join(tids[w], 0);
+    }
+    else
+#endif
+    {
+        int writers[4];
+
+        /* create every writer's file first, then interleave the writes
+           so the writers' blocks alternate in the physical file */
+        for (w = 0; w < comm_size; w++)
+        {
+            writers[w] = w;
+            optsets[w] = writer_opts(&opts[w], &vfd, &comm_size, &writers[w], &nblocks);
+            ASSERT(dbfiles[w] = DBCreate(FILENAME, DB_CLOBBER, DB_LOCAL, "multi-writer test", DB_HDF5_OPTS(optsets[w])));
+        }
+
+        /* writers each have a file, but an ordinary open conflicts with them */
+        DBShowErrors(DB_NONE, 0);
+        ASSERT(DBOpen(FILENAME, DB_HDF5, DB_READ) == 0);
+        ASSERT(db_errno == E_CONCURRENT);
+        DBShowErrors(DB_ALL_AND_DRVR, 0);
+        for (j = 0; j < NARRAYS; j++)
+            for (w = 0; w < comm_size; w++)
+                write_array(dbfiles[w], w, j, buf);
+        for (w = 0; w < comm_size; w++)
+        {
+            ASSERT(DBWrite(dbfiles[w], "writer", &writers[w], &one, 1, DB_INT) == 0);
+            DBClose(dbfiles[w]);
+            DBUnregisterFileOptionsSet(optsets[w]);
+            DBFreeOptlist(opts[w]);
+        }
+    }
+#endif
+
+    /* opening a multi-writer file without selecting a writer must fail */
+    opts[0] = DBMakeOptlist(1);
+    DBAddOption(opts[0], DBOPT_H5_VFD, &vfd);
+    optsets[0] = DBRegisterFileOptionsSet(opts[0]);
+    DBShowErrors(DB_NONE, 0);
+    ASSERT(DBOpen(FILENAME, DB_HDF5_OPTS(optsets[0]), DB_READ) == 0);
+    DBShowErrors(DB_ALL_AND_DRVR, 0);
+    DBUnregisterFileOptionsSet(optsets[0]);
+    DBFreeOptlist(opts[0]);
+
+    /* everyone checks every writer's file */
+    for (w = 0; w < comm_size; w++)
+        check_writer(w, buf);
+
+    free(buf);
+    CleanupDriverStuff();
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
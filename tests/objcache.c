@@ -0,0 +1,188 @@
+/*
+Copyright (C) 1994-2016 Lawrence Livermore National Security, LLC.
+LLNL-CODE-425250.
+All rights reserved.
+
+This file is part of Silo. For details, see silo.llnl.gov.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the disclaimer below.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the disclaimer (as noted
+     below) in the documentation and/or other materials provided with
+     the distribution.
+   * Neither the name of the LLNS/LLNL nor the names of its
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+THIS SOFTWARE  IS PROVIDED BY  THE COPYRIGHT HOLDERS  AND CONTRIBUTORS
+"AS  IS" AND  ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING,  BUT NOT
+LIMITED TO, THE IMPLIED  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A  PARTICULAR  PURPOSE ARE  DISCLAIMED.  IN  NO  EVENT SHALL  LAWRENCE
+LIVERMORE  NATIONAL SECURITY, LLC,  THE U.S.  DEPARTMENT OF  ENERGY OR
+CONTRIBUTORS BE LIABLE FOR  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR  CONSEQUENTIAL DAMAGES  (INCLUDING, BUT NOT  LIMITED TO,
+PROCUREMENT OF  SUBSTITUTE GOODS  OR SERVICES; LOSS  OF USE,  DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER  IN CONTRACT, STRICT LIABILITY,  OR TORT (INCLUDING
+NEGLIGENCE OR  OTHERWISE) ARISING IN  ANY WAY OUT  OF THE USE  OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+This work was produced at Lawrence Livermore National Laboratory under
+Contract No.  DE-AC52-07NA27344 with the DOE.
+
+Neither the  United States Government nor  Lawrence Livermore National
+Security, LLC nor any of  their employees, makes any warranty, express
+or  implied,  or  assumes  any  liability or  responsibility  for  the
+accuracy, completeness,  or usefulness of  any information, apparatus,
+product, or  process disclosed, or  represents that its use  would not
+infringe privately-owned rights.
+
+Any reference herein to  any specific commercial products, process, or
+services by trade name,  trademark, manufacturer or otherwise does not
+necessarily  constitute or imply  its endorsement,  recommendation, or
+favoring  by  the  United  States  Government  or  Lawrence  Livermore
+National Security,  LLC. The views  and opinions of  authors expressed
+herein do not necessarily state  or reflect those of the United States
+Government or Lawrence Livermore National Security, LLC, and shall not
+be used for advertising or product endorsement purposes.
+*/
+
+/*
+ * Check of the PDB driver's object cache. Reads a mesh and the variables
+ * on it back and forth, in two directories holding objects of the same
+ * names, and checks the cache counters reported by DBGetIOStats, that a
+ * cache of one object still reads correctly, and that an object that is
+ * written again is not read from the cache.
+ */
+#include <silo.h>
+#include <std.c>
+
+#define NVARS 3
+
+static int
+cycle_of(DBfile *dbfile, char const *name)
+{
+    DBquadvar *qv = DBGetQuadvar(dbfile, name);
+    int cycle = qv ? qv->cycle : -1;
+    DBFreeQuadvar(qv);
+    return cycle;
+}
+
+static void
+put_objects(DBfile *dbfile, int cycle)
+{
+    float x[4] = {0, 1, 2, 3}, y[3] = {0, 1, 2}, v[6] = {0, 1, 2, 3, 4, 5};
+    float *coords[2];
+    int dims[2] = {4, 3}, zdims[2] = {3, 2};
+    DBoptlist *opts = DBMakeOptlist(1);
+    char name[32];
+    int i;
+
+    coords[0] = x; coords[1] = y;
+    DBAddOption(opts, DBOPT_CYCLE, &cycle);
+    DBPutQuadmesh(dbfile, "mesh", NULL, coords, dims, 2, DB_FLOAT, DB_COLLINEAR, opts);
+    for (i = 0; i < NVARS; i++)
+    {
+        sprintf(name, "v%d", i);
+        DBPutQuadvar1(dbfile, name, "mesh", v, zdims, 2, NULL, 0, DB_FLOAT, DB_ZONECENT, opts);
+    }
+    DBFreeOptlist(opts);
+}
+
+int
+main(int argc, char *argv[])
+{
+    DBfile *dbfile;
+    DBiostats st;
+    char name[32];
+    int i, j, pass, nerr = 0;
+    int show_all_errors = FALSE;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "show-all-errors"))
+            show_all_errors = 1;
+        else if (argv[i][0] != '\0')
+            fprintf(stderr, "%s: ignored argument `%s'\n", argv[0], argv[i]);
+    }
+
+    DBShowErrors(show_all_errors?DB_ALL_AND_DRVR:DB_TOP, NULL);
+
+    dbfile = DBCreate("objcache.pdb", DB_CLOBBER, DB_LOCAL, "object cache test", DB_PDB);
+    DBMkDir(dbfile, "a");
+    DBMkDir(dbfile, "b");
+    DBSetDir(dbfile, "/a");
+    put_objects(dbfile, 1);
+    DBSetDir(dbfile, "/b");
+    put_objects(dbfile, 2);
+    DBClose(dbfile);
+
+    /* Default cache size holds all of them; after the first pass every
+       read is a hit. Objects of the same name in the two directories
+       must not be confused. */
+    for (pass = 0; pass < 2; pass++)
+    {
+        if (pass == 1)
+            DBSetPDBObjectCacheSize(1);
+
+        dbfile = DBOpen("objcache.pdb", DB_PDB, DB_READ);
+        for (j = 0; j < 4; j++)
+        {
+            DBquadmesh *qm;
+
+            DBSetDir(dbfile, j % 2 ? "/b" : "/a");
+            qm = DBGetQuadmesh(dbfile, "mesh");
+            if (!qm || qm->cycle != j % 2 + 1) nerr++;
+            DBFreeQuadmesh(qm);
+            for (i = 0; i < NVARS; i++)
+            {
+                sprintf(name, "v%d", i);
+                if (cycle_of(dbfile, name) != j % 2 + 1) nerr++;
+                if (DBGetComponentType(dbfile, name, "meshid") != DB_CHAR) nerr++;
+            }
+        }
+
+        if (DBGetIOStats(dbfile, &st) != 0)
+        {
+            printf("DBGetIOStats failed\n");
+            return 1;
+        }
+        printf("cache size %d: %lld hits, %lld misses, %lld evictions\n",
+            DBGetPDBObjectCacheSize(), st.object_hits, st.object_misses,
+            st.object_evictions);
+        if (pass == 0 &&
+            (st.object_misses != 2 * (NVARS + 1) || st.object_evictions != 0))
+            nerr++;
+        if (pass == 1 && (st.object_evictions == 0 || st.object_evictions + 1 != st.object_misses))
+            nerr++;
+        if (st.object_hits <= 0)
+            nerr++;
+        DBClose(dbfile);
+    }
+    DBSetPDBObjectCacheSize(16);
+
+    /* An object written again must be read anew */
+    DBSetAllowOverwrites(1);
+    dbfile = DBOpen("objcache.pdb", DB_PDB, DB_APPEND);
+    DBSetDir(dbfile, "/a");
+    if (cycle_of(dbfile, "v0") != 1) nerr++;
+    put_objects(dbfile, 3);
+    if (cycle_of(dbfile, "v0") != 3) nerr++;
+    DBClose(dbfile);
+
+    dbfile = DBOpen("objcache.pdb", DB_PDB, DB_READ);
+    if (cycle_of(dbfile, "/a/v0") != 3) nerr++;
+    if (cycle_of(dbfile, "/b/v0") != 2) nerr++;
+    DBClose(dbfile);
+
+    if (nerr)
+        printf("%d errors\n", nerr);
+
+    CleanupDriverStuff();
+    return nerr ? 1 : 0;
+}
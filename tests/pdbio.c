@@ -0,0 +1,175 @@
+/*
+Copyright (C) 1994-2016 Lawrence Livermore National Security, LLC.
+LLNL-CODE-425250.
+All rights reserved.
+
+This file is part of Silo. For details, see silo.llnl.gov.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the disclaimer below.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the disclaimer (as noted
+     below) in the documentation and/or other materials provided with
+     the distribution.
+   * Neither the name of the LLNS/LLNL nor the names of its
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+THIS SOFTWARE  IS PROVIDED BY  THE COPYRIGHT HOLDERS  AND CONTRIBUTORS
+"AS  IS" AND  ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING,  BUT NOT
+LIMITED TO, THE IMPLIED  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A  PARTICULAR  PURPOSE ARE  DISCLAIMED.  IN  NO  EVENT SHALL  LAWRENCE
+LIVERMORE  NATIONAL SECURITY, LLC,  THE U.S.  DEPARTMENT OF  ENERGY OR
+CONTRIBUTORS BE LIABLE FOR  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR  CONSEQUENTIAL DAMAGES  (INCLUDING, BUT NOT  LIMITED TO,
+PROCUREMENT OF  SUBSTITUTE GOODS  OR SERVICES; LOSS  OF USE,  DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER  IN CONTRACT, STRICT LIABILITY,  OR TORT (INCLUDING
+NEGLIGENCE OR  OTHERWISE) ARISING IN  ANY WAY OUT  OF THE USE  OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+This work was produced at Lawrence Livermore National Laboratory under
+Contract No.  DE-AC52-07NA27344 with the DOE.
+
+Neither the  United States Government nor  Lawrence Livermore National
+Security, LLC nor any of  their employees, makes any warranty, express
+or  implied,  or  assumes  any  liability or  responsibility  for  the
+accuracy, completeness,  or usefulness of  any information, apparatus,
+product, or  process disclosed, or  represents that its use  would not
+infringe privately-owned rights.
+
+Any reference herein to  any specific commercial products, process, or
+services by trade name,  trademark, manufacturer or otherwise does not
+necessarily  constitute or imply  its endorsement,  recommendation, or
+favoring  by  the  United  States  Government  or  Lawrence  Livermore
+National Security,  LLC. The views  and opinions of  authors expressed
+herein do not necessarily state  or reflect those of the United States
+Government or Lawrence Livermore National Security, LLC, and shall not
+be used for advertising or product endorsement purposes.
+*/
+
+/*
+ * Micro-benchmark and check of the PDB driver's I/O backends. Writes a
+ * file holding many small variables and one large array through each
+ * backend that supports writing, reads everything back through each
+ * backend, checks the values and prints the time each pass took.
+ *
+ *     pdbio [n=<variables>] [show-all-errors]
+ */
+#include <silo.h>
+#include <std.c>
+
+#define NZONES 64
+
+static int
+register_io(int io)
+{
+    DBoptlist *opts = DBMakeOptlist(2);
+    static int bufsize = 4 << 20;
+    static int ios[3];
+
+    ios[io] = io;
+    DBAddOption(opts, DBOPT_PDB_IO, &ios[io]);
+    if (io == DB_PDB_IO_BUFFERED)
+        DBAddOption(opts, DBOPT_PDB_BUFFER_SIZE, &bufsize);
+    return DBRegisterFileOptionsSet(opts);
+}
+
+int
+main(int argc, char *argv[])
+{
+    static char const *ionames[] = {"stdio", "buffered", "mmap"};
+    int i, j, io, n = 2000, nbig = 1 << 20, nerr = 0;
+    int dims[1], opts_ids[3];
+    int show_all_errors = FALSE;
+    float v[NZONES], *big, *rbig;
+    char name[32];
+    DBfile *dbfile;
+    double t0;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strncmp(argv[i], "n=", 2))
+            n = (int) strtol(argv[i]+2, 0, 10);
+        else if (!strcmp(argv[i], "show-all-errors"))
+            show_all_errors = 1;
+        else if (argv[i][0] != '\0')
+            fprintf(stderr, "%s: ignored argument `%s'\n", argv[0], argv[i]);
+    }
+
+    DBShowErrors(show_all_errors?DB_ALL_AND_DRVR:DB_TOP, NULL);
+
+    for (io = 0; io < 3; io++)
+        opts_ids[io] = register_io(io);
+
+    big = (float *) malloc(nbig * sizeof(float));
+    rbig = (float *) malloc(nbig * sizeof(float));
+    for (i = 0; i < nbig; i++)
+        big[i] = (float) i / 3;
+
+    /* Memory maps are only used for reading */
+    for (io = 0; io < 2; io++)
+    {
+        t0 = GetTime();
+        dbfile = DBCreate("pdbio.pdb", DB_CLOBBER, DB_LOCAL, "pdb io test",
+                          DB_PDB_OPTS(opts_ids[io]));
+        if (!dbfile)
+        {
+            printf("can't create pdbio.pdb with %s I/O\n", ionames[io]);
+            return 1;
+        }
+        dims[0] = NZONES;
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < NZONES; j++)
+                v[j] = (float) (i + j);
+            sprintf(name, "v%d", i);
+            DBWrite(dbfile, name, v, dims, 1, DB_FLOAT);
+        }
+        dims[0] = nbig;
+        DBWrite(dbfile, "big", big, dims, 1, DB_FLOAT);
+        DBClose(dbfile);
+        printf("%-8s write %6d small, 1 large variable in %7.3f s\n",
+            ionames[io], n, (GetTime() - t0) * 1e-6);
+    }
+
+    for (io = 0; io < 3; io++)
+    {
+        t0 = GetTime();
+        dbfile = DBOpen("pdbio.pdb", DB_PDB_OPTS(opts_ids[io]), DB_READ);
+        if (!dbfile)
+        {
+            printf("can't open pdbio.pdb with %s I/O\n", ionames[io]);
+            return 1;
+        }
+        for (i = 0; i < n; i++)
+        {
+            sprintf(name, "v%d", i);
+            if (DBReadVar(dbfile, name, v) < 0)
+                nerr++;
+            for (j = 0; j < NZONES; j++)
+                if (v[j] != (float) (i + j))
+                    nerr++;
+        }
+        memset(rbig, 0, nbig * sizeof(float));
+        if (DBReadVar(dbfile, "big", rbig) < 0 ||
+            memcmp(big, rbig, nbig * sizeof(float)))
+            nerr++;
+        DBClose(dbfile);
+        printf("%-8s read  %6d small, 1 large variable in %7.3f s\n",
+            ionames[io], n, (GetTime() - t0) * 1e-6);
+    }
+
+    free(big);
+    free(rbig);
+
+    if (nerr)
+        printf("%d errors\n", nerr);
+
+    CleanupDriverStuff();
+    return nerr ? 1 : 0;
+}
@@ -71,7 +71,7 @@ typedef struct {
 
 void CreateFile (char *filename, char *name, char *type, int num,
      char **comp_names, char **pdb_names);
-void ReadFile (char *filename, char *name);
+void ReadFile (char *filename, char *name, char *mode);
 
 char *comp_names[] = {"coord0",
                       "coord1",
@@ -117,13 +117,16 @@ int main ()
 
     CreateFile("abc.pdb", "mesh", "ucdmesh", 17, comp_names, pdb_names);
 
-    ReadFile("abc.pdb", "mesh");
+    ReadFile("abc.pdb", "mesh", "rli");
+
+    /* Again with the symbol table only indexed at open */
+    ReadFile("abc.pdb", "mesh", "rd");
 
     return 0;
 }
 
 void
-ReadFile (char *filename, char *name)
+ReadFile (char *filename, char *name, char *mode)
 {
     long      i;
     PDBfile   *file=NULL;
@@ -138,7 +141,7 @@ ReadFile (char *filename, char *name)
     /*
      * Open the file. Test additional open mode chars
      */
-    if ((file = PD_open(filename, "rli")) == NULL)
+    if ((file = PD_open(filename, mode)) == NULL)
     {
         printf("Error opening file.\n");
         exit(EXIT_FAILURE);
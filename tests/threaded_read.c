@@ -0,0 +1,275 @@
+/*
+Copyright (C) 1994-2016 Lawrence Livermore National Security, LLC.
+LLNL-CODE-425250.
+All rights reserved.
+
+This file is part of Silo. For details, see silo.llnl.gov.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the disclaimer below.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the disclaimer (as noted
+     below) in the documentation and/or other materials provided with
+     the distribution.
+   * Neither the name of the LLNS/LLNL nor the names of its
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+THIS SOFTWARE  IS PROVIDED BY  THE COPYRIGHT HOLDERS  AND CONTRIBUTORS
+"AS  IS" AND  ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING,  BUT NOT
+LIMITED TO, THE IMPLIED  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A  PARTICULAR  PURPOSE ARE  DISCLAIMED.  IN  NO  EVENT SHALL  LAWRENCE
+LIVERMORE  NATIONAL SECURITY, LLC,  THE U.S.  DEPARTMENT OF  ENERGY OR
+CONTRIBUTORS BE LIABLE FOR  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR  CONSEQUENTIAL DAMAGES  (INCLUDING, BUT NOT  LIMITED TO,
+PROCUREMENT OF  SUBSTITUTE GOODS  OR SERVICES; LOSS  OF USE,  DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER  IN CONTRACT, STRICT LIABILITY,  OR TORT (INCLUDING
+NEGLIGENCE OR  OTHERWISE) ARISING IN  ANY WAY OUT  OF THE USE  OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+This work was produced at Lawrence Livermore National Laboratory under
+Contract No.  DE-AC52-07NA27344 with the DOE.
+
+Neither the  United States Government nor  Lawrence Livermore National
+Security, LLC nor any of  their employees, makes any warranty, express
+or  implied,  or  assumes  any  liability or  responsibility  for  the
+accuracy, completeness,  or usefulness of  any information, apparatus,
+product, or  process disclosed, or  represents that its use  would not
+infringe privately-owned rights.
+
+Any reference herein to  any specific commercial products, process, or
+services by trade name,  trademark, manufacturer or otherwise does not
+necessarily  constitute or imply  its endorsement,  recommendation, or
+favoring  by  the  United  States  Government  or  Lawrence  Livermore
+National Security,  LLC. The views  and opinions of  authors expressed
+herein do not necessarily state  or reflect those of the United States
+Government or Lawrence Livermore National Security, LLC, and shall not
+be used for advertising or product endorsement purposes.
+*/
+
+/*
+ * Concurrent read benchmark for the thread-safe Silo library.
+ *
+ * Writes NFILES files, each holding a ucd mesh and a zone-centered
+ * variable, and then has 1, 2, 4, ... threads each repeatedly read the
+ * mesh and variable back from a different file. The files are opened
+ * before and closed after the timed reads. Reports the
+ * wall clock time and speedup relative to a single thread for each
+ * thread count and verifies the data read back. Speedup is reported,
+ * not asserted, since it depends on whether the underlying I/O library
+ * serializes its own calls (HDF5's thread-safe build has a global lock).
+ *
+ * When the library is not built thread-safe (SILO_THREADSAFE), this
+ * test is skipped.
+ */
+
+#include <silo.h>
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(SILO_THREADSAFE) && defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
+#include <std.c>
+
+#define MAX_THREADS 8
+
+static int    driver = DB_PDB;
+static int    nzones = 20;
+static int    niters = 10;
+
+#if defined(SILO_THREADSAFE) && defined(HAVE_PTHREAD)
+
+typedef struct reader_args_t
+{
+    int     id;
+    DBfile *dbfile;
+    int     nerrors;
+} reader_args_t;
+
+static void
+filename(int i, char *buf, size_t n)
+{
+    snprintf(buf, n, "threaded_read_%d.%s", i, driver==DB_PDB?"pdb":"h5");
+}
+
+static void
+write_file(int i)
+{
+    char fname[64];
+    int const nx = nzones+1;
+    int const nnodes = nx*nx*nx;
+    int const nz = nzones*nzones*nzones;
+    float *x = (float *) malloc(nnodes*sizeof(float));
+    float *y = (float *) malloc(nnodes*sizeof(float));
+    float *z = (float *) malloc(nnodes*sizeof(float));
+    float *coords[3];
+    float *zval = (float *) malloc(nz*sizeof(float));
+    int *nodelist = (int *) malloc(8*nz*sizeof(int));
+    int shapesize = 8, shapecnt = nz, shapetype = DB_ZONETYPE_HEX;
+    int a, b, c, n = 0;
+    DBfile *dbfile;
+
+    for (c = 0; c < nx; c++)
+        for (b = 0; b < nx; b++)
+            for (a = 0; a < nx; a++, n++)
+            {
+                x[n] = a; y[n] = b; z[n] = c;
+            }
+
+    n = 0;
+    for (c = 0; c < nzones; c++)
+        for (b = 0; b < nzones; b++)
+            for (a = 0; a < nzones; a++)
+            {
+                int const n0 = c*nx*nx + b*nx + a;
+                nodelist[n++] = n0;
+                nodelist[n++] = n0 + 1;
+                nodelist[n++] = n0 + 1 + nx;
+                nodelist[n++] = n0 + nx;
+                nodelist[n++] = n0 + nx*nx;
+                nodelist[n++] = n0 + nx*nx + 1;
+                nodelist[n++] = n0 + nx*nx + 1 + nx;
+                nodelist[n++] = n0 + nx*nx + nx;
+            }
+
+    for (n = 0; n < nz; n++)
+        zval[n] = (float) (i * nz + n);
+
+    filename(i, fname, sizeof(fname));
+    dbfile = DBCreate(fname, DB_CLOBBER, DB_LOCAL, "threaded read test", driver);
+    coords[0] = x; coords[1] = y; coords[2] = z;
+    DBPutZonelist2(dbfile, "zl", nz, 3, nodelist, 8*nz, 0, 0, 0,
+        &shapetype, &shapesize, &shapecnt, 1, 0);
+    DBPutUcdmesh(dbfile, "mesh", 3, 0, (DBVCP2_t) coords, nnodes, nz, "zl", 0, DB_FLOAT, 0);
+    DBPutUcdvar1(dbfile, "zval", "mesh", zval, nz, 0, 0, DB_FLOAT, DB_ZONECENT, 0);
+    DBClose(dbfile);
+
+    free(x); free(y); free(z); free(zval); free(nodelist);
+}
+
+static void *
+reader(void *arg)
+{
+    reader_args_t *ra = (reader_args_t *) arg;
+    int const nz = nzones*nzones*nzones;
+    int it;
+
+    for (it = 0; it < niters; it++)
+    {
+        DBucdmesh *um = DBGetUcdmesh(ra->dbfile, "mesh");
+        DBucdvar *uv = DBGetUcdvar(ra->dbfile, "zval");
+
+        if (!um || !um->zones || um->zones->nzones != nz || um->zones->lnodelist != 8*nz)
+            ra->nerrors++;
+        if (!uv || uv->nels != nz ||
+            ((float*)uv->vals[0])[nz-1] != (float) (ra->id * nz + nz - 1))
+            ra->nerrors++;
+
+        DBFreeUcdmesh(um);
+        DBFreeUcdvar(uv);
+    }
+
+    return 0;
+}
+
+static int
+run_readers(int nthreads, double *t)
+{
+    pthread_t threads[MAX_THREADS];
+    reader_args_t args[MAX_THREADS];
+    double t0;
+    int i, nfiles = nthreads, nerrors = 0;
+
+    /* opens are serialized anyway; keep them out of the timing */
+    for (i = 0; i < nthreads; i++)
+    {
+        char fname[64];
+        filename(i, fname, sizeof(fname));
+        args[i].id = i;
+        args[i].nerrors = 0;
+        if (!(args[i].dbfile = DBOpen(fname, DB_UNKNOWN, DB_READ)))
+            nerrors++;
+    }
+    if (nerrors)
+        nthreads = 0;
+
+    t0 = GetTime();
+    for (i = 0; i < nthreads; i++)
+        pthread_create(&threads[i], 0, reader, &args[i]);
+    for (i = 0; i < nthreads; i++)
+    {
+        pthread_join(threads[i], 0);
+        nerrors += args[i].nerrors;
+    }
+    *t = (GetTime() - t0) * 1e-6; /* GetTime is in micro-seconds */
+
+    for (i = 0; i < nfiles; i++)
+        if (args[i].dbfile) DBClose(args[i].dbfile);
+    return nerrors;
+}
+
+#endif
+
+int
+main(int argc, char *argv[])
+{
+    int i, nerrors = 0;
+    int nthreads_max = 4;
+    int show_all_errors = FALSE;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strncmp(argv[i], "DB_", 3))
+            driver = StringToDriver(argv[i]);
+        else if (!strncmp(argv[i], "nthreads=", 9))
+            nthreads_max = (int) strtol(argv[i]+9,0,10);
+        else if (!strncmp(argv[i], "nzones=", 7))
+            nzones = (int) strtol(argv[i]+7,0,10);
+        else if (!strncmp(argv[i], "niters=", 7))
+            niters = (int) strtol(argv[i]+7,0,10);
+        else if (!strcmp(argv[i], "show-all-errors"))
+            show_all_errors = TRUE;
+        else if (argv[i][0] != '\0')
+            fprintf(stderr, "%s: ignored argument `%s'\n", argv[0], argv[i]);
+    }
+
+#if !defined(SILO_THREADSAFE) || !defined(HAVE_PTHREAD)
+    fprintf(stderr, "Silo was not built thread-safe; skipping.\n");
+    CleanupDriverStuff();
+    return skip_retval;
+#else
+    {
+        double t1 = 0, t;
+        int n;
+
+        if (nthreads_max > MAX_THREADS) nthreads_max = MAX_THREADS;
+        if (nthreads_max < 1) nthreads_max = 1;
+
+        if (show_all_errors) DBShowErrors(DB_ALL_AND_DRVR, 0);
+
+        for (i = 0; i < nthreads_max; i++)
+            write_file(i);
+
+        printf("%8s %12s %12s %10s\n", "threads", "seconds", "MB/sec", "speedup");
+        for (n = 1; n <= nthreads_max; n *= 2)
+        {
+            double const mb = (double) n * niters * nzones * nzones * nzones *
+                (3*4 + 8*4 + 4) / (1<<20); /* ~coords+nodelist+var */
+            nerrors += run_readers(n, &t);
+            if (n == 1) t1 = t;
+            printf("%8d %12.4f %12.2f %10.2f\n", n, t, mb / t, t1 * n / t);
+        }
+    }
+
+    CleanupDriverStuff();
+    return nerrors;
+#endif
+}
@@ -0,0 +1,324 @@
+/*
+Copyright (C) 1994-2016 Lawrence Livermore National Security, LLC.
+LLNL-CODE-425250.
+All rights reserved.
+
+This file is part of Silo. For details, see silo.llnl.gov.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the disclaimer below.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the disclaimer (as noted
+     below) in the documentation and/or other materials provided with
+     the distribution.
+   * Neither the name of the LLNS/LLNL nor the names of its
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+THIS SOFTWARE  IS PROVIDED BY  THE COPYRIGHT HOLDERS  AND CONTRIBUTORS
+"AS  IS" AND  ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING,  BUT NOT
+LIMITED TO, THE IMPLIED  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A  PARTICULAR  PURPOSE ARE  DISCLAIMED.  IN  NO  EVENT SHALL  LAWRENCE
+LIVERMORE  NATIONAL SECURITY, LLC,  THE U.S.  DEPARTMENT OF  ENERGY OR
+CONTRIBUTORS BE LIABLE FOR  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR  CONSEQUENTIAL DAMAGES  (INCLUDING, BUT NOT  LIMITED TO,
+PROCUREMENT OF  SUBSTITUTE GOODS  OR SERVICES; LOSS  OF USE,  DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER  IN CONTRACT, STRICT LIABILITY,  OR TORT (INCLUDING
+NEGLIGENCE OR  OTHERWISE) ARISING IN  ANY WAY OUT  OF THE USE  OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+This work was produced at Lawrence Livermore National Laboratory under
+Contract No.  DE-AC52-07NA27344 with the DOE.
+
+Neither the  United States Government nor  Lawrence Livermore National
+Security, LLC nor any of  their employees, makes any warranty, express
+or  implied,  or  assumes  any  liability or  responsibility  for  the
+accuracy, completeness,  or usefulness of  any information, apparatus,
+product, or  process disclosed, or  represents that its use  would not
+infringe privately-owned rights.
+
+Any reference herein to  any specific commercial products, process, or
+services by trade name,  trademark, manufacturer or otherwise does not
+necessarily  constitute or imply  its endorsement,  recommendation, or
+favoring  by  the  United  States  Government  or  Lawrence  Livermore
+National Security,  LLC. The views  and opinions of  authors expressed
+herein do not necessarily state  or reflect those of the United States
+Government or Lawrence Livermore National Security, LLC, and shall not
+be used for advertising or product endorsement purposes.
+*/
+
+/*
+ * Test and time the HDF5 driver's per-directory TOC index.
+ *
+ * Writes a directory with many curves (committed datatypes, the costly
+ * case for scanning), some simple variables, a subdirectory and a soft
+ * link. Then, compares DBGetToc with the TOC index to DBGetToc after
+ * the index has been removed (forcing a scan) and checks that both
+ * agree. Finally, adds an object and renames another behind Silo's back
+ * and makes sure the stale index is ignored each time and rewritten in
+ * place by the next writer.
+ *
+ * Usage: toc_index [DB_HDF5] [n=<number of curves>]
+ */
+
+#include <silo.h>
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_HDF5_H
+#include <hdf5.h>
+#endif
+
+#include <std.c>
+
+static int
+same_names(int n1, char **names1, int n2, char **names2, char const *what)
+{
+    int i;
+    if (n1 != n2)
+    {
+        fprintf(stderr, "%s: count mismatch %d != %d\n", what, n1, n2);
+        return 1;
+    }
+    for (i = 0; i < n1; i++)
+    {
+        if (strcmp(names1[i], names2[i]))
+        {
+            fprintf(stderr, "%s: name mismatch \"%s\" != \"%s\"\n", what, names1[i], names2[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void
+copy_names(int n, char **src, char ***dst)
+{
+    int i;
+    *dst = (char **) malloc((n ? n : 1) * sizeof(char*));
+    for (i = 0; i < n; i++)
+        (*dst)[i] = strdup(src[i]);
+}
+
+static void
+free_names(int n, char **names)
+{
+    int i;
+    for (i = 0; i < n; i++)
+        free(names[i]);
+    free(names);
+}
+
+#ifdef HAVE_HDF5_H
+static void
+remove_index(char const *fname, char const *dirname)
+{
+    hid_t fid = H5Fopen(fname, H5F_ACC_RDWR, H5P_DEFAULT);
+    hid_t grp = H5Gopen(fid, dirname, H5P_DEFAULT);
+    H5Adelete(grp, "silo_toc");
+    H5Gclose(grp);
+    H5Fclose(fid);
+}
+
+static long long
+index_number(char const *fname, char const *dirname)
+{
+    long long vals[5] = {0, 0, 0, 0, -1};
+    hid_t fid = H5Fopen(fname, H5F_ACC_RDONLY, H5P_DEFAULT);
+    hid_t grp = H5Gopen(fid, dirname, H5P_DEFAULT);
+    hid_t attr = H5Aopen_name(grp, "silo_toc");
+    H5Aread(attr, H5T_NATIVE_LLONG, vals);
+    H5Aclose(attr);
+    H5Gclose(grp);
+    H5Fclose(fid);
+    return vals[4];
+}
+
+static void
+add_foreign_dataset(char const *fname, char const *dirname)
+{
+    hsize_t one = 1;
+    int val = 1;
+    hid_t fid = H5Fopen(fname, H5F_ACC_RDWR, H5P_DEFAULT);
+    hid_t space = H5Screate_simple(1, &one, NULL);
+    hid_t dset = H5Dcreate(fid, dirname, H5T_NATIVE_INT, space,
+                     H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &val);
+    H5Dclose(dset);
+    H5Sclose(space);
+    H5Fclose(fid);
+}
+
+static void
+rename_foreign(char const *fname, char const *src, char const *dst)
+{
+    hid_t fid = H5Fopen(fname, H5F_ACC_RDWR, H5P_DEFAULT);
+    H5Lmove(fid, src, fid, dst, H5P_DEFAULT, H5P_DEFAULT);
+    H5Fclose(fid);
+}
+#endif
+
+int
+main(int argc, char *argv[])
+{
+    int            driver = DB_HDF5;
+    int            ncurves = 2000;
+    int            i, nerrors = 0;
+    int            show_all_errors = FALSE;
+    DBfile        *dbfile;
+
+    for (i=1; i<argc; i++) {
+        if (!strncmp(argv[i], "DB_", 3)) {
+            driver = StringToDriver(argv[i]);
+        } else if (!strncmp(argv[i], "n=", 2)) {
+            ncurves = (int) strtol(argv[i]+2, 0, 10);
+        } else if (!strcmp(argv[i], "show-all-errors")) {
+            show_all_errors = TRUE;
+        } else if (argv[i][0] != '\0') {
+            fprintf(stderr, "%s: ignored argument `%s'\n", argv[0], argv[i]);
+        }
+    }
+
+#ifdef HAVE_HDF5_H
+    if ((driver&0xF) != DB_HDF5)
+#endif
+    {
+        fprintf(stderr, "This test only applies to HDF5 driver\n");
+        CleanupDriverStuff();
+        return skip_retval;
+    }
+
+#ifdef HAVE_HDF5_H
+    if (show_all_errors) DBShowErrors(DB_ALL_AND_DRVR, 0);
+
+    dbfile = DBCreate("toc_index.h5", DB_CLOBBER, DB_LOCAL, "toc index test", driver);
+    DBMkDir(dbfile, "big");
+    DBSetDir(dbfile, "big");
+    {
+        float x[3] = {0, 1, 2}, y[3] = {0, 1, 4};
+        int dims = 3;
+        for (i = 0; i < ncurves; i++)
+        {
+            char name[32];
+            sprintf(name, "curve%06d", i);
+            DBPutCurve(dbfile, name, x, y, DB_FLOAT, 3, 0);
+            if (i % 10 == 0)
+            {
+                sprintf(name, "var%06d", i);
+                DBWrite(dbfile, name, y, &dims, 1, DB_FLOAT);
+            }
+        }
+    }
+    DBMkDir(dbfile, "subdir");
+    DBMkSymlink(dbfile, "/big/curve000000", "alias");
+    DBClose(dbfile);
+
+    {
+        DBtoc *toc;
+        char **curve_names, **var_names, **dir_names;
+        int ncurve, nvar, ndir, nsymlink;
+        long long index;
+        double t0, t_index, t_scan;
+
+        /* TOC via index */
+        dbfile = DBOpen("toc_index.h5", driver, DB_READ);
+        t0 = GetTime();
+        DBSetDir(dbfile, "big");
+        toc = DBGetToc(dbfile);
+        t_index = GetTime() - t0;
+        ncurve = toc->ncurve; nvar = toc->nvar; ndir = toc->ndir;
+        nsymlink = toc->nsymlink;
+        copy_names(ncurve, toc->curve_names, &curve_names);
+        copy_names(nvar, toc->var_names, &var_names);
+        copy_names(ndir, toc->dir_names, &dir_names);
+        DBClose(dbfile);
+
+        if (ncurve != ncurves + 1 /* alias */ || nvar != (ncurves+9)/10 ||
+            ndir != 1 || nsymlink != 1)
+        {
+            fprintf(stderr, "unexpected TOC counts: ncurve=%d, nvar=%d, ndir=%d, nsymlink=%d\n",
+                ncurve, nvar, ndir, nsymlink);
+            nerrors++;
+        }
+
+        /* TOC via scan */
+        remove_index("toc_index.h5", "/big");
+        dbfile = DBOpen("toc_index.h5", driver, DB_READ);
+        t0 = GetTime();
+        DBSetDir(dbfile, "big");
+        toc = DBGetToc(dbfile);
+        t_scan = GetTime() - t0;
+        nerrors += same_names(ncurve, curve_names, toc->ncurve, toc->curve_names, "curves");
+        nerrors += same_names(nvar, var_names, toc->nvar, toc->var_names, "vars");
+        nerrors += same_names(ndir, dir_names, toc->ndir, toc->dir_names, "dirs");
+        if (toc->nsymlink != 1 || strcmp(toc->symlink_target_names[0], "/big/curve000000"))
+        {
+            fprintf(stderr, "symlink mismatch\n");
+            nerrors++;
+        }
+        DBClose(dbfile);
+
+        printf("DBGetToc of %d objects: index %.6f sec, scan %.6f sec, speedup %.1f\n",
+            ncurve + nvar + ndir, t_index * 1e-6, t_scan * 1e-6,
+            t_index > 0 ? t_scan / t_index : 0);
+
+        /* Re-index by opening for append and visiting dir */
+        dbfile = DBOpen("toc_index.h5", driver, DB_APPEND);
+        DBSetDir(dbfile, "big");
+        DBClose(dbfile);
+        index = index_number("toc_index.h5", "/big");
+
+        /* A stale index must not be used */
+        add_foreign_dataset("toc_index.h5", "/big/foreign");
+        dbfile = DBOpen("toc_index.h5", driver, DB_READ);
+        DBSetDir(dbfile, "big");
+        toc = DBGetToc(dbfile);
+        if (toc->nvar != nvar + 1)
+        {
+            fprintf(stderr, "stale TOC index was used\n");
+            nerrors++;
+        }
+        DBClose(dbfile);
+
+        /* Re-indexing rewrites the same index dataset */
+        dbfile = DBOpen("toc_index.h5", driver, DB_APPEND);
+        DBSetDir(dbfile, "big");
+        DBClose(dbfile);
+        if (index_number("toc_index.h5", "/big") != index)
+        {
+            fprintf(stderr, "TOC index was not rewritten in place\n");
+            nerrors++;
+        }
+
+        /* Nor one whose link count is unchanged by a rename */
+        rename_foreign("toc_index.h5", "/big/var000000", "/big/renamed");
+        dbfile = DBOpen("toc_index.h5", driver, DB_READ);
+        DBSetDir(dbfile, "big");
+        toc = DBGetToc(dbfile);
+        for (i = 0; i < toc->nvar; i++)
+        {
+            if (!strcmp(toc->var_names[i], "renamed"))
+                break;
+        }
+        if (toc->nvar != nvar + 1 || i == toc->nvar)
+        {
+            fprintf(stderr, "stale TOC index was used after rename\n");
+            nerrors++;
+        }
+        DBClose(dbfile);
+
+        free_names(ncurve, curve_names);
+        free_names(nvar, var_names);
+        free_names(ndir, dir_names);
+    }
+#endif
+
+    CleanupDriverStuff();
+    return nerrors;
+}
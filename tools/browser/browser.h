@@ -506,6 +506,7 @@ extern diffopt_t DiffOpt;
 obj_t V_array (int, obj_t[]);
 obj_t V_assign (int, obj_t[]);
 obj_t V_close (int, obj_t[]);
+obj_t V_compression (int, obj_t[]);
 obj_t F_cons (obj_t, obj_t);
 obj_t V_diff (int, obj_t[]);
 obj_t V_dot (int, obj_t[]);
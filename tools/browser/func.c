@@ -294,6 +294,104 @@ V_close (int argc, obj_t argv[]) {
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:    compression_row
+ *
+ * Purpose:     Prints one line of the `compression' command's summary.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+compression_row (char const *name, DBcompressionstats const *cs) {
+
+   double ratio = cs->stored_bytes>0 ?
+                  (double)cs->original_bytes/(double)cs->stored_bytes : 1.0;
+
+   out_push (OUT_STDOUT, name);
+   out_printf (OUT_STDOUT, "original %lld, ", cs->original_bytes);
+   out_printf (OUT_STDOUT, "stored %lld, ", cs->stored_bytes);
+   out_printf (OUT_STDOUT, "ratio %.2f, ", ratio);
+   out_printf (OUT_STDOUT, "%.4f seconds, ", cs->write_time);
+   out_printf (OUT_STDOUT, "%d of %d compressed, ", cs->ncompressed,
+               cs->ndatasets);
+   out_printf (OUT_STDOUT, "%s", cs->method[0] ? cs->method : "none");
+   out_pop (OUT_STDOUT);
+   out_nl (OUT_STDOUT);
+   out_nl (OUT_STDOUT);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    V_compression
+ *
+ * Purpose:     Summarizes the compression recorded for the datasets of a
+ *              file: original and stored bytes, compression ratio, seconds
+ *              spent compressing and the compression method. The optional
+ *              first argument is a file (default `$1'); any further
+ *              arguments name the objects or arrays to summarize one by
+ *              one, otherwise the whole file is summarized.
+ *
+ * Return:      Success:        NIL
+ *
+ *              Failure:        NIL
+ *-------------------------------------------------------------------------
+ */
+obj_t
+V_compression (int argc, obj_t argv[]) {
+
+   obj_t                fileobj=NIL;
+   DBfile               *file=NULL;
+   DBcompressionstats   cs;
+   char                 *name;
+   int                  i, first_arg=0;
+
+   if (argc>=1 && C_SYM==argv[0]->pub.cls &&
+       (fileobj=sym_vboundp(argv[0]))) {
+      if (C_FILE==fileobj->pub.cls) {
+         first_arg = 1;
+      } else {
+         fileobj = obj_dest (fileobj);
+      }
+   }
+   if (!fileobj) {
+      obj_t b1 = obj_new (C_SYM, "$1");
+      fileobj = sym_vboundp (b1);
+      b1 = obj_dest (b1);
+      if (!fileobj) {
+         out_errorn ("compression: no default open file (`$1' has no value)");
+         return NIL;
+      }
+   }
+   if (C_FILE!=fileobj->pub.cls || NULL==(file=file_file(fileobj))) {
+      out_error ("compression: inappropriate file: ", fileobj);
+      goto done;
+   }
+
+   out_info ("Compression in file %s", obj_name(fileobj));
+   if (first_arg==argc) {
+      if (DBGetCompressionStats (file, NULL, &cs)<0) {
+         out_errorn ("compression: no compression statistics for this file");
+         goto done;
+      }
+      compression_row (obj_name(fileobj), &cs);
+   }
+   for (i=first_arg; i<argc; i++) {
+      if (NULL==(name=obj_name(argv[i]))) {
+         out_errorn ("compression: arg-%d is not an object name", i+1);
+      } else if (DBGetCompressionStats (file, name, &cs)<0) {
+         out_errorn ("compression: no compression statistics for `%s'", name);
+      } else {
+         compression_row (name, &cs);
+      }
+   }
+
+done:
+   fileobj = obj_dest (fileobj);
+   return NIL;
+}
+
+
 /*-------------------------------------------------------------------------
  * Function:    F_cons
  *
@@ -139,6 +139,19 @@ parse_init (void) {
         "with symbol FOO is equivalent to saying `FOO=nil', except with "
         "extra sanity checks.");
 
+   bif ("compression",  V_compression,  HOLD,
+        "Summarize dataset compression.",
+        "Prints the compression recorded when the datasets of a file were "
+        "written: original and stored bytes, their ratio, seconds spent "
+        "compressing, how many of the datasets were compressed and with "
+        "what method. If the first argument is a file (like `$2') then that "
+        "file is summarized, otherwise the file represented by browser "
+        "variable `$1'. With no further arguments the whole file is "
+        "summarized in one line; otherwise one line is printed for each "
+        "named object or array in the CWD, an object summing over its "
+        "arrays. Only files written by the HDF5 driver record these "
+        "statistics.");
+
    bif ("diff",         V_diff,         0,
         "Compare two objects.",
         "Calculates the differences between its arguments similar to the "